@@ -1,15 +1,18 @@
 // Copyright 2020-2023, Roberto De Ioris.
 
 #include "glTFRuntime.h"
+#include "glTFRuntimeGameThreadQueue.h"
 
 #define LOCTEXT_NAMESPACE "FglTFRuntimeModule"
 
 void FglTFRuntimeModule::StartupModule()
 {
+	FglTFRuntimeGameThreadQueue::Get().Startup();
 }
 
 void FglTFRuntimeModule::ShutdownModule()
 {
+	FglTFRuntimeGameThreadQueue::Get().Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
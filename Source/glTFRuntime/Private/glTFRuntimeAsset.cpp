@@ -1,6 +1,7 @@
 // Copyright 2020-2023, Roberto De Ioris.
 
 #include "glTFRuntimeAsset.h"
+#include "glTFRuntimeGameThreadQueue.h"
 #include "Animation/AnimSequence.h"
 #include "Engine/World.h"
 #include "Runtime/Launch/Resources/Version.h"
@@ -359,6 +360,28 @@ bool UglTFRuntimeAsset::LoadFromData(const uint8* DataPtr, int64 DataNum, const
 	return Parser != nullptr;
 }
 
+bool UglTFRuntimeAsset::LoadFromStorage(FglTFRuntimeBytesStorageRef InStorage, const FglTFRuntimeConfig& LoaderConfig)
+{
+	// asset already loaded ?
+	if (Parser)
+	{
+		return false;
+	}
+
+	Parser = FglTFRuntimeParser::FromStorage(InStorage, LoaderConfig);
+	if (Parser)
+	{
+		FScriptDelegate Delegate;
+		Delegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeAsset, OnErrorProxy));
+		Parser->OnError.Add(Delegate);
+		Delegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeAsset, OnStaticMeshCreatedProxy));
+		Parser->OnStaticMeshCreated.Add(Delegate);
+		Delegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeAsset, OnSkeletalMeshCreatedProxy));
+		Parser->OnSkeletalMeshCreated.Add(Delegate);
+	}
+	return Parser != nullptr;
+}
+
 void UglTFRuntimeAsset::OnErrorProxy(const FString& ErrorContext, const FString& ErrorMessage)
 {
 	if (OnError.IsBound())
@@ -578,11 +601,11 @@ USkeletalMesh* UglTFRuntimeAsset::LoadSkeletalMesh(const int32 MeshIndex, const
 	return Parser->LoadSkeletalMesh(MeshIndex, SkinIndex, SkeletalMeshConfig);
 }
 
-void UglTFRuntimeAsset::LoadSkeletalMeshAsync(const int32 MeshIndex, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshAsync& AsyncCallback, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig)
+UglTFRuntimeLoadHandle* UglTFRuntimeAsset::LoadSkeletalMeshAsync(const int32 MeshIndex, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshAsync& AsyncCallback, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig)
 {
-	GLTF_CHECK_PARSER_VOID();
+	GLTF_CHECK_PARSER(nullptr);
 
-	Parser->LoadSkeletalMeshAsync(MeshIndex, SkinIndex, AsyncCallback, SkeletalMeshConfig);
+	return UglTFRuntimeLoadHandle::Create(Parser->LoadSkeletalMeshAsync(MeshIndex, SkinIndex, AsyncCallback, SkeletalMeshConfig));
 }
 
 USkeletalMesh* UglTFRuntimeAsset::LoadSkeletalMeshRecursive(const FString& NodeName, const TArray<FString>& ExcludeNodes, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode)
@@ -592,18 +615,18 @@ USkeletalMesh* UglTFRuntimeAsset::LoadSkeletalMeshRecursive(const FString& NodeN
 	return Parser->LoadSkeletalMeshRecursive(NodeName, SkeletalMeshConfig.OverrideSkinIndex, ExcludeNodes, SkeletalMeshConfig, TransformApplyRecursiveMode);
 }
 
-void UglTFRuntimeAsset::LoadSkeletalMeshRecursiveAsync(const FString& NodeName, const TArray<FString>& ExcludeNodes, const FglTFRuntimeSkeletalMeshAsync& AsyncCallback, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode)
+UglTFRuntimeLoadHandle* UglTFRuntimeAsset::LoadSkeletalMeshRecursiveAsync(const FString& NodeName, const TArray<FString>& ExcludeNodes, const FglTFRuntimeSkeletalMeshAsync& AsyncCallback, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode)
 {
-	GLTF_CHECK_PARSER_VOID();
+	GLTF_CHECK_PARSER(nullptr);
 
-	Parser->LoadSkeletalMeshRecursiveAsync(NodeName, SkeletalMeshConfig.OverrideSkinIndex, ExcludeNodes, AsyncCallback, SkeletalMeshConfig, TransformApplyRecursiveMode);
+	return UglTFRuntimeLoadHandle::Create(Parser->LoadSkeletalMeshRecursiveAsync(NodeName, SkeletalMeshConfig.OverrideSkinIndex, ExcludeNodes, AsyncCallback, SkeletalMeshConfig, TransformApplyRecursiveMode));
 }
 
-void UglTFRuntimeAsset::LoadStaticMeshRecursiveAsync(const FString& NodeName, const TArray<FString>& ExcludeNodes, const FglTFRuntimeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig)
+UglTFRuntimeLoadHandle* UglTFRuntimeAsset::LoadStaticMeshRecursiveAsync(const FString& NodeName, const TArray<FString>& ExcludeNodes, const FglTFRuntimeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig)
 {
-	GLTF_CHECK_PARSER_VOID();
+	GLTF_CHECK_PARSER(nullptr);
 
-	Parser->LoadStaticMeshRecursiveAsync(NodeName, ExcludeNodes, AsyncCallback, StaticMeshConfig);
+	return UglTFRuntimeLoadHandle::Create(Parser->LoadStaticMeshRecursiveAsync(NodeName, ExcludeNodes, AsyncCallback, StaticMeshConfig));
 }
 
 USkeleton* UglTFRuntimeAsset::LoadSkeleton(const int32 SkinIndex, const FglTFRuntimeSkeletonConfig& SkeletonConfig)
@@ -915,18 +938,18 @@ bool UglTFRuntimeAsset::LoadEmitterIntoAudioComponent(const FglTFRuntimeAudioEmi
 	return Parser->LoadEmitterIntoAudioComponent(Emitter, AudioComponent);
 }
 
-void UglTFRuntimeAsset::LoadStaticMeshAsync(const int32 MeshIndex, const FglTFRuntimeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig)
+UglTFRuntimeLoadHandle* UglTFRuntimeAsset::LoadStaticMeshAsync(const int32 MeshIndex, const FglTFRuntimeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig)
 {
-	GLTF_CHECK_PARSER_VOID();
+	GLTF_CHECK_PARSER(nullptr);
 
-	Parser->LoadStaticMeshAsync(MeshIndex, AsyncCallback, StaticMeshConfig);
+	return UglTFRuntimeLoadHandle::Create(Parser->LoadStaticMeshAsync(MeshIndex, AsyncCallback, StaticMeshConfig));
 }
 
-void UglTFRuntimeAsset::LoadMeshAsRuntimeLODAsync(const int32 MeshIndex, const FglTFRuntimeMeshLODAsync& AsyncCallback, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
+UglTFRuntimeLoadHandle* UglTFRuntimeAsset::LoadMeshAsRuntimeLODAsync(const int32 MeshIndex, const FglTFRuntimeMeshLODAsync& AsyncCallback, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
 {
-	GLTF_CHECK_PARSER_VOID();
+	GLTF_CHECK_PARSER(nullptr);
 
-	Parser->LoadMeshAsRuntimeLODAsync(MeshIndex, AsyncCallback, MaterialsConfig);
+	return UglTFRuntimeLoadHandle::Create(Parser->LoadMeshAsRuntimeLODAsync(MeshIndex, AsyncCallback, MaterialsConfig));
 }
 
 void UglTFRuntimeAsset::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndices, const FglTFRuntimeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig)
@@ -1120,28 +1143,34 @@ UTexture2D* UglTFRuntimeAsset::LoadImageFromBlob(const FglTFRuntimeImagesConfig&
 	return nullptr;
 }
 
-void UglTFRuntimeAsset::LoadImageFromBlobAsync(const FglTFRuntimeTexture2DAsync& AsyncCallback, const FglTFRuntimeImagesConfig& ImagesConfig)
+UglTFRuntimeLoadHandle* UglTFRuntimeAsset::LoadImageFromBlobAsync(const FglTFRuntimeTexture2DAsync& AsyncCallback, const FglTFRuntimeImagesConfig& ImagesConfig)
 {
-	Async(EAsyncExecution::Thread, [this, ImagesConfig, AsyncCallback]()
+	FglTFRuntimeLoadHandleRef LoadHandle = MakeShared<FglTFRuntimeLoadHandle, ESPMode::ThreadSafe>();
+
+	Async(EAsyncExecution::Thread, [this, ImagesConfig, AsyncCallback, LoadHandle]()
 		{
 			TArray64<uint8> UncompressedBytes;
 			int32 Width = 0;
 			int32 Height = 0;
 			EPixelFormat PixelFormat;
 
-			if (!Parser ||
+			if (LoadHandle->IsCancelled() ||
+				!Parser ||
 				!Parser->LoadImageFromBlob(Parser->GetBlob(), MakeShared<FJsonObject>(), UncompressedBytes, Width, Height, PixelFormat, ImagesConfig) ||
 				Width <= 0 ||
 				Height <= 0)
 			{
-				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&, AsyncCallback]()
+				FGraphEventRef Task = FglTFRuntimeGameThreadQueue::Get().Enqueue([AsyncCallback, LoadHandle]()
 					{
+						LoadHandle->Complete();
 						AsyncCallback.ExecuteIfBound(nullptr);
-					}, TStatId(), nullptr, ENamedThreads::GameThread);
+					}, LoadHandle);
 				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 				return;
 			}
 
+			LoadHandle->SetProgress(0.5f);
+
 			FglTFRuntimeMipMap Mip(-1);
 			Mip.Pixels = MoveTemp(UncompressedBytes);
 			Mip.Width = Width;
@@ -1150,13 +1179,17 @@ void UglTFRuntimeAsset::LoadImageFromBlobAsync(const FglTFRuntimeTexture2DAsync&
 			TArray<FglTFRuntimeMipMap> Mips;
 			Mips.Add(MoveTemp(Mip));
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&]()
+			// texture creation is budgeted with the other game thread work of the async loads
+			FGraphEventRef Task = FglTFRuntimeGameThreadQueue::Get().Enqueue([&]()
 				{
-					AsyncCallback.ExecuteIfBound(Parser->BuildTexture(this, Mips, ImagesConfig, FglTFRuntimeTextureSampler()));
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
+					LoadHandle->Complete();
+					AsyncCallback.ExecuteIfBound(LoadHandle->IsCancelled() ? nullptr : Parser->BuildTexture(this, Mips, ImagesConfig, FglTFRuntimeTextureSampler()));
+				}, LoadHandle);
 			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 		}
 	);
+
+	return UglTFRuntimeLoadHandle::Create(LoadHandle);
 }
 
 UTexture2DArray* UglTFRuntimeAsset::LoadImageArrayFromBlob(const FglTFRuntimeImagesConfig& ImagesConfig)
@@ -1413,10 +1446,10 @@ bool UglTFRuntimeAsset::LoadSkinnedMeshRecursiveAsRuntimeLOD(const FString& Node
 	return Parser->LoadSkinnedMeshRecursiveAsRuntimeLOD(NodeName, SkinIndex, ExcludeNodes, RuntimeLOD, MaterialsConfig, SkeletonConfig, TransformApplyRecursiveMode);
 }
 
-void UglTFRuntimeAsset::LoadSkinnedMeshRecursiveAsRuntimeLODAsync(const FString& NodeName, const TArray<FString>& ExcludeNodes, const FglTFRuntimeMeshLODAsync& AsyncCallback, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const FglTFRuntimeSkeletonConfig& SkeletonConfig, int32& SkinIndex, const int32 OverrideSkinIndex, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode)
+UglTFRuntimeLoadHandle* UglTFRuntimeAsset::LoadSkinnedMeshRecursiveAsRuntimeLODAsync(const FString& NodeName, const TArray<FString>& ExcludeNodes, const FglTFRuntimeMeshLODAsync& AsyncCallback, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const FglTFRuntimeSkeletonConfig& SkeletonConfig, int32& SkinIndex, const int32 OverrideSkinIndex, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode)
 {
-	GLTF_CHECK_PARSER_VOID();
-	Parser->LoadSkinnedMeshRecursiveAsRuntimeLODAsync(NodeName, SkinIndex, ExcludeNodes, AsyncCallback, MaterialsConfig, SkeletonConfig, TransformApplyRecursiveMode);
+	GLTF_CHECK_PARSER(nullptr);
+	return UglTFRuntimeLoadHandle::Create(Parser->LoadSkinnedMeshRecursiveAsRuntimeLODAsync(NodeName, SkinIndex, ExcludeNodes, AsyncCallback, MaterialsConfig, SkeletonConfig, TransformApplyRecursiveMode));
 }
 
 USkeletalMesh* UglTFRuntimeAsset::LoadSkeletalMeshFromRuntimeLODs(const TArray<FglTFRuntimeMeshLOD>& RuntimeLODs, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig)
@@ -1685,6 +1718,34 @@ void UglTFRuntimeAsset::ClearCache()
 	}
 }
 
+FglTFRuntimeCacheStats UglTFRuntimeAsset::GetCacheStats() const
+{
+	GLTF_CHECK_PARSER(FglTFRuntimeCacheStats());
+
+	return Parser->GetCacheStats();
+}
+
+FglTFRuntimeLoaderStats UglTFRuntimeAsset::GetLoaderStats() const
+{
+	GLTF_CHECK_PARSER(FglTFRuntimeLoaderStats());
+
+	return Parser->GetLoaderStats();
+}
+
+FglTFRuntimeMeshOptimizationStats UglTFRuntimeAsset::GetMeshOptimizationStats() const
+{
+	GLTF_CHECK_PARSER(FglTFRuntimeMeshOptimizationStats());
+
+	return Parser->GetMeshOptimizationStats();
+}
+
+void UglTFRuntimeAsset::TrimCache()
+{
+	GLTF_CHECK_PARSER_VOID();
+
+	Parser->TrimCache(true);
+}
+
 bool UglTFRuntimeAsset::IsArchive() const
 {
 	GLTF_CHECK_PARSER(false);
@@ -1816,4 +1877,46 @@ FString UglTFRuntimeAsset::GetSkinJointNameFromNodeIndex(const int32 SkinIndex,
 	GLTF_CHECK_PARSER("");
 
 	return Parser->GetSkinJointNameFromNodeIndex(SkinIndex, NodeIndex);
-}
\ No newline at end of file
+}
+UglTFRuntimeLoadHandle* UglTFRuntimeLoadHandle::Create(FglTFRuntimeLoadHandleRef InLoadHandle)
+{
+	UglTFRuntimeLoadHandle* NewLoadHandle = NewObject<UglTFRuntimeLoadHandle>();
+	NewLoadHandle->LoadHandle = InLoadHandle;
+	return NewLoadHandle;
+}
+
+void UglTFRuntimeLoadHandle::Cancel()
+{
+	if (LoadHandle)
+	{
+		LoadHandle->Cancel();
+	}
+}
+
+bool UglTFRuntimeLoadHandle::IsCancelled() const
+{
+	return LoadHandle ? LoadHandle->IsCancelled() : false;
+}
+
+bool UglTFRuntimeLoadHandle::IsCompleted() const
+{
+	return LoadHandle ? LoadHandle->IsCompleted() : true;
+}
+
+void UglTFRuntimeLoadHandle::SetPriority(const int32 Priority)
+{
+	if (LoadHandle)
+	{
+		LoadHandle->SetPriority(Priority);
+	}
+}
+
+int32 UglTFRuntimeLoadHandle::GetPriority() const
+{
+	return LoadHandle ? LoadHandle->GetPriority() : 0;
+}
+
+float UglTFRuntimeLoadHandle::GetProgress() const
+{
+	return LoadHandle ? LoadHandle->GetProgress() : 1;
+}
@@ -20,6 +20,14 @@ AglTFRuntimeAssetActorAsync::AglTFRuntimeAssetActorAsync()
 	bStaticMeshesAsSkeletal = false;
 
 	bAllowLights = true;
+
+	MaxConcurrentMeshes = 4;
+	bShareMeshes = true;
+
+	NextMeshLoad = 0;
+	NextMeshToAssign = 0;
+	MeshLoadsInFlight = 0;
+	bScenesLoaded = false;
 }
 
 // Called when the game starts or when spawned
@@ -52,7 +60,16 @@ void AglTFRuntimeAssetActorAsync::BeginPlay()
 		}
 	}
 
-	LoadNextMeshAsync();
+	LoadedMeshes.SetNum(MeshLoads.Num());
+	LoadHandles.SetNum(MeshLoads.Num());
+
+	if (MeshesToLoad.Num() == 0)
+	{
+		ScenesLoaded();
+		return;
+	}
+
+	LoadNextMeshesAsync();
 }
 
 void AglTFRuntimeAssetActorAsync::ProcessNode(USceneComponent* NodeParentComponent, const FName SocketName, FglTFRuntimeNode& Node)
@@ -90,9 +107,9 @@ void AglTFRuntimeAssetActorAsync::ProcessNode(USceneComponent* NodeParentCompone
 			StaticMeshComponent->RegisterComponent();
 			StaticMeshComponent->SetRelativeTransform(Node.Transform);
 			AddInstanceComponent(StaticMeshComponent);
-			MeshesToLoad.Add(StaticMeshComponent, Node);
 			NewComponent = StaticMeshComponent;
 			ReceiveOnStaticMeshComponentCreated(StaticMeshComponent, Node);
+			AddMeshToLoad(StaticMeshComponent, Node);
 		}
 		else
 		{
@@ -101,9 +118,9 @@ void AglTFRuntimeAssetActorAsync::ProcessNode(USceneComponent* NodeParentCompone
 			SkeletalMeshComponent->RegisterComponent();
 			SkeletalMeshComponent->SetRelativeTransform(Node.Transform);
 			AddInstanceComponent(SkeletalMeshComponent);
-			MeshesToLoad.Add(SkeletalMeshComponent, Node);
 			NewComponent = SkeletalMeshComponent;
 			ReceiveOnSkeletalMeshComponentCreated(SkeletalMeshComponent, Node);
+			AddMeshToLoad(SkeletalMeshComponent, Node);
 		}
 	}
 
@@ -151,96 +168,152 @@ void AglTFRuntimeAssetActorAsync::ProcessNode(USceneComponent* NodeParentCompone
 	}
 }
 
-void AglTFRuntimeAssetActorAsync::LoadNextMeshAsync()
+void AglTFRuntimeAssetActorAsync::AddMeshToLoad(UPrimitiveComponent* PrimitiveComponent, const FglTFRuntimeNode& Node)
 {
-	if (MeshesToLoad.Num() == 0)
-	{
-		return;
-	}
+	FglTFRuntimeMeshToLoad MeshToLoad;
+	MeshToLoad.PrimitiveComponent = PrimitiveComponent;
+	MeshToLoad.Node = Node;
 
-	auto It = MeshesToLoad.CreateIterator();
-	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(It->Key))
+	// skeletal meshes always use the actor SkeletalMeshConfig, static ones get the config of each node
+	FglTFRuntimeStaticMeshConfig NodeStaticMeshConfig;
+	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(PrimitiveComponent))
 	{
-		CurrentPrimitiveComponent = StaticMeshComponent;
 		if (StaticMeshConfig.Outer == nullptr)
 		{
 			StaticMeshConfig.Outer = StaticMeshComponent;
 		}
-		FglTFRuntimeStaticMeshAsync Delegate;
-		Delegate.BindDynamic(this, &AglTFRuntimeAssetActorAsync::LoadStaticMeshAsync);
-		Asset->LoadStaticMeshAsync(It->Value.MeshIndex, Delegate, OverrideStaticMeshConfig(It->Value.Index, StaticMeshComponent));
+		NodeStaticMeshConfig = OverrideStaticMeshConfig(Node.Index, StaticMeshComponent);
 	}
-	else if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(It->Key))
+
+	const TTuple<int32, int32> Key(Node.MeshIndex, Node.SkinIndex);
+	const int32* LoadIndex = bShareMeshes ? MeshLoadsMap.Find(Key) : nullptr;
+	if (LoadIndex && FglTFRuntimeStaticMeshConfig::StaticStruct()->CompareScriptStruct(&MeshLoadsStaticMeshConfigs[*LoadIndex], &NodeStaticMeshConfig, PPF_None))
+	{
+		MeshToLoad.LoadIndex = *LoadIndex;
+	}
+	else
 	{
-		CurrentPrimitiveComponent = SkeletalMeshComponent;
-		FglTFRuntimeSkeletalMeshAsync Delegate;
-		Delegate.BindDynamic(this, &AglTFRuntimeAssetActorAsync::LoadSkeletalMeshAsync);
-		Asset->LoadSkeletalMeshAsync(It->Value.MeshIndex, It->Value.SkinIndex, Delegate, SkeletalMeshConfig);
+		FglTFRuntimeMeshLoad MeshLoad;
+		MeshLoad.MeshToLoadIndex = MeshesToLoad.Num();
+		MeshLoad.bLoaded = false;
+		MeshToLoad.LoadIndex = MeshLoads.Add(MeshLoad);
+		MeshLoadsStaticMeshConfigs.Add(NodeStaticMeshConfig);
+		// the first config wins, nodes with a different one get their own build
+		if (bShareMeshes && !LoadIndex)
+		{
+			MeshLoadsMap.Add(Key, MeshToLoad.LoadIndex);
+		}
 	}
+
+	MeshesToLoad.Add(MeshToLoad);
 }
 
-void AglTFRuntimeAssetActorAsync::LoadStaticMeshAsync(UStaticMesh* StaticMesh)
+void AglTFRuntimeAssetActorAsync::LoadNextMeshesAsync()
 {
-	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(CurrentPrimitiveComponent))
+	if (!Asset)
 	{
-		DiscoveredStaticMeshComponents.Add(StaticMeshComponent, StaticMesh);
-		if (bShowWhileLoading)
+		return;
+	}
+
+	while (NextMeshLoad < MeshLoads.Num() && MeshLoadsInFlight < FMath::Max(1, MaxConcurrentMeshes))
+	{
+		const int32 LoadIndex = NextMeshLoad++;
+		const FglTFRuntimeMeshToLoad& MeshToLoad = MeshesToLoad[MeshLoads[LoadIndex].MeshToLoadIndex];
+		MeshLoadsInFlight++;
+
+		if (Cast<UStaticMeshComponent>(MeshToLoad.PrimitiveComponent))
 		{
-			StaticMeshComponent->SetStaticMesh(StaticMesh);
+			FglTFRuntimeNativeStaticMeshAsync Delegate = FglTFRuntimeNativeStaticMeshAsync::CreateWeakLambda(this, [this, LoadIndex](UStaticMesh* StaticMesh)
+				{
+					OnMeshLoaded(StaticMesh, LoadIndex);
+				});
+			LoadHandles[LoadIndex] = Asset->GetParser()->LoadStaticMeshAsync(MeshToLoad.Node.MeshIndex, Delegate, MeshLoadsStaticMeshConfigs[LoadIndex]);
 		}
-
-		if (StaticMesh && !StaticMeshConfig.ExportOriginalPivotToSocket.IsEmpty())
+		else
 		{
-			UStaticMeshSocket* DeltaSocket = StaticMesh->FindSocket(FName(StaticMeshConfig.ExportOriginalPivotToSocket));
-			if (DeltaSocket)
-			{
-				FTransform NewTransform = StaticMeshComponent->GetRelativeTransform();
-				FVector DeltaLocation = -DeltaSocket->RelativeLocation * NewTransform.GetScale3D();
-				DeltaLocation = NewTransform.GetRotation().RotateVector(DeltaLocation);
-				NewTransform.AddToTranslation(DeltaLocation);
-				StaticMeshComponent->SetRelativeTransform(NewTransform);
-			}
+			FglTFRuntimeNativeSkeletalMeshAsync Delegate = FglTFRuntimeNativeSkeletalMeshAsync::CreateWeakLambda(this, [this, LoadIndex](USkeletalMesh* SkeletalMesh)
+				{
+					OnMeshLoaded(SkeletalMesh, LoadIndex);
+				});
+			LoadHandles[LoadIndex] = Asset->GetParser()->LoadSkeletalMeshAsync(MeshToLoad.Node.MeshIndex, MeshToLoad.Node.SkinIndex, Delegate, SkeletalMeshConfig);
 		}
+	}
+}
 
+void AglTFRuntimeAssetActorAsync::OnMeshLoaded(UObject* Mesh, const int32 LoadIndex)
+{
+	// the actor has been torn down while loading
+	if (!LoadHandles.IsValidIndex(LoadIndex))
+	{
+		return;
 	}
 
-	MeshesToLoad.Remove(CurrentPrimitiveComponent);
-	if (MeshesToLoad.Num() > 0)
+	MeshLoadsInFlight--;
+	MeshLoads[LoadIndex].bLoaded = true;
+	LoadHandles[LoadIndex].Reset();
+	LoadedMeshes[LoadIndex] = Mesh;
+
+	// assign in scene order, regardless of the order in which builds complete
+	while (NextMeshToAssign < MeshesToLoad.Num() && MeshLoads[MeshesToLoad[NextMeshToAssign].LoadIndex].bLoaded)
 	{
-		LoadNextMeshAsync();
+		const FglTFRuntimeMeshToLoad& MeshToLoad = MeshesToLoad[NextMeshToAssign++];
+		if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(MeshToLoad.PrimitiveComponent))
+		{
+			AssignStaticMesh(StaticMeshComponent, Cast<UStaticMesh>(LoadedMeshes[MeshToLoad.LoadIndex]));
+		}
+		else if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(MeshToLoad.PrimitiveComponent))
+		{
+			AssignSkeletalMesh(SkeletalMeshComponent, Cast<USkeletalMesh>(LoadedMeshes[MeshToLoad.LoadIndex]));
+		}
+		OnMeshAssigned.Broadcast(MeshToLoad.PrimitiveComponent, LoadedMeshes[MeshToLoad.LoadIndex]);
 	}
-	// trigger event
-	else
+
+	if (NextMeshToAssign < MeshesToLoad.Num())
+	{
+		LoadNextMeshesAsync();
+	}
+	// trigger event (loads completing synchronously could get here more than once)
+	else if (!bScenesLoaded)
 	{
 		ScenesLoaded();
 	}
 }
 
-void AglTFRuntimeAssetActorAsync::LoadSkeletalMeshAsync(USkeletalMesh* SkeletalMesh)
+void AglTFRuntimeAssetActorAsync::AssignStaticMesh(UStaticMeshComponent* StaticMeshComponent, UStaticMesh* StaticMesh)
 {
-	if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(CurrentPrimitiveComponent))
+	DiscoveredStaticMeshComponents.Add(StaticMeshComponent, StaticMesh);
+	if (bShowWhileLoading)
 	{
-		DiscoveredSkeletalMeshComponents.Add(SkeletalMeshComponent, SkeletalMesh);
-		if (bShowWhileLoading)
-		{
-			SkeletalMeshComponent->SetSkeletalMesh(SkeletalMesh);
-		}
+		StaticMeshComponent->SetStaticMesh(StaticMesh);
 	}
 
-	MeshesToLoad.Remove(CurrentPrimitiveComponent);
-	if (MeshesToLoad.Num() > 0)
+	if (StaticMesh && !StaticMeshConfig.ExportOriginalPivotToSocket.IsEmpty())
 	{
-		LoadNextMeshAsync();
+		UStaticMeshSocket* DeltaSocket = StaticMesh->FindSocket(FName(StaticMeshConfig.ExportOriginalPivotToSocket));
+		if (DeltaSocket)
+		{
+			FTransform NewTransform = StaticMeshComponent->GetRelativeTransform();
+			FVector DeltaLocation = -DeltaSocket->RelativeLocation * NewTransform.GetScale3D();
+			DeltaLocation = NewTransform.GetRotation().RotateVector(DeltaLocation);
+			NewTransform.AddToTranslation(DeltaLocation);
+			StaticMeshComponent->SetRelativeTransform(NewTransform);
+		}
 	}
-	// trigger event
-	else
+}
+
+void AglTFRuntimeAssetActorAsync::AssignSkeletalMesh(USkeletalMeshComponent* SkeletalMeshComponent, USkeletalMesh* SkeletalMesh)
+{
+	DiscoveredSkeletalMeshComponents.Add(SkeletalMeshComponent, SkeletalMesh);
+	if (bShowWhileLoading)
 	{
-		ScenesLoaded();
+		SkeletalMeshComponent->SetSkeletalMesh(SkeletalMesh);
 	}
 }
 
 void AglTFRuntimeAssetActorAsync::ScenesLoaded()
 {
+	bScenesLoaded = true;
+
 	if (!bShowWhileLoading)
 	{
 		for (const TPair<UStaticMeshComponent*, UStaticMesh*>& Pair : DiscoveredStaticMeshComponents)
@@ -267,8 +340,9 @@ void AglTFRuntimeAssetActorAsync::ScenesLoaded()
 		}
 	}
 
-	UE_LOG(LogGLTFRuntime, Log, TEXT("Asset loaded asynchronously in %f seconds"), FPlatformTime::Seconds() - LoadingStartTime);
+	UE_LOG(LogGLTFRuntime, Log, TEXT("Asset loaded asynchronously in %f seconds (%d meshes for %d components)"), FPlatformTime::Seconds() - LoadingStartTime, MeshLoads.Num(), MeshesToLoad.Num());
 	ReceiveOnScenesLoaded();
+	OnScenesLoaded.Broadcast();
 }
 
 void AglTFRuntimeAssetActorAsync::ReceiveOnScenesLoaded_Implementation()
@@ -276,6 +350,30 @@ void AglTFRuntimeAssetActorAsync::ReceiveOnScenesLoaded_Implementation()
 
 }
 
+void AglTFRuntimeAssetActorAsync::CancelLoads()
+{
+	for (FglTFRuntimeLoadHandlePtr& LoadHandle : LoadHandles)
+	{
+		if (LoadHandle)
+		{
+			LoadHandle->Cancel();
+		}
+	}
+	LoadHandles.Empty();
+}
+
+void AglTFRuntimeAssetActorAsync::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	CancelLoads();
+	Super::EndPlay(EndPlayReason);
+}
+
+void AglTFRuntimeAssetActorAsync::Destroyed()
+{
+	CancelLoads();
+	Super::Destroyed();
+}
+
 void AglTFRuntimeAssetActorAsync::PostUnregisterAllComponents()
 {
 	if (Asset)
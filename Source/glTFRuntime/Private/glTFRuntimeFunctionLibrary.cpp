@@ -2,6 +2,7 @@
 
 
 #include "glTFRuntimeFunctionLibrary.h"
+#include "glTFRuntimeGameThreadQueue.h"
 #include "Animation/AnimSequence.h"
 #include "Async/Async.h"
 #include "HttpModule.h"
@@ -11,20 +12,293 @@
 #include "Misc/Base64.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/SecureHash.h"
 #include "GenericPlatform/GenericPlatformProcess.h"
 #include "Runtime/Launch/Resources/Version.h"
 
-UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(const FString& Filename, const bool bPathRelativeToContent, const FglTFRuntimeConfig& LoaderConfig)
+namespace glTFRuntime
 {
-	UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
-	if (!Asset)
+	// references the payload of a completed http request, avoiding a copy of the downloaded data
+	class FHttpResponseBytesStorage : public FglTFRuntimeBytesStorage
 	{
-		return nullptr;
+	public:
+		FHttpResponseBytesStorage(FHttpResponsePtr InResponse) : Response(InResponse) {}
+
+		const uint8* GetData() const override { return Response->GetContent().GetData(); }
+		int64 Num() const override { return Response->GetContent().Num(); }
+
+	protected:
+		FHttpResponsePtr Response;
+	};
+
+	UglTFRuntimeAsset* LoadAssetFromHttpResponse(FHttpResponsePtr ResponsePtr, const FglTFRuntimeConfig& LoaderConfig)
+	{
+		UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
+		if (!Asset)
+		{
+			return nullptr;
+		}
+
+		Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
+		Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
+
+		if (!Asset->LoadFromStorage(MakeShared<FHttpResponseBytesStorage, ESPMode::ThreadSafe>(ResponsePtr), LoaderConfig))
+		{
+			return nullptr;
+		}
+
+		return Asset;
 	}
 
-	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
-	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
+	// the download covers the first half of the load progress, a cancelled load stops its request
+	void UpdateHttpLoadHandle(FHttpRequestPtr RequestPtr, const uint64 BytesReceived, FglTFRuntimeLoadHandleRef LoadHandle)
+	{
+		if (LoadHandle->IsCancelled())
+		{
+			RequestPtr->CancelRequest();
+			return;
+		}
+
+		if (RequestPtr->GetResponse().IsValid() && RequestPtr->GetResponse()->GetContentLength() > 0)
+		{
+			LoadHandle->SetProgress(0.5f * FMath::Min<double>(1.0, static_cast<double>(BytesReceived) / RequestPtr->GetResponse()->GetContentLength()));
+		}
+	}
+
+	// LoadParser runs in a worker thread (skipped when the load is cancelled), the asset is wrapped on the game thread
+	UglTFRuntimeLoadHandle* LoadAssetAsync(const FglTFRuntimeConfig& LoaderConfig, TFunction<TSharedPtr<FglTFRuntimeParser>(FglTFRuntimeLoadHandleRef)> LoadParser, const FglTFRuntimeHttpResponse& Completed)
+	{
+		FglTFRuntimeLoadHandleRef LoadHandle = MakeShared<FglTFRuntimeLoadHandle, ESPMode::ThreadSafe>();
+		UglTFRuntimeLoadHandle* BlueprintLoadHandle = UglTFRuntimeLoadHandle::Create(LoadHandle);
+
+		UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
+		if (!Asset)
+		{
+			LoadHandle->Complete();
+			Completed.ExecuteIfBound(nullptr);
+			return BlueprintLoadHandle;
+		}
+
+		Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
+		Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
+
+		Async(EAsyncExecution::Thread, [Asset, LoadParser, Completed, LoadHandle]()
+			{
+				TSharedPtr<FglTFRuntimeParser> Parser = LoadHandle->IsCancelled() ? nullptr : LoadParser(LoadHandle);
+				LoadHandle->SetProgress(0.9f);
+
+				FGraphEventRef Task = FglTFRuntimeGameThreadQueue::Get().Enqueue([Parser, Asset, Completed, LoadHandle]()
+					{
+						LoadHandle->Complete();
+						if (!LoadHandle->IsCancelled() && Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
+						{
+							Completed.ExecuteIfBound(Asset);
+						}
+						else
+						{
+							Completed.ExecuteIfBound(nullptr);
+						}
+					}, LoadHandle);
+				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+			});
+
+		return BlueprintLoadHandle;
+	}
+
+	// process-wide registry of the assets loaded with bShareAsset, entries are weak so unused assets are garbage collected
+	class FSharedAssetsRegistry
+	{
+	public:
+		static FSharedAssetsRegistry& Get()
+		{
+			static FSharedAssetsRegistry Registry;
+			return Registry;
+		}
+
+		static FString GetKey(const FString& Filename, const FglTFRuntimeConfig& LoaderConfig)
+		{
+			const FString TruePath = FPaths::ConvertRelativePathToFull(LoaderConfig.bSearchContentDir ? FPaths::Combine(FPaths::ProjectContentDir(), Filename) : Filename);
+
+			FString ConfigText;
+			FglTFRuntimeConfig::StaticStruct()->ExportText(ConfigText, &LoaderConfig, nullptr, nullptr, PPF_None, nullptr);
+
+			// timestamp and size invalidate the entry when the file changes on disk
+			return FString::Printf(TEXT("%s|%s|%lld|%s"), *TruePath, *IFileManager::Get().GetTimeStamp(*TruePath).ToString(), IFileManager::Get().FileSize(*TruePath), *FMD5::HashAnsiString(*ConfigText));
+		}
+
+		UglTFRuntimeAsset* Find(const FString& Key)
+		{
+			FScopeLock Lock(&AssetsLock);
+			FEntry* Entry = Assets.Find(Key);
+			if (!Entry)
+			{
+				return nullptr;
+			}
+
+			if (!Entry->Asset.IsValid())
+			{
+				Assets.Remove(Key);
+				return nullptr;
+			}
+
+			Entry->LastUse = ++UseCounter;
+			return Entry->Asset.Get();
+		}
+
+		// returns the already registered asset (if still alive) instead of the passed one
+		UglTFRuntimeAsset* Add(const FString& Key, UglTFRuntimeAsset* Asset)
+		{
+			FScopeLock Lock(&AssetsLock);
+			return AddUnlocked(Key, Asset);
+		}
+
+		// returns false when an async load of the same key is already running (Completed will be called by it)
+		bool BeginLoad(const FString& Key, FglTFRuntimeLoadHandleRef LoadHandle, TFunction<void(UglTFRuntimeAsset*)> Completed, TSharedPtr<TPromise<TSharedPtr<FglTFRuntimeParser>>>& OutParserPromise)
+		{
+			FScopeLock Lock(&AssetsLock);
+			if (FPendingLoad* PendingLoad = PendingLoads.Find(Key))
+			{
+				PendingLoad->Waiting.Add({ LoadHandle, MoveTemp(Completed) });
+				return false;
+			}
+
+			FPendingLoad& PendingLoad = PendingLoads.Add(Key);
+			OutParserPromise = MakeShared<TPromise<TSharedPtr<FglTFRuntimeParser>>>();
+			PendingLoad.Parser = OutParserPromise->GetFuture().Share();
+			return true;
+		}
+
+		// gives access to the parser of a running async load, so sync loads of the same key do not parse it again
+		bool FindPendingLoad(const FString& Key, TSharedFuture<TSharedPtr<FglTFRuntimeParser>>& OutParser)
+		{
+			FScopeLock Lock(&AssetsLock);
+			if (FPendingLoad* PendingLoad = PendingLoads.Find(Key))
+			{
+				OutParser = PendingLoad->Parser;
+				return true;
+			}
+			return false;
+		}
+
+		// registers the result of a running async load and completes the loads that were waiting for it
+		// returns the asset the load must complete with (a sync load of the same key could have registered it before)
+		UglTFRuntimeAsset* EndLoad(const FString& Key, UglTFRuntimeAsset* Asset)
+		{
+			FPendingLoad PendingLoad;
+			{
+				FScopeLock Lock(&AssetsLock);
+				if (Asset)
+				{
+					Asset = AddUnlocked(Key, Asset);
+				}
+				PendingLoads.RemoveAndCopyValue(Key, PendingLoad);
+			}
 
+			for (FWaitingLoad& WaitingLoad : PendingLoad.Waiting)
+			{
+				WaitingLoad.LoadHandle->Complete();
+				WaitingLoad.Completed(WaitingLoad.LoadHandle->IsCancelled() ? nullptr : Asset);
+			}
+
+			return Asset;
+		}
+
+		void SetLimit(const int32 MaxAssets)
+		{
+			FScopeLock Lock(&AssetsLock);
+			Limit = FMath::Max(MaxAssets, 0);
+			Evict();
+		}
+
+		void Empty()
+		{
+			FScopeLock Lock(&AssetsLock);
+			Assets.Empty();
+		}
+
+		int32 Num()
+		{
+			FScopeLock Lock(&AssetsLock);
+			Evict();
+			return Assets.Num();
+		}
+
+	protected:
+		UglTFRuntimeAsset* AddUnlocked(const FString& Key, UglTFRuntimeAsset* Asset)
+		{
+			FEntry& Entry = Assets.FindOrAdd(Key);
+			if (!Entry.Asset.IsValid())
+			{
+				Entry.Asset = Asset;
+			}
+			Entry.LastUse = ++UseCounter;
+			UglTFRuntimeAsset* RegisteredAsset = Entry.Asset.Get();
+			Evict();
+			return RegisteredAsset;
+		}
+
+		// drops the garbage collected entries, then the least recently used live ones above the limit
+		// (the registry holds weak references, so an evicted asset is only released when nothing else uses it)
+		void Evict()
+		{
+			for (TMap<FString, FEntry>::TIterator It = Assets.CreateIterator(); It; ++It)
+			{
+				if (!It->Value.Asset.IsValid())
+				{
+					It.RemoveCurrent();
+				}
+			}
+
+			if (Limit <= 0 || Assets.Num() <= Limit)
+			{
+				return;
+			}
+
+			TArray<TPair<uint64, FString>> ByUse;
+			ByUse.Reserve(Assets.Num());
+			for (const TPair<FString, FEntry>& Pair : Assets)
+			{
+				ByUse.Add(TPair<uint64, FString>(Pair.Value.LastUse, Pair.Key));
+			}
+			ByUse.Sort([](const TPair<uint64, FString>& A, const TPair<uint64, FString>& B) { return A.Key < B.Key; });
+
+			const int32 NumToEvict = Assets.Num() - Limit;
+			for (int32 Index = 0; Index < NumToEvict; Index++)
+			{
+				Assets.Remove(ByUse[Index].Value);
+			}
+		}
+
+		struct FEntry
+		{
+			TWeakObjectPtr<UglTFRuntimeAsset> Asset;
+			uint64 LastUse = 0;
+		};
+
+		struct FWaitingLoad
+		{
+			FglTFRuntimeLoadHandleRef LoadHandle;
+			TFunction<void(UglTFRuntimeAsset*)> Completed;
+		};
+
+		struct FPendingLoad
+		{
+			TSharedFuture<TSharedPtr<FglTFRuntimeParser>> Parser;
+			TArray<FWaitingLoad> Waiting;
+		};
+
+		FCriticalSection AssetsLock;
+		TMap<FString, FEntry> Assets;
+		TMap<FString, FPendingLoad> PendingLoads;
+		uint64 UseCounter = 0;
+		// max live entries (0 = unlimited)
+		int32 Limit = 0;
+	};
+}
+
+UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(const FString& Filename, const bool bPathRelativeToContent, const FglTFRuntimeConfig& LoaderConfig)
+{
 	// Annoying copy, but we do not want to remove the const
 	FglTFRuntimeConfig OverrideConfig = LoaderConfig;
 
@@ -33,26 +307,86 @@ UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(const
 		OverrideConfig.bSearchContentDir = true;
 	}
 
-	if (!Asset->LoadFromFilename(Filename, OverrideConfig))
+	FString SharedAssetKey;
+	if (OverrideConfig.bShareAsset)
 	{
-		return nullptr;
+		SharedAssetKey = glTFRuntime::FSharedAssetsRegistry::GetKey(Filename, OverrideConfig);
+		if (UglTFRuntimeAsset* SharedAsset = glTFRuntime::FSharedAssetsRegistry::Get().Find(SharedAssetKey))
+		{
+			return SharedAsset;
+		}
 	}
 
-	return Asset;
-}
-
-void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilenameAsync(const FString& Filename, const bool bPathRelativeToContent, const FglTFRuntimeConfig& LoaderConfig, const FglTFRuntimeHttpResponse& Completed)
-{
 	UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
 	if (!Asset)
 	{
-		Completed.ExecuteIfBound(nullptr);
-		return;
+		return nullptr;
 	}
 
 	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
 	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
 
+	// an async load of the same asset is running, wait for its parser (parsing never needs the game thread)
+	TSharedFuture<TSharedPtr<FglTFRuntimeParser>> PendingParser;
+	if (OverrideConfig.bShareAsset && glTFRuntime::FSharedAssetsRegistry::Get().FindPendingLoad(SharedAssetKey, PendingParser))
+	{
+		TSharedPtr<FglTFRuntimeParser> Parser = PendingParser.Get();
+		if (!Parser.IsValid() || !Asset->SetParser(Parser.ToSharedRef()))
+		{
+			return nullptr;
+		}
+	}
+	else if (!Asset->LoadFromFilename(Filename, OverrideConfig))
+	{
+		return nullptr;
+	}
+
+	if (OverrideConfig.bShareAsset)
+	{
+		return glTFRuntime::FSharedAssetsRegistry::Get().Add(SharedAssetKey, Asset);
+	}
+
+	return Asset;
+}
+
+void UglTFRuntimeFunctionLibrary::glTFReleaseSharedAssets()
+{
+	glTFRuntime::FSharedAssetsRegistry::Get().Empty();
+}
+
+int32 UglTFRuntimeFunctionLibrary::glTFGetSharedAssetsNum()
+{
+	return glTFRuntime::FSharedAssetsRegistry::Get().Num();
+}
+
+void UglTFRuntimeFunctionLibrary::glTFSetSharedAssetsLimit(const int32 MaxAssets)
+{
+	glTFRuntime::FSharedAssetsRegistry::Get().SetLimit(MaxAssets);
+}
+
+void UglTFRuntimeFunctionLibrary::glTFSetGameThreadBudget(const float Milliseconds)
+{
+	FglTFRuntimeGameThreadQueue::Get().SetBudget(Milliseconds);
+}
+
+int32 UglTFRuntimeFunctionLibrary::glTFGetGameThreadQueueNum()
+{
+	return FglTFRuntimeGameThreadQueue::Get().Num();
+}
+
+UglTFRuntimeLoadHandle* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilenameAsync(const FString& Filename, const bool bPathRelativeToContent, const FglTFRuntimeConfig& LoaderConfig, const FglTFRuntimeHttpResponse& Completed)
+{
+	return glTFLoadAssetFromFilenameAsyncWithCallback(Filename, bPathRelativeToContent, LoaderConfig, [Completed](UglTFRuntimeAsset* Asset)
+		{
+			Completed.ExecuteIfBound(Asset);
+		});
+}
+
+UglTFRuntimeLoadHandle* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilenameAsyncWithCallback(const FString& Filename, const bool bPathRelativeToContent, const FglTFRuntimeConfig& LoaderConfig, TFunction<void(UglTFRuntimeAsset*)> Completed)
+{
+	FglTFRuntimeLoadHandleRef LoadHandle = MakeShared<FglTFRuntimeLoadHandle, ESPMode::ThreadSafe>();
+	UglTFRuntimeLoadHandle* BlueprintLoadHandle = UglTFRuntimeLoadHandle::Create(LoadHandle);
+
 	// Annoying copy, but we do not want to remove the const
 	FglTFRuntimeConfig OverrideConfig = LoaderConfig;
 
@@ -61,23 +395,70 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilenameAsync(const FString&
 		OverrideConfig.bSearchContentDir = true;
 	}
 
-	Async(EAsyncExecution::Thread, [Filename, Asset, Completed, OverrideConfig]()
+	FString SharedAssetKey;
+	TSharedPtr<TPromise<TSharedPtr<FglTFRuntimeParser>>> ParserPromise;
+	if (OverrideConfig.bShareAsset)
+	{
+		SharedAssetKey = glTFRuntime::FSharedAssetsRegistry::GetKey(Filename, OverrideConfig);
+		if (UglTFRuntimeAsset* SharedAsset = glTFRuntime::FSharedAssetsRegistry::Get().Find(SharedAssetKey))
 		{
-			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromFilename(Filename, OverrideConfig);
+			LoadHandle->Complete();
+			Completed(SharedAsset);
+			return BlueprintLoadHandle;
+		}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
+		// concurrent loads of the same asset wait for the first one
+		if (!glTFRuntime::FSharedAssetsRegistry::Get().BeginLoad(SharedAssetKey, LoadHandle, Completed, ParserPromise))
+		{
+			return BlueprintLoadHandle;
+		}
+	}
+
+	UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
+	if (!Asset)
+	{
+		if (!SharedAssetKey.IsEmpty())
+		{
+			ParserPromise->SetValue(nullptr);
+			glTFRuntime::FSharedAssetsRegistry::Get().EndLoad(SharedAssetKey, nullptr);
+		}
+		LoadHandle->Complete();
+		Completed(nullptr);
+		return BlueprintLoadHandle;
+	}
+
+	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
+	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
+
+	Async(EAsyncExecution::Thread, [Filename, Asset, Completed, OverrideConfig, SharedAssetKey, ParserPromise, LoadHandle]()
+		{
+			// a shared load keeps going when cancelled, as other loads may be waiting for it
+			TSharedPtr<FglTFRuntimeParser> Parser = LoadHandle->IsCancelled() && SharedAssetKey.IsEmpty() ? nullptr : FglTFRuntimeParser::FromFilename(Filename, OverrideConfig);
+			if (ParserPromise)
+			{
+				ParserPromise->SetValue(Parser);
+			}
+			LoadHandle->SetProgress(0.9f);
+
+			FGraphEventRef Task = FglTFRuntimeGameThreadQueue::Get().Enqueue([Parser, Asset, Completed, SharedAssetKey, LoadHandle]()
 				{
-					if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
+					LoadHandle->Complete();
+					// a sync load of the same asset could have already wrapped the parser
+					UglTFRuntimeAsset* LoadedAsset = SharedAssetKey.IsEmpty() ? nullptr : glTFRuntime::FSharedAssetsRegistry::Get().Find(SharedAssetKey);
+					if (!LoadedAsset && Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
 					{
-						Completed.ExecuteIfBound(Asset);
+						LoadedAsset = Asset;
 					}
-					else
+					if (!SharedAssetKey.IsEmpty())
 					{
-						Completed.ExecuteIfBound(nullptr);
+						LoadedAsset = glTFRuntime::FSharedAssetsRegistry::Get().EndLoad(SharedAssetKey, LoadedAsset);
 					}
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
+					Completed(LoadedAsset && !LoadHandle->IsCancelled() ? LoadedAsset : nullptr);
+				}, LoadHandle);
 			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 		});
+
+	return BlueprintLoadHandle;
 }
 
 UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromString(const FString& JsonData, const FglTFRuntimeConfig& LoaderConfig)
@@ -125,47 +506,19 @@ UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromBase64(const FS
 	return Asset;
 }
 
-void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromBase64Async(const FString& Base64, const FglTFRuntimeConfig& LoaderConfig, const FglTFRuntimeHttpResponse& Completed)
+UglTFRuntimeLoadHandle* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromBase64Async(const FString& Base64, const FglTFRuntimeConfig& LoaderConfig, const FglTFRuntimeHttpResponse& Completed)
 {
-	UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
-	if (!Asset)
-	{
-		Completed.ExecuteIfBound(nullptr);
-		return;
-	}
-
-	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
-	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
-
-	Async(EAsyncExecution::Thread, [Base64, Asset, LoaderConfig, Completed]()
+	return glTFRuntime::LoadAssetAsync(LoaderConfig, [Base64, LoaderConfig](FglTFRuntimeLoadHandleRef LoadHandle) -> TSharedPtr<FglTFRuntimeParser>
 		{
 			TArray<uint8> BytesBase64;
 
 			if (!FBase64::Decode(Base64, BytesBase64))
 			{
-				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
-					{
-						Completed.ExecuteIfBound(nullptr);
-					}, TStatId(), nullptr, ENamedThreads::GameThread);
-				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-				return;
+				return nullptr;
 			}
 
-			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromData(BytesBase64, LoaderConfig);
-
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
-				{
-					if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
-					{
-						Completed.ExecuteIfBound(Asset);
-					}
-					else
-					{
-						Completed.ExecuteIfBound(nullptr);
-					}
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		});
+			return FglTFRuntimeParser::FromData(BytesBase64, LoaderConfig);
+		}, Completed);
 }
 
 UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUTF8String(const FString& String, const FglTFRuntimeConfig& LoaderConfig)
@@ -193,19 +546,9 @@ UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUTF8String(cons
 	return Asset;
 }
 
-void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUTF8StringAsync(const FString& String, const FglTFRuntimeConfig& LoaderConfig, const FglTFRuntimeHttpResponse& Completed)
+UglTFRuntimeLoadHandle* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUTF8StringAsync(const FString& String, const FglTFRuntimeConfig& LoaderConfig, const FglTFRuntimeHttpResponse& Completed)
 {
-	UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
-	if (!Asset)
-	{
-		Completed.ExecuteIfBound(nullptr);
-		return;
-	}
-
-	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
-	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
-
-	Async(EAsyncExecution::Thread, [String, Asset, LoaderConfig, Completed]()
+	return glTFRuntime::LoadAssetAsync(LoaderConfig, [String, LoaderConfig](FglTFRuntimeLoadHandleRef LoadHandle)
 		{
 #if ENGINE_MAJOR_VERSION >= 5
 			auto UTF8String = StringCast<UTF8CHAR>(*String);
@@ -213,52 +556,16 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUTF8StringAsync(const FString
 			FTCHARToUTF8 UTF8String(*String);
 #endif
 
-			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromData(reinterpret_cast<const uint8*>(UTF8String.Get()), UTF8String.Length(), LoaderConfig);
-
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
-				{
-					if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
-					{
-						Completed.ExecuteIfBound(Asset);
-					}
-					else
-					{
-						Completed.ExecuteIfBound(nullptr);
-					}
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		});
+			return FglTFRuntimeParser::FromData(reinterpret_cast<const uint8*>(UTF8String.Get()), UTF8String.Length(), LoaderConfig);
+		}, Completed);
 }
 
-void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromStringAsync(const FString& JsonData, const FglTFRuntimeConfig& LoaderConfig, const FglTFRuntimeHttpResponse& Completed)
+UglTFRuntimeLoadHandle* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromStringAsync(const FString& JsonData, const FglTFRuntimeConfig& LoaderConfig, const FglTFRuntimeHttpResponse& Completed)
 {
-	UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
-	if (!Asset)
-	{
-		Completed.ExecuteIfBound(nullptr);
-		return;
-	}
-
-	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
-	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
-
-	Async(EAsyncExecution::Thread, [JsonData, Asset, LoaderConfig, Completed]()
+	return glTFRuntime::LoadAssetAsync(LoaderConfig, [JsonData, LoaderConfig](FglTFRuntimeLoadHandleRef LoadHandle)
 		{
-			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromString(JsonData, LoaderConfig);
-
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
-				{
-					if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
-					{
-						Completed.ExecuteIfBound(Asset);
-					}
-					else
-					{
-						Completed.ExecuteIfBound(nullptr);
-					}
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		});
+			return FglTFRuntimeParser::FromString(JsonData, LoaderConfig);
+		}, Completed);
 }
 
 UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFileMap(const TMap<FString, FString>& FileMap, const FglTFRuntimeConfig& LoaderConfig)
@@ -293,50 +600,36 @@ UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFileMap(const T
 	return nullptr;
 }
 
-void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFileMapAsync(const TMap<FString, FString>& FileMap, const FglTFRuntimeConfig& LoaderConfig, const FglTFRuntimeHttpResponse& Completed)
+UglTFRuntimeLoadHandle* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFileMapAsync(const TMap<FString, FString>& FileMap, const FglTFRuntimeConfig& LoaderConfig, const FglTFRuntimeHttpResponse& Completed)
 {
-	UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
-	if (!Asset)
-	{
-		Completed.ExecuteIfBound(nullptr);
-		return;
-	}
-
-	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
-	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
-
-	Async(EAsyncExecution::Thread, [FileMap, Asset, LoaderConfig, Completed]()
+	return glTFRuntime::LoadAssetAsync(LoaderConfig, [FileMap, LoaderConfig](FglTFRuntimeLoadHandleRef LoadHandle) -> TSharedPtr<FglTFRuntimeParser>
 		{
 			TMap<FString, TArray64<uint8>> Map;
+			int32 FileIndex = 0;
 
 			for (const TPair<FString, FString>& Pair : FileMap)
 			{
+				if (LoadHandle->IsCancelled())
+				{
+					return nullptr;
+				}
+
 				TArray64<uint8> Data;
 				if (FFileHelper::LoadFileToArray(Data, *Pair.Value))
 				{
 					Map.Add(Pair.Key, MoveTemp(Data));
 				}
+				LoadHandle->SetStageProgress(0, 0.5f, ++FileIndex, FileMap.Num());
 			}
 
-			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromMap(Map, LoaderConfig);
-
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
-				{
-					if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
-					{
-						Completed.ExecuteIfBound(Asset);
-					}
-					else
-					{
-						Completed.ExecuteIfBound(nullptr);
-					}
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		});
+			return FglTFRuntimeParser::FromMap(Map, LoaderConfig);
+		}, Completed);
 }
 
-void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrl(const FString& Url, const TMap<FString, FString>& Headers, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig)
+UglTFRuntimeLoadHandle* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrl(const FString& Url, const TMap<FString, FString>& Headers, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig)
 {
+	FglTFRuntimeLoadHandleRef LoadHandle = MakeShared<FglTFRuntimeLoadHandle, ESPMode::ThreadSafe>();
+
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 25
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
 #else
@@ -350,25 +643,39 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrl(const FString& Url, const
 
 	float StartTime = FPlatformTime::Seconds();
 
-	HttpRequest->OnProcessRequestComplete().BindLambda([StartTime](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig)
+	HttpRequest->OnProcessRequestComplete().BindLambda([StartTime, LoadHandle](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig)
 		{
 			UglTFRuntimeAsset* Asset = nullptr;
-			if (bSuccess && !IsGarbageCollecting())
+			if (bSuccess && !LoadHandle->IsCancelled() && !IsGarbageCollecting())
 			{
-				Asset = glTFLoadAssetFromData(ResponsePtr->GetContent(), LoaderConfig);
+				Asset = glTFRuntime::LoadAssetFromHttpResponse(ResponsePtr, LoaderConfig);
 				if (Asset)
 				{
 					Asset->GetParser()->SetDownloadTime(FPlatformTime::Seconds() - StartTime);
 				}
 			}
+			LoadHandle->Complete();
 			Completed.ExecuteIfBound(Asset);
 		}, Completed, LoaderConfig);
 
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4
+	HttpRequest->OnRequestProgress64().BindLambda([LoadHandle](FHttpRequestPtr RequestPtr, uint64 BytesSent, uint64 BytesReceived)
+#else
+	HttpRequest->OnRequestProgress().BindLambda([LoadHandle](FHttpRequestPtr RequestPtr, int32 BytesSent, int32 BytesReceived)
+#endif
+		{
+			glTFRuntime::UpdateHttpLoadHandle(RequestPtr, BytesReceived, LoadHandle);
+		});
+
 	HttpRequest->ProcessRequest();
+
+	return UglTFRuntimeLoadHandle::Create(LoadHandle);
 }
 
-void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithCache(const FString& Url, const FString& CacheFilename, const TMap<FString, FString>& Headers, const bool bUseCacheOnError, const FglTFRuntimeHttpResponse& Completed, const FglTFRuntimeConfig& LoaderConfig)
+UglTFRuntimeLoadHandle* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithCache(const FString& Url, const FString& CacheFilename, const TMap<FString, FString>& Headers, const bool bUseCacheOnError, const FglTFRuntimeHttpResponse& Completed, const FglTFRuntimeConfig& LoaderConfig)
 {
+	FglTFRuntimeLoadHandleRef LoadHandle = MakeShared<FglTFRuntimeLoadHandle, ESPMode::ThreadSafe>();
+
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 25
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
 #else
@@ -393,10 +700,10 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithCache(const FString& U
 
 	float StartTime = FPlatformTime::Seconds();
 
-	HttpRequest->OnProcessRequestComplete().BindLambda([StartTime, bCacheFileValid, bUseCacheOnError](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig, const FString& CacheFilename)
+	HttpRequest->OnProcessRequestComplete().BindLambda([StartTime, bCacheFileValid, bUseCacheOnError, LoadHandle](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig, const FString& CacheFilename)
 		{
 			UglTFRuntimeAsset* Asset = nullptr;
-			if (!IsGarbageCollecting())
+			if (!LoadHandle->IsCancelled() && !IsGarbageCollecting())
 			{
 				if (bSuccess)
 				{
@@ -410,7 +717,7 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithCache(const FString& U
 						{
 							FFileHelper::SaveArrayToFile(ResponsePtr->GetContent(), *CacheFilename);
 						}
-						Asset = glTFLoadAssetFromData(ResponsePtr->GetContent(), LoaderConfig);
+						Asset = glTFRuntime::LoadAssetFromHttpResponse(ResponsePtr, LoaderConfig);
 					}
 				}
 				else if (bCacheFileValid && bUseCacheOnError)
@@ -423,14 +730,28 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithCache(const FString& U
 					Asset->GetParser()->SetDownloadTime(FPlatformTime::Seconds() - StartTime);
 				}
 			}
+			LoadHandle->Complete();
 			Completed.ExecuteIfBound(Asset);
 		}, Completed, LoaderConfig, CacheFilename);
 
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4
+	HttpRequest->OnRequestProgress64().BindLambda([LoadHandle](FHttpRequestPtr RequestPtr, uint64 BytesSent, uint64 BytesReceived)
+#else
+	HttpRequest->OnRequestProgress().BindLambda([LoadHandle](FHttpRequestPtr RequestPtr, int32 BytesSent, int32 BytesReceived)
+#endif
+		{
+			glTFRuntime::UpdateHttpLoadHandle(RequestPtr, BytesReceived, LoadHandle);
+		});
+
 	HttpRequest->ProcessRequest();
+
+	return UglTFRuntimeLoadHandle::Create(LoadHandle);
 }
 
-void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithProgress(const FString& Url, const TMap<FString, FString>& Headers, FglTFRuntimeHttpResponse Completed, FglTFRuntimeHttpProgress Progress, const FglTFRuntimeConfig& LoaderConfig)
+UglTFRuntimeLoadHandle* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithProgress(const FString& Url, const TMap<FString, FString>& Headers, FglTFRuntimeHttpResponse Completed, FglTFRuntimeHttpProgress Progress, const FglTFRuntimeConfig& LoaderConfig)
 {
+	FglTFRuntimeLoadHandleRef LoadHandle = MakeShared<FglTFRuntimeLoadHandle, ESPMode::ThreadSafe>();
+
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 25
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
 #else
@@ -444,26 +765,28 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithProgress(const FString
 
 	float StartTime = FPlatformTime::Seconds();
 
-	HttpRequest->OnProcessRequestComplete().BindLambda([StartTime](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig)
+	HttpRequest->OnProcessRequestComplete().BindLambda([StartTime, LoadHandle](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig)
 		{
 			UglTFRuntimeAsset* Asset = nullptr;
-			if (bSuccess && !IsGarbageCollecting())
+			if (bSuccess && !LoadHandle->IsCancelled() && !IsGarbageCollecting())
 			{
-				Asset = glTFLoadAssetFromData(ResponsePtr->GetContent(), LoaderConfig);
+				Asset = glTFRuntime::LoadAssetFromHttpResponse(ResponsePtr, LoaderConfig);
 				if (Asset)
 				{
 					Asset->GetParser()->SetDownloadTime(FPlatformTime::Seconds() - StartTime);
 				}
 			}
+			LoadHandle->Complete();
 			Completed.ExecuteIfBound(Asset);
 		}, Completed, LoaderConfig);
 
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4
-	HttpRequest->OnRequestProgress64().BindLambda([](FHttpRequestPtr RequestPtr, uint64 BytesSent, uint64 BytesReceived, FglTFRuntimeHttpProgress Progress, const FglTFRuntimeConfig& LoaderConfig)
+	HttpRequest->OnRequestProgress64().BindLambda([LoadHandle](FHttpRequestPtr RequestPtr, uint64 BytesSent, uint64 BytesReceived, FglTFRuntimeHttpProgress Progress, const FglTFRuntimeConfig& LoaderConfig)
 #else
-	HttpRequest->OnRequestProgress().BindLambda([](FHttpRequestPtr RequestPtr, int32 BytesSent, int32 BytesReceived, FglTFRuntimeHttpProgress Progress, const FglTFRuntimeConfig& LoaderConfig)
+	HttpRequest->OnRequestProgress().BindLambda([LoadHandle](FHttpRequestPtr RequestPtr, int32 BytesSent, int32 BytesReceived, FglTFRuntimeHttpProgress Progress, const FglTFRuntimeConfig& LoaderConfig)
 #endif
 		{
+			glTFRuntime::UpdateHttpLoadHandle(RequestPtr, BytesReceived, LoadHandle);
 			int32 ContentLength = 0;
 			if (RequestPtr->GetResponse().IsValid())
 			{
@@ -473,6 +796,8 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithProgress(const FString
 		}, Progress, LoaderConfig);
 
 	HttpRequest->ProcessRequest();
+
+	return UglTFRuntimeLoadHandle::Create(LoadHandle);
 }
 
 UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromData(const TArray<uint8>& Data, const FglTFRuntimeConfig& LoaderConfig)
@@ -582,9 +907,11 @@ bool UglTFRuntimeFunctionLibrary::GetPositionsAsBytesFromglTFRuntimeLODPrimitive
 	}
 
 	const FglTFRuntimePrimitive& Primitive = RuntimeLOD.Primitives[PrimitiveIndex];
-	Bytes.Reserve(Primitive.Positions.Num() * sizeof(float) * 3);
-	for (const FVector& Position : Primitive.Positions)
+	Bytes.Reserve(Primitive.NumVertices() * sizeof(float) * 3);
+	bool bMissing = false;
+	for (int32 VertexIndex = 0; VertexIndex < Primitive.NumVertices(); VertexIndex++)
 	{
+		const FVector Position = Primitive.GetPosition(VertexIndex, bMissing);
 		float X = static_cast<float>(Position.X);
 		float Y = static_cast<float>(Position.Y);
 		float Z = static_cast<float>(Position.Z);
@@ -603,9 +930,11 @@ bool UglTFRuntimeFunctionLibrary::GetNormalsAsBytesFromglTFRuntimeLODPrimitive(c
 	}
 
 	const FglTFRuntimePrimitive& Primitive = RuntimeLOD.Primitives[PrimitiveIndex];
-	Bytes.Reserve(Primitive.Positions.Num() * sizeof(float) * 3);
-	for (const FVector& Normal : Primitive.Normals)
+	Bytes.Reserve(Primitive.NumNormals() * sizeof(float) * 3);
+	bool bMissing = false;
+	for (int32 VertexIndex = 0; VertexIndex < Primitive.NumNormals(); VertexIndex++)
 	{
+		const FVector Normal = Primitive.GetNormal(VertexIndex, bMissing);
 		float X = static_cast<float>(Normal.X);
 		float Y = static_cast<float>(Normal.Y);
 		float Z = static_cast<float>(Normal.Z);
@@ -723,8 +1052,8 @@ FglTFRuntimeMeshLOD UglTFRuntimeFunctionLibrary::glTFMergeRuntimeLODsWithSkeleto
 					// fix joints and weights
 					NewPrimitive.Joints.AddDefaulted();
 					NewPrimitive.Weights.AddDefaulted();
-					NewPrimitive.Joints[0].AddUninitialized(NewPrimitive.Positions.Num());
-					NewPrimitive.Weights[0].AddUninitialized(NewPrimitive.Positions.Num());
+					NewPrimitive.Joints[0].AddUninitialized(NewPrimitive.NumVertices());
+					NewPrimitive.Weights[0].AddUninitialized(NewPrimitive.NumVertices());
 					for (int32 VertexIndex = 0; VertexIndex < NewPrimitive.Joints[0].Num(); VertexIndex++)
 					{
 						NewPrimitive.Joints[0][VertexIndex].X = NewBoneIndex;
@@ -746,19 +1075,23 @@ FglTFRuntimeMeshLOD UglTFRuntimeFunctionLibrary::glTFMergeRuntimeLODsWithSkeleto
 	return NewRuntimeLOD;
 }
 
-void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromCommand(const FString& Command, const FString& Arguments, const FString& WorkingDirectory, const FglTFRuntimeCommandResponse& Completed, const FglTFRuntimeConfig& LoaderConfig, const int32 ExpectedExitCode)
+UglTFRuntimeLoadHandle* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromCommand(const FString& Command, const FString& Arguments, const FString& WorkingDirectory, const FglTFRuntimeCommandResponse& Completed, const FglTFRuntimeConfig& LoaderConfig, const int32 ExpectedExitCode)
 {
+	FglTFRuntimeLoadHandleRef LoadHandle = MakeShared<FglTFRuntimeLoadHandle, ESPMode::ThreadSafe>();
+	UglTFRuntimeLoadHandle* BlueprintLoadHandle = UglTFRuntimeLoadHandle::Create(LoadHandle);
+
 	UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
 	if (!Asset)
 	{
+		LoadHandle->Complete();
 		Completed.ExecuteIfBound(nullptr, -1, "");
-		return;
+		return BlueprintLoadHandle;
 	}
 
 	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
 	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
 
-	Async(EAsyncExecution::Thread, [Command, Arguments, WorkingDirectory, Asset, LoaderConfig, Completed, ExpectedExitCode]()
+	Async(EAsyncExecution::Thread, [Command, Arguments, WorkingDirectory, Asset, LoaderConfig, Completed, ExpectedExitCode, LoadHandle]()
 		{
 			TArray<uint8> Bytes;
 
@@ -767,8 +1100,9 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromCommand(const FString& Comman
 
 			if (!FPlatformProcess::CreatePipe(ReadPipe, WritePipe))
 			{
-				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
+				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Completed, LoadHandle]()
 					{
+						LoadHandle->Complete();
 						Completed.ExecuteIfBound(nullptr, -1, "Unable to create process pipe");
 					}, TStatId(), nullptr, ENamedThreads::GameThread);
 				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
@@ -790,8 +1124,9 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromCommand(const FString& Comman
 			if (!ProcHandle.IsValid())
 			{
 				FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
-				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Completed]()
+				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Completed, LoadHandle]()
 					{
+						LoadHandle->Complete();
 						Completed.ExecuteIfBound(nullptr, -1, "Unable to launch process");
 					}, TStatId(), nullptr, ENamedThreads::GameThread);
 				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
@@ -800,6 +1135,11 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromCommand(const FString& Comman
 
 			while (FPlatformProcess::IsProcRunning(ProcHandle))
 			{
+				if (LoadHandle->IsCancelled())
+				{
+					FPlatformProcess::TerminateProc(ProcHandle);
+					break;
+				}
 				TArray<uint8> PipeChunk;
 				if (FPlatformProcess::ReadPipeToArray(ReadPipe, PipeChunk))
 				{
@@ -815,8 +1155,9 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromCommand(const FString& Comman
 
 			if (ReturnCode != ExpectedExitCode)
 			{
-				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Completed, ReturnCode, &Bytes]()
+				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Completed, ReturnCode, &Bytes, LoadHandle]()
 					{
+						LoadHandle->Complete();
 						FString StdErr;
 						FFileHelper::BufferToString(StdErr, Bytes.GetData(), Bytes.Num());
 						Completed.ExecuteIfBound(nullptr, ReturnCode, StdErr);
@@ -825,15 +1166,17 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromCommand(const FString& Comman
 				return;
 			}
 
-			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromData(Bytes, LoaderConfig);
-			if (!WorkingDirectory.IsEmpty())
+			TSharedPtr<FglTFRuntimeParser> Parser = LoadHandle->IsCancelled() ? nullptr : FglTFRuntimeParser::FromData(Bytes, LoaderConfig);
+			if (Parser && !WorkingDirectory.IsEmpty())
 			{
 				Parser->SetBaseDirectory(WorkingDirectory);
 			}
+			LoadHandle->SetProgress(0.9f);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed, ReturnCode]()
+			FGraphEventRef Task = FglTFRuntimeGameThreadQueue::Get().Enqueue([Parser, Asset, Completed, ReturnCode, LoadHandle]()
 				{
-					if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
+					LoadHandle->Complete();
+					if (!LoadHandle->IsCancelled() && Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
 					{
 						Completed.ExecuteIfBound(Asset, ReturnCode, "");
 					}
@@ -841,10 +1184,11 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromCommand(const FString& Comman
 					{
 						Completed.ExecuteIfBound(nullptr, ReturnCode, "Unable to parse command output");
 					}
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
+				}, LoadHandle);
 			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 		});
 
+	return BlueprintLoadHandle;
 }
 
 UBlendSpace1D* UglTFRuntimeFunctionLibrary::CreateRuntimeBlendSpace1D(const FString& ParameterName, const float Min, const float Max, const TArray<FglTFRuntimeBlendSpaceSample>& Samples)
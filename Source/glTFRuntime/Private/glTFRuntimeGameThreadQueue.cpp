@@ -0,0 +1,166 @@
+// Copyright 2026 - Roberto De Ioris
+
+#include "glTFRuntimeGameThreadQueue.h"
+
+std::atomic<uint32> FglTFRuntimeLoadHandle::PriorityGeneration{ 0 };
+
+FglTFRuntimeGameThreadQueue& FglTFRuntimeGameThreadQueue::Get()
+{
+	static FglTFRuntimeGameThreadQueue Singleton;
+	return Singleton;
+}
+
+FGraphEventRef FglTFRuntimeGameThreadQueue::Enqueue(TFunction<void()> Work, const int32 Priority)
+{
+	return Enqueue(MoveTemp(Work), Priority, nullptr);
+}
+
+FGraphEventRef FglTFRuntimeGameThreadQueue::Enqueue(TFunction<void()> Work, FglTFRuntimeLoadHandleRef LoadHandle)
+{
+	return Enqueue(MoveTemp(Work), 0, LoadHandle);
+}
+
+FGraphEventRef FglTFRuntimeGameThreadQueue::Enqueue(TFunction<void()> Work, const int32 Priority, FglTFRuntimeLoadHandlePtr LoadHandle)
+{
+	{
+		FScopeLock Lock(&QueueLock);
+		if (BudgetMilliseconds > 0 && TickerHandle.IsValid())
+		{
+			FglTFRuntimeGameThreadWork Item;
+			Item.Work = MoveTemp(Work);
+			Item.Event = FGraphEvent::CreateGraphEvent();
+			Item.Priority = Priority;
+			Item.LoadHandle = LoadHandle;
+			Item.Serial = NextSerial++;
+			Item.HeapPriority = Item.GetPriority();
+			FGraphEventRef Event = Item.Event;
+			Queue.HeapPush(MoveTemp(Item));
+			return Event;
+		}
+	}
+
+	return FFunctionGraphTask::CreateAndDispatchWhenReady(MoveTemp(Work), TStatId(), nullptr, ENamedThreads::GameThread);
+}
+
+void FglTFRuntimeGameThreadQueue::SetBudget(const float Milliseconds)
+{
+	FScopeLock Lock(&QueueLock);
+	BudgetMilliseconds = FMath::Max(0.0f, Milliseconds);
+}
+
+float FglTFRuntimeGameThreadQueue::GetBudget() const
+{
+	FScopeLock Lock(&QueueLock);
+	return BudgetMilliseconds;
+}
+
+int32 FglTFRuntimeGameThreadQueue::Num() const
+{
+	FScopeLock Lock(&QueueLock);
+	return Queue.Num();
+}
+
+void FglTFRuntimeGameThreadQueue::Startup()
+{
+	FScopeLock Lock(&QueueLock);
+#if ENGINE_MAJOR_VERSION > 4
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FglTFRuntimeGameThreadQueue::Tick));
+#else
+	TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FglTFRuntimeGameThreadQueue::Tick));
+#endif
+}
+
+void FglTFRuntimeGameThreadQueue::Shutdown()
+{
+	{
+		FScopeLock Lock(&QueueLock);
+		if (!TickerHandle.IsValid())
+		{
+			return;
+		}
+#if ENGINE_MAJOR_VERSION > 4
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#endif
+		TickerHandle.Reset();
+	}
+
+	// async loads may still be waiting for their items
+	Flush();
+}
+
+bool FglTFRuntimeGameThreadQueue::Tick(float DeltaTime)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	bool bItemRun = false;
+
+	for (;;)
+	{
+		FglTFRuntimeGameThreadWork Item;
+		{
+			FScopeLock Lock(&QueueLock);
+			// the budget may have been disabled while items were queued
+			if (bItemRun && BudgetMilliseconds > 0 && (FPlatformTime::Seconds() - StartTime) * 1000.0 >= BudgetMilliseconds)
+			{
+				break;
+			}
+			if (!Pop(Item))
+			{
+				break;
+			}
+		}
+
+		Run(Item);
+		bItemRun = true;
+	}
+
+	return true;
+}
+
+bool FglTFRuntimeGameThreadQueue::Pop(FglTFRuntimeGameThreadWork& Item)
+{
+	if (Queue.Num() == 0)
+	{
+		return false;
+	}
+
+	// priorities can change while waiting, refresh the snapshots and rebuild the heap only when needed
+	const uint32 PriorityGeneration = FglTFRuntimeLoadHandle::GetPriorityGeneration();
+	if (PriorityGeneration != QueuePriorityGeneration)
+	{
+		for (FglTFRuntimeGameThreadWork& QueuedItem : Queue)
+		{
+			QueuedItem.HeapPriority = QueuedItem.GetPriority();
+		}
+		Queue.Heapify();
+		QueuePriorityGeneration = PriorityGeneration;
+	}
+
+	Queue.HeapPop(Item, EAllowShrinking::No);
+	return true;
+}
+
+void FglTFRuntimeGameThreadQueue::Run(FglTFRuntimeGameThreadWork& Item)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeGameThreadQueue_Run, FColor::Magenta);
+	Item.Work();
+	Item.Event->DispatchSubsequents();
+}
+
+void FglTFRuntimeGameThreadQueue::Flush()
+{
+	for (;;)
+	{
+		FglTFRuntimeGameThreadWork Item;
+		{
+			FScopeLock Lock(&QueueLock);
+			if (!Pop(Item))
+			{
+				break;
+			}
+		}
+
+		Run(Item);
+	}
+}
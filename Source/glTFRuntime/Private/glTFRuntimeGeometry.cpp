@@ -0,0 +1,1557 @@
+// Copyright 2026 - Roberto De Ioris
+
+#include "glTFRuntimeParser.h"
+#include "Algo/Sort.h"
+
+namespace glTFRuntime
+{
+	namespace Geometry
+	{
+		// values per ParallelFor task for the linear passes
+		constexpr int32 BlockSize = 4096;
+
+		// angle between two edges of a triangle in radians (used as a weight)
+		FORCEINLINE float CornerAngle(const FVector& Edge0, const FVector& Edge1)
+		{
+			const float Length = static_cast<float>(FMath::Sqrt(Edge0.SizeSquared() * Edge1.SizeSquared()));
+			if (Length <= SMALL_NUMBER)
+			{
+				return 0;
+			}
+			return FMath::Acos(FMath::Clamp(static_cast<float>(FVector::DotProduct(Edge0, Edge1)) / Length, -1.0f, 1.0f));
+		}
+
+		// grid cell of a position (or its exact float bits with a 0 tolerance)
+		struct FWeldKey
+		{
+			int64 X;
+			int64 Y;
+			int64 Z;
+
+			bool operator==(const FWeldKey& Other) const
+			{
+				return X == Other.X && Y == Other.Y && Z == Other.Z;
+			}
+
+			bool operator!=(const FWeldKey& Other) const
+			{
+				return !(*this == Other);
+			}
+
+			bool operator<(const FWeldKey& Other) const
+			{
+				if (X != Other.X)
+				{
+					return X < Other.X;
+				}
+				if (Y != Other.Y)
+				{
+					return Y < Other.Y;
+				}
+				return Z < Other.Z;
+			}
+		};
+
+		// tiny tolerances (or huge coordinates) would overflow the cells, so they are clamped (NaNs go to the lowest one)
+		FORCEINLINE int64 QuantizeWeldComponent(const double Value, const double Tolerance)
+		{
+			constexpr double MaxCell = 4611686018427387904.0; // 2^62
+			const double Cell = FMath::FloorToDouble(Value / Tolerance);
+			if (!(Cell > -MaxCell))
+			{
+				return -static_cast<int64>(MaxCell);
+			}
+			return Cell < MaxCell ? static_cast<int64>(Cell) : static_cast<int64>(MaxCell);
+		}
+
+		FORCEINLINE FWeldKey MakeWeldKey(const FVector& Position, const float Tolerance)
+		{
+			if (Tolerance > 0)
+			{
+				return { QuantizeWeldComponent(Position.X, Tolerance), QuantizeWeldComponent(Position.Y, Tolerance), QuantizeWeldComponent(Position.Z, Tolerance) };
+			}
+
+			const float Components[3] = { static_cast<float>(Position.X), static_cast<float>(Position.Y), static_cast<float>(Position.Z) };
+			uint32 Bits[3];
+			FMemory::Memcpy(Bits, Components, sizeof(Bits));
+			return { Bits[0], Bits[1], Bits[2] };
+		}
+
+		FORCEINLINE uint32 GetWeldKeyHash(const FWeldKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.X), GetTypeHash(Key.Y)), GetTypeHash(Key.Z));
+		}
+
+		// every vertex is mapped to the lowest kept vertex within Tolerance that Predicate(Vertex, KeptVertex) accepts (itself when none)
+		template<typename PredicateType>
+		void WeldRemap(const TArrayView<const FVector> Positions, const float Tolerance, PredicateType Predicate, TArray<int32>& Remap)
+		{
+			const int32 NumVertices = Positions.Num();
+
+			TArray<FWeldKey> Keys;
+			Keys.AddUninitialized(NumVertices);
+			ParallelFor(NumVertices, [&](const int32 VertexIndex)
+				{
+					Keys[VertexIndex] = MakeWeldKey(Positions[VertexIndex], Tolerance);
+				});
+
+			// hash buckets in CSR form (atomic counters + parallel prefix sum), sorted for a deterministic result
+			const int32 NumBuckets = static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(NumVertices)));
+			TArray<int32> BucketOffsets;
+			BucketOffsets.AddZeroed(NumBuckets + 1);
+
+			TArray<int32> VertexBuckets;
+			VertexBuckets.AddUninitialized(NumVertices);
+			ParallelFor(NumVertices, [&](const int32 VertexIndex)
+				{
+					const int32 Bucket = static_cast<int32>(GetWeldKeyHash(Keys[VertexIndex]) & static_cast<uint32>(NumBuckets - 1));
+					VertexBuckets[VertexIndex] = Bucket;
+					FPlatformAtomics::InterlockedIncrement(&BucketOffsets[Bucket]);
+				});
+
+			ParallelExclusivePrefixSum(BucketOffsets);
+
+			TArray<int32> BucketVertices;
+			BucketVertices.AddUninitialized(NumVertices);
+			{
+				TArray<int32> Cursors = BucketOffsets;
+				ParallelFor(NumVertices, [&](const int32 VertexIndex)
+					{
+						const int32 Slot = FPlatformAtomics::InterlockedIncrement(&Cursors[VertexBuckets[VertexIndex]]) - 1;
+						BucketVertices[Slot] = VertexIndex;
+					});
+			}
+
+			// sorted buckets, so that the lowest matching vertex is found first
+			ParallelFor(NumBuckets, [&](const int32 Bucket)
+				{
+					const int32 Start = BucketOffsets[Bucket];
+					const int32 Num = BucketOffsets[Bucket + 1] - Start;
+					if (Num > 1)
+					{
+						Algo::Sort(MakeArrayView(BucketVertices.GetData() + Start, Num));
+					}
+				});
+
+			// vertices close to a cell boundary can match the ones on the other side, so the neighbour cells are probed too (exact keys have no neighbours)
+			const int64 CellRadius = Tolerance > 0 ? 1 : 0;
+			auto FindMatch = [&](const int32 VertexIndex, const TArray<int32>* KeptRemap)
+				{
+					int32 Match = INDEX_NONE;
+					const FWeldKey& Key = Keys[VertexIndex];
+					for (int64 Z = -CellRadius; Z <= CellRadius; Z++)
+					{
+						for (int64 Y = -CellRadius; Y <= CellRadius; Y++)
+						{
+							for (int64 X = -CellRadius; X <= CellRadius; X++)
+							{
+								const FWeldKey CellKey = { Key.X + X, Key.Y + Y, Key.Z + Z };
+								const int32 Bucket = static_cast<int32>(GetWeldKeyHash(CellKey) & static_cast<uint32>(NumBuckets - 1));
+								for (int32 Index = BucketOffsets[Bucket]; Index < BucketOffsets[Bucket + 1]; Index++)
+								{
+									const int32 OtherVertexIndex = BucketVertices[Index];
+									if (OtherVertexIndex >= VertexIndex || (Match != INDEX_NONE && OtherVertexIndex >= Match))
+									{
+										break;
+									}
+									if (Keys[OtherVertexIndex] != CellKey || (KeptRemap && (*KeptRemap)[OtherVertexIndex] != OtherVertexIndex))
+									{
+										continue;
+									}
+									if (Positions[OtherVertexIndex].Equals(Positions[VertexIndex], Tolerance) && Predicate(VertexIndex, OtherVertexIndex))
+									{
+										Match = OtherVertexIndex;
+										break;
+									}
+								}
+							}
+						}
+					}
+					return Match;
+				};
+
+			// the lowest matching vertex of each one is searched in parallel
+			TArray<int32> Matches;
+			Matches.AddUninitialized(NumVertices);
+			ParallelFor(NumVertices, [&](const int32 VertexIndex)
+				{
+					Matches[VertexIndex] = FindMatch(VertexIndex, nullptr);
+				});
+
+			// every vertex is mapped to the lowest kept vertex it matches (no chains, so merged vertices never drift more than the tolerance),
+			// the parallel result is that one unless the match was merged itself
+			Remap.SetNumUninitialized(NumVertices);
+			for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+			{
+				int32 Match = Matches[VertexIndex];
+				if (Match != INDEX_NONE && Remap[Match] != Match)
+				{
+					Match = FindMatch(VertexIndex, &Remap);
+				}
+				Remap[VertexIndex] = Match != INDEX_NONE ? Match : VertexIndex;
+			}
+		}
+	}
+}
+
+int32 glTFRuntime::ParallelExclusivePrefixSum(TArray<int32>& Values)
+{
+	const int32 NumBlocks = FMath::DivideAndRoundUp(Values.Num(), Geometry::BlockSize);
+
+	TArray<int32> BlockSums;
+	BlockSums.AddZeroed(NumBlocks);
+
+	ParallelFor(NumBlocks, [&](const int32 BlockIndex)
+		{
+			const int32 Start = BlockIndex * Geometry::BlockSize;
+			const int32 End = FMath::Min(Start + Geometry::BlockSize, Values.Num());
+			int32 Sum = 0;
+			for (int32 Index = Start; Index < End; Index++)
+			{
+				const int32 Value = Values[Index];
+				Values[Index] = Sum;
+				Sum += Value;
+			}
+			BlockSums[BlockIndex] = Sum;
+		});
+
+	int32 Total = 0;
+	for (int32& BlockSum : BlockSums)
+	{
+		const int32 Value = BlockSum;
+		BlockSum = Total;
+		Total += Value;
+	}
+
+	ParallelFor(NumBlocks, [&](const int32 BlockIndex)
+		{
+			const int32 Offset = BlockSums[BlockIndex];
+			if (Offset == 0)
+			{
+				return;
+			}
+			const int32 Start = BlockIndex * Geometry::BlockSize;
+			const int32 End = FMath::Min(Start + Geometry::BlockSize, Values.Num());
+			for (int32 Index = Start; Index < End; Index++)
+			{
+				Values[Index] += Offset;
+			}
+		});
+
+	return Total;
+}
+
+void glTFRuntime::FTriangleAdjacency::Build(const TArrayView<const uint32> Indices, const int32 NumVertices)
+{
+	const int32 NumTriangles = Indices.Num() / 3;
+
+	Offsets.Reset();
+	Offsets.AddZeroed(NumVertices + 1);
+
+	// count the corners of each vertex (triangles referencing invalid vertices are skipped)
+	ParallelFor(NumTriangles, [&](const int32 TriangleIndex)
+		{
+			const uint32* Triangle = &Indices[TriangleIndex * 3];
+			if (Triangle[0] >= static_cast<uint32>(NumVertices) || Triangle[1] >= static_cast<uint32>(NumVertices) || Triangle[2] >= static_cast<uint32>(NumVertices))
+			{
+				return;
+			}
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+			{
+				FPlatformAtomics::InterlockedIncrement(&Offsets[Triangle[CornerIndex]]);
+			}
+		});
+
+	const int32 NumCorners = ParallelExclusivePrefixSum(Offsets);
+
+	Corners.Reset();
+	Corners.AddUninitialized(NumCorners);
+
+	TArray<int32> Cursors = Offsets;
+	ParallelFor(NumTriangles, [&](const int32 TriangleIndex)
+		{
+			const uint32* Triangle = &Indices[TriangleIndex * 3];
+			if (Triangle[0] >= static_cast<uint32>(NumVertices) || Triangle[1] >= static_cast<uint32>(NumVertices) || Triangle[2] >= static_cast<uint32>(NumVertices))
+			{
+				return;
+			}
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+			{
+				const int32 Slot = FPlatformAtomics::InterlockedIncrement(&Cursors[Triangle[CornerIndex]]) - 1;
+				Corners[Slot] = TriangleIndex * 3 + CornerIndex;
+			}
+		});
+
+	// sort each vertex list, so that accumulations do not depend on scheduling
+	ParallelFor(NumVertices, [&](const int32 VertexIndex)
+		{
+			const int32 Start = Offsets[VertexIndex];
+			const int32 Num = Offsets[VertexIndex + 1] - Start;
+			if (Num > 1)
+			{
+				Algo::Sort(MakeArrayView(Corners.GetData() + Start, Num));
+			}
+		});
+}
+
+void glTFRuntime::WeldVertices(const TArrayView<const FVector> Positions, const float Tolerance, TArray<int32>& Offsets, TArray<int32>& Vertices, TArray<int32>& VertexGroups)
+{
+	const int32 NumVertices = Positions.Num();
+
+	TArray<int32> Remap;
+	Geometry::WeldRemap(Positions, Tolerance, [](const int32 VertexIndex, const int32 OtherVertexIndex) { return true; }, Remap);
+
+	// the vertices mapped to the same kept vertex are a group
+	Vertices.Reset(NumVertices);
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		Vertices.Add(VertexIndex);
+	}
+
+	Algo::Sort(Vertices, [&](const int32 A, const int32 B)
+		{
+			if (Remap[A] != Remap[B])
+			{
+				return Remap[A] < Remap[B];
+			}
+			return A < B;
+		});
+
+	Offsets.Reset();
+	VertexGroups.SetNumUninitialized(NumVertices);
+	for (int32 Index = 0; Index < NumVertices; Index++)
+	{
+		if (Index == 0 || Remap[Vertices[Index]] != Remap[Vertices[Index - 1]])
+		{
+			Offsets.Add(Index);
+		}
+		VertexGroups[Vertices[Index]] = Offsets.Num() - 1;
+	}
+	Offsets.Add(NumVertices);
+}
+
+void glTFRuntime::ComputeSmoothNormals(const TArrayView<const FVector> Positions, const TArrayView<const uint32> Indices, TArray<FVector>& Normals, const bool bWeldVertices, const float WeldTolerance, const float CreaseAngle)
+{
+	const int32 NumVertices = Positions.Num();
+	const int32 NumTriangles = Indices.Num() / 3;
+
+	// unnormalized face normals (length is twice the area) and corner angles
+	TArray<FVector> FaceNormals;
+	FaceNormals.AddUninitialized(NumTriangles);
+	TArray<float> CornerAngles;
+	CornerAngles.AddUninitialized(NumTriangles * 3);
+
+	ParallelFor(NumTriangles, [&](const int32 TriangleIndex)
+		{
+			const uint32* Triangle = &Indices[TriangleIndex * 3];
+			if (Triangle[0] >= static_cast<uint32>(NumVertices) || Triangle[1] >= static_cast<uint32>(NumVertices) || Triangle[2] >= static_cast<uint32>(NumVertices))
+			{
+				FaceNormals[TriangleIndex] = FVector::ZeroVector;
+				return;
+			}
+
+			const FVector& Position0 = Positions[Triangle[0]];
+			const FVector& Position1 = Positions[Triangle[1]];
+			const FVector& Position2 = Positions[Triangle[2]];
+
+			FaceNormals[TriangleIndex] = FVector::CrossProduct(Position2 - Position0, Position1 - Position0);
+			CornerAngles[TriangleIndex * 3] = Geometry::CornerAngle(Position1 - Position0, Position2 - Position0);
+			CornerAngles[TriangleIndex * 3 + 1] = Geometry::CornerAngle(Position2 - Position1, Position0 - Position1);
+			CornerAngles[TriangleIndex * 3 + 2] = Geometry::CornerAngle(Position0 - Position2, Position1 - Position2);
+		});
+
+	FTriangleAdjacency Adjacency;
+	Adjacency.Build(Indices, NumVertices);
+
+	auto AccumulateVertex = [&](const int32 VertexIndex)
+		{
+			FVector Normal = FVector::ZeroVector;
+			for (int32 Index = Adjacency.Offsets[VertexIndex]; Index < Adjacency.Offsets[VertexIndex + 1]; Index++)
+			{
+				const int32 Corner = Adjacency.Corners[Index];
+				Normal += FaceNormals[Corner / 3] * CornerAngles[Corner];
+			}
+			return Normal;
+		};
+
+	Normals.SetNumUninitialized(NumVertices);
+
+	if (!bWeldVertices)
+	{
+		ParallelFor(NumVertices, [&](const int32 VertexIndex)
+			{
+				Normals[VertexIndex] = AccumulateVertex(VertexIndex).GetSafeNormal();
+			});
+		return;
+	}
+
+	TArray<int32> GroupOffsets;
+	TArray<int32> GroupVertices;
+	TArray<int32> VertexGroups;
+	WeldVertices(Positions, WeldTolerance, GroupOffsets, GroupVertices, VertexGroups);
+
+	// a vertex holds a single normal, so the crease angle only filters the faces of the other vertices in the same position
+	const float CreaseCos = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(CreaseAngle, 0.0f, 180.0f)));
+
+	ParallelFor(NumVertices, [&](const int32 VertexIndex)
+		{
+			const FVector OwnNormal = AccumulateVertex(VertexIndex);
+			const FVector OwnDirection = OwnNormal.GetSafeNormal();
+			FVector Normal = OwnNormal;
+
+			const int32 Group = VertexGroups[VertexIndex];
+			for (int32 GroupIndex = GroupOffsets[Group]; GroupIndex < GroupOffsets[Group + 1]; GroupIndex++)
+			{
+				const int32 OtherVertexIndex = GroupVertices[GroupIndex];
+				if (OtherVertexIndex == VertexIndex)
+				{
+					continue;
+				}
+
+				for (int32 Index = Adjacency.Offsets[OtherVertexIndex]; Index < Adjacency.Offsets[OtherVertexIndex + 1]; Index++)
+				{
+					const int32 Corner = Adjacency.Corners[Index];
+					const FVector& FaceNormal = FaceNormals[Corner / 3];
+					if (OwnDirection.IsZero() || FVector::DotProduct(FaceNormal.GetSafeNormal(), OwnDirection) >= CreaseCos)
+					{
+						Normal += FaceNormal * CornerAngles[Corner];
+					}
+				}
+			}
+
+			Normals[VertexIndex] = Normal.GetSafeNormal();
+		});
+}
+
+void glTFRuntime::ComputeMikkTSpaceTangents(const TArrayView<const FVector> Positions, const TArrayView<const FVector> Normals, const TArrayView<const FVector2D> UVs, const TArrayView<const uint32> Indices, TArray<FVector4>& Tangents)
+{
+	const int32 NumVertices = FMath::Min3(Positions.Num(), Normals.Num(), UVs.Num());
+	const int32 NumTriangles = Indices.Num() / 3;
+
+	// normalized uv derivative of the position (zero for degenerate uvs) and uv orientation of each triangle
+	TArray<FVector> TriangleTangents;
+	TriangleTangents.AddUninitialized(NumTriangles);
+	TArray<bool> TriangleOrientations;
+	TriangleOrientations.AddUninitialized(NumTriangles);
+
+	ParallelFor(NumTriangles, [&](const int32 TriangleIndex)
+		{
+			TriangleTangents[TriangleIndex] = FVector::ZeroVector;
+			TriangleOrientations[TriangleIndex] = true;
+
+			const uint32* Triangle = &Indices[TriangleIndex * 3];
+			if (Triangle[0] >= static_cast<uint32>(NumVertices) || Triangle[1] >= static_cast<uint32>(NumVertices) || Triangle[2] >= static_cast<uint32>(NumVertices))
+			{
+				return;
+			}
+
+			const FVector DeltaPosition0 = Positions[Triangle[1]] - Positions[Triangle[0]];
+			const FVector DeltaPosition1 = Positions[Triangle[2]] - Positions[Triangle[0]];
+			const FVector2D DeltaUV0 = UVs[Triangle[1]] - UVs[Triangle[0]];
+			const FVector2D DeltaUV1 = UVs[Triangle[2]] - UVs[Triangle[0]];
+
+			const float SignedArea = static_cast<float>(DeltaUV0.X * DeltaUV1.Y - DeltaUV0.Y * DeltaUV1.X);
+			TriangleOrientations[TriangleIndex] = SignedArea > 0;
+			if (FMath::IsNearlyZero(SignedArea))
+			{
+				return;
+			}
+
+			const FVector TangentX = (DeltaPosition0 * DeltaUV1.Y) - (DeltaPosition1 * DeltaUV0.Y);
+			TriangleTangents[TriangleIndex] = TangentX.GetSafeNormal() * (SignedArea > 0 ? 1 : -1);
+		});
+
+	FTriangleAdjacency Adjacency;
+	Adjacency.Build(Indices, NumVertices);
+
+	Tangents.SetNumUninitialized(NumVertices);
+
+	ParallelFor(NumVertices, [&](const int32 VertexIndex)
+		{
+			const FVector Normal = Normals[VertexIndex].GetSafeNormal();
+
+			// project the corner data on the vertex tangent plane, weighted by the projected corner angle
+			FVector Accumulated[2] = { FVector::ZeroVector, FVector::ZeroVector };
+			float Weights[2] = { 0, 0 };
+			for (int32 Index = Adjacency.Offsets[VertexIndex]; Index < Adjacency.Offsets[VertexIndex + 1]; Index++)
+			{
+				const int32 Corner = Adjacency.Corners[Index];
+				const int32 TriangleIndex = Corner / 3;
+				const FVector& TriangleTangent = TriangleTangents[TriangleIndex];
+				if (TriangleTangent.IsZero())
+				{
+					continue;
+				}
+
+				const uint32* Triangle = &Indices[TriangleIndex * 3];
+				const int32 CornerIndex = Corner % 3;
+				const FVector& Position = Positions[VertexIndex];
+				const FVector Edge0 = Positions[Triangle[(CornerIndex + 1) % 3]] - Position;
+				const FVector Edge1 = Positions[Triangle[(CornerIndex + 2) % 3]] - Position;
+				const float Angle = Geometry::CornerAngle(Edge0 - Normal * FVector::DotProduct(Normal, Edge0), Edge1 - Normal * FVector::DotProduct(Normal, Edge1));
+
+				const FVector ProjectedTangent = (TriangleTangent - Normal * FVector::DotProduct(Normal, TriangleTangent)).GetSafeNormal();
+				const int32 Orientation = TriangleOrientations[TriangleIndex] ? 1 : 0;
+				Accumulated[Orientation] += ProjectedTangent * Angle;
+				Weights[Orientation] += Angle;
+			}
+
+			// a vertex cannot be split here, so mixed orientations (mirrored uv seams) keep the dominant one
+			const int32 Orientation = Weights[1] >= Weights[0] ? 1 : 0;
+			FVector TangentX = Accumulated[Orientation].GetSafeNormal();
+			if (TangentX.IsZero())
+			{
+				FVector TangentY;
+				Normal.FindBestAxisVectors(TangentX, TangentY);
+			}
+
+			Tangents[VertexIndex] = FVector4(TangentX, Orientation ? 1 : -1);
+		});
+}
+
+int64 glTFRuntime::CountVertexCacheMisses(const TArrayView<const uint32> Indices, const int32 NumVertices, const int32 CacheSize)
+{
+	// a vertex is in the FIFO cache when less than CacheSize misses happened after it was loaded
+	TArray<int32> CacheTimeStamps;
+	CacheTimeStamps.Init(-CacheSize, NumVertices);
+
+	int32 Time = 0;
+	int64 Misses = 0;
+	for (const uint32 Index : Indices)
+	{
+		if (Index >= static_cast<uint32>(NumVertices))
+		{
+			Misses++;
+			continue;
+		}
+
+		if (Time - CacheTimeStamps[Index] >= CacheSize)
+		{
+			CacheTimeStamps[Index] = Time++;
+			Misses++;
+		}
+	}
+
+	return Misses;
+}
+
+bool glTFRuntime::OptimizeVertexCache(TArrayView<uint32> Indices, const int32 NumVertices, const int32 CacheSize)
+{
+	const int32 NumTriangles = Indices.Num() / 3;
+
+	for (const uint32 Index : Indices)
+	{
+		if (Index >= static_cast<uint32>(NumVertices))
+		{
+			return false;
+		}
+	}
+
+	if (NumTriangles < 2 || CacheSize < 3)
+	{
+		return true;
+	}
+
+	FTriangleAdjacency Adjacency;
+	Adjacency.Build(Indices, NumVertices);
+
+	TArray<int32> LiveTriangles;
+	LiveTriangles.AddUninitialized(NumVertices);
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		LiveTriangles[VertexIndex] = Adjacency.Offsets[VertexIndex + 1] - Adjacency.Offsets[VertexIndex];
+	}
+
+	TArray<int32> CacheTimeStamps;
+	CacheTimeStamps.AddZeroed(NumVertices);
+
+	TArray<bool> EmittedTriangles;
+	EmittedTriangles.AddZeroed(NumTriangles);
+
+	TArray<int32> DeadEndStack;
+	DeadEndStack.Reserve(NumTriangles * 3);
+
+	TArray<uint32> OptimizedIndices;
+	OptimizedIndices.Reserve(NumTriangles * 3);
+
+	TArray<int32> Candidates;
+
+	int32 FanningVertex = 0;
+	int32 Time = CacheSize + 1;
+	int32 Cursor = 1;
+
+	while (FanningVertex >= 0)
+	{
+		// emit all the remaining triangles around the fanning vertex
+		Candidates.Reset();
+		for (int32 Index = Adjacency.Offsets[FanningVertex]; Index < Adjacency.Offsets[FanningVertex + 1]; Index++)
+		{
+			const int32 TriangleIndex = Adjacency.Corners[Index] / 3;
+			if (EmittedTriangles[TriangleIndex])
+			{
+				continue;
+			}
+
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+			{
+				const uint32 VertexIndex = Indices[TriangleIndex * 3 + CornerIndex];
+				OptimizedIndices.Add(VertexIndex);
+				DeadEndStack.Add(VertexIndex);
+				Candidates.Add(VertexIndex);
+				LiveTriangles[VertexIndex]--;
+				// same FIFO rule of CountVertexCacheMisses()
+				if (Time - CacheTimeStamps[VertexIndex] >= CacheSize)
+				{
+					CacheTimeStamps[VertexIndex] = Time++;
+				}
+			}
+
+			EmittedTriangles[TriangleIndex] = true;
+		}
+
+		// next fanning vertex: the oldest candidate that will still be in cache after emitting its triangles
+		int32 NextVertex = INDEX_NONE;
+		int32 BestPriority = -1;
+		for (const int32 VertexIndex : Candidates)
+		{
+			if (LiveTriangles[VertexIndex] <= 0)
+			{
+				continue;
+			}
+
+			int32 Priority = 0;
+			if (Time - CacheTimeStamps[VertexIndex] + 2 * LiveTriangles[VertexIndex] < CacheSize)
+			{
+				Priority = Time - CacheTimeStamps[VertexIndex];
+			}
+
+			if (Priority > BestPriority)
+			{
+				BestPriority = Priority;
+				NextVertex = VertexIndex;
+			}
+		}
+
+		// dead end: go back to the recently used vertices, then scan for the next live one
+		while (NextVertex == INDEX_NONE && DeadEndStack.Num() > 0)
+		{
+			const int32 VertexIndex = DeadEndStack.Pop();
+			if (LiveTriangles[VertexIndex] > 0)
+			{
+				NextVertex = VertexIndex;
+			}
+		}
+
+		while (NextVertex == INDEX_NONE && Cursor < NumVertices)
+		{
+			if (LiveTriangles[Cursor] > 0)
+			{
+				NextVertex = Cursor;
+			}
+			Cursor++;
+		}
+
+		FanningVertex = NextVertex;
+	}
+
+	FMemory::Memcpy(Indices.GetData(), OptimizedIndices.GetData(), OptimizedIndices.Num() * sizeof(uint32));
+
+	return true;
+}
+
+bool glTFRuntime::OptimizeOverdraw(TArrayView<uint32> Indices, const TArrayView<const FVector> Positions, const int32 CacheSize, const float Threshold)
+{
+	const int32 NumVertices = Positions.Num();
+	const int32 NumTriangles = Indices.Num() / 3;
+
+	for (const uint32 Index : Indices)
+	{
+		if (Index >= static_cast<uint32>(NumVertices))
+		{
+			return false;
+		}
+	}
+
+	if (NumTriangles < 2 || CacheSize < 3)
+	{
+		return true;
+	}
+
+	TArray<int32> CacheTimeStamps;
+	CacheTimeStamps.Init(-CacheSize, NumVertices);
+	int32 Time = 0;
+
+	auto CountTriangleMisses = [&](const int32 TriangleIndex)
+		{
+			int32 Misses = 0;
+			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+			{
+				const uint32 VertexIndex = Indices[TriangleIndex * 3 + CornerIndex];
+				if (Time - CacheTimeStamps[VertexIndex] >= CacheSize)
+				{
+					CacheTimeStamps[VertexIndex] = Time++;
+					Misses++;
+				}
+			}
+			return Misses;
+		};
+
+	// every older entry is evicted
+	auto FlushCache = [&]()
+		{
+			Time += CacheSize;
+		};
+
+	// hard boundaries: triangles missing all of their vertices, where the vertex cache order restarted
+	TArray<int32> HardBoundaries;
+	for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+	{
+		if (CountTriangleMisses(TriangleIndex) == 3 || TriangleIndex == 0)
+		{
+			HardBoundaries.Add(TriangleIndex);
+		}
+	}
+	HardBoundaries.Add(NumTriangles);
+
+	// soft boundaries: a cluster (starting with a cold cache) ends as soon as its ACMR is within Threshold of the hard cluster one
+	TArray<int32> Clusters;
+	for (int32 HardClusterIndex = 0; HardClusterIndex < HardBoundaries.Num() - 1; HardClusterIndex++)
+	{
+		const int32 Start = HardBoundaries[HardClusterIndex];
+		const int32 End = HardBoundaries[HardClusterIndex + 1];
+
+		FlushCache();
+		int32 HardClusterMisses = 0;
+		for (int32 TriangleIndex = Start; TriangleIndex < End; TriangleIndex++)
+		{
+			HardClusterMisses += CountTriangleMisses(TriangleIndex);
+		}
+		const float MaxACMR = Threshold * HardClusterMisses / (End - Start);
+
+		FlushCache();
+		Clusters.Add(Start);
+		int32 ClusterStart = Start;
+		int32 ClusterMisses = 0;
+		for (int32 TriangleIndex = Start; TriangleIndex < End - 1; TriangleIndex++)
+		{
+			ClusterMisses += CountTriangleMisses(TriangleIndex);
+			if (ClusterMisses <= MaxACMR * (TriangleIndex + 1 - ClusterStart))
+			{
+				FlushCache();
+				ClusterStart = TriangleIndex + 1;
+				ClusterMisses = 0;
+				Clusters.Add(ClusterStart);
+			}
+		}
+	}
+	Clusters.Add(NumTriangles);
+
+	const int32 NumClusters = Clusters.Num() - 1;
+	if (NumClusters < 2)
+	{
+		return true;
+	}
+
+	// view independent sorting: clusters facing away from the mesh center are likely to occlude the others, so they go first
+	FVector MeshCentroid = FVector::ZeroVector;
+	for (const uint32 Index : Indices)
+	{
+		MeshCentroid += Positions[Index];
+	}
+	MeshCentroid /= NumTriangles * 3;
+
+	TArray<float> ClusterSortKeys;
+	ClusterSortKeys.AddUninitialized(NumClusters);
+	ParallelFor(NumClusters, [&](const int32 ClusterIndex)
+		{
+			FVector ClusterCentroid = FVector::ZeroVector;
+			FVector ClusterNormal = FVector::ZeroVector;
+			for (int32 TriangleIndex = Clusters[ClusterIndex]; TriangleIndex < Clusters[ClusterIndex + 1]; TriangleIndex++)
+			{
+				const FVector& Position0 = Positions[Indices[TriangleIndex * 3]];
+				const FVector& Position1 = Positions[Indices[TriangleIndex * 3 + 1]];
+				const FVector& Position2 = Positions[Indices[TriangleIndex * 3 + 2]];
+				ClusterCentroid += Position0 + Position1 + Position2;
+				// area weighted
+				ClusterNormal += FVector::CrossProduct(Position2 - Position0, Position1 - Position0);
+			}
+			ClusterCentroid /= (Clusters[ClusterIndex + 1] - Clusters[ClusterIndex]) * 3;
+			ClusterSortKeys[ClusterIndex] = static_cast<float>(FVector::DotProduct(ClusterCentroid - MeshCentroid, ClusterNormal.GetSafeNormal()));
+		});
+
+	TArray<int32> SortedClusters;
+	SortedClusters.AddUninitialized(NumClusters);
+	for (int32 ClusterIndex = 0; ClusterIndex < NumClusters; ClusterIndex++)
+	{
+		SortedClusters[ClusterIndex] = ClusterIndex;
+	}
+	Algo::Sort(SortedClusters, [&](const int32 A, const int32 B)
+		{
+			return ClusterSortKeys[A] > ClusterSortKeys[B] || (ClusterSortKeys[A] == ClusterSortKeys[B] && A < B);
+		});
+
+	TArray<uint32> OptimizedIndices;
+	OptimizedIndices.Reserve(Indices.Num());
+	for (const int32 ClusterIndex : SortedClusters)
+	{
+		OptimizedIndices.Append(Indices.GetData() + Clusters[ClusterIndex] * 3, (Clusters[ClusterIndex + 1] - Clusters[ClusterIndex]) * 3);
+	}
+
+	FMemory::Memcpy(Indices.GetData(), OptimizedIndices.GetData(), OptimizedIndices.Num() * sizeof(uint32));
+
+	return true;
+}
+
+void glTFRuntime::OptimizeVertexFetch(TArrayView<uint32> Indices, const int32 NumVertices, TArray<int32>& NewToOld)
+{
+	TArray<int32> OldToNew;
+	OldToNew.Init(INDEX_NONE, NumVertices);
+
+	NewToOld.Reset(NumVertices);
+
+	for (uint32& Index : Indices)
+	{
+		if (Index >= static_cast<uint32>(NumVertices))
+		{
+			continue;
+		}
+
+		if (OldToNew[Index] == INDEX_NONE)
+		{
+			OldToNew[Index] = NewToOld.Add(Index);
+		}
+		Index = OldToNew[Index];
+	}
+
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		if (OldToNew[VertexIndex] == INDEX_NONE)
+		{
+			NewToOld.Add(VertexIndex);
+		}
+	}
+}
+
+bool glTFRuntime::OptimizeSection(TArrayView<uint32> Indices, const int32 NumVertices, const int32 CacheSize, TArray<int32>& NewToOld, FglTFRuntimeMeshOptimizationStats& Stats, const TArrayView<const FVector> Positions, const float OverdrawThreshold)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	const int64 CacheMissesBefore = CountVertexCacheMisses(Indices, NumVertices, CacheSize);
+
+	if (!OptimizeVertexCache(Indices, NumVertices, CacheSize))
+	{
+		return false;
+	}
+
+	// indices are already validated
+	if (OverdrawThreshold >= 1 && Positions.Num() == NumVertices)
+	{
+		OptimizeOverdraw(Indices, Positions, CacheSize, OverdrawThreshold);
+	}
+
+	OptimizeVertexFetch(Indices, NumVertices, NewToOld);
+
+	FglTFRuntimeMeshOptimizationStats SectionStats;
+	SectionStats.Sections = 1;
+	SectionStats.Triangles = Indices.Num() / 3;
+	SectionStats.CacheMissesBefore = CacheMissesBefore;
+	SectionStats.CacheMissesAfter = CountVertexCacheMisses(Indices, NumVertices, CacheSize);
+	SectionStats.OptimizationTime = FPlatformTime::Seconds() - StartTime;
+
+	Stats.Append(SectionStats);
+
+	return true;
+}
+
+namespace glTFRuntime
+{
+	namespace Geometry
+	{
+		// streams not matching the number of vertices (missing attributes) are left untouched
+		template<typename T>
+		void RemapStream(TArray<T>& Stream, const int32 NumVertices, const TArray<int32>& NewToOld)
+		{
+			if (Stream.Num() != NumVertices)
+			{
+				return;
+			}
+
+			TArray<T> RemappedStream;
+			RemappedStream.Reserve(NewToOld.Num());
+			for (const int32 OldIndex : NewToOld)
+			{
+				RemappedStream.Add(Stream[OldIndex]);
+			}
+			Stream = MoveTemp(RemappedStream);
+		}
+	}
+}
+
+void glTFRuntime::RemapPrimitiveVertices(FglTFRuntimePrimitive& Primitive, const TArray<int32>& NewToOld)
+{
+	const int32 NumVertices = Primitive.NumVertices();
+
+	Geometry::RemapStream(Primitive.Positions, NumVertices, NewToOld);
+	Geometry::RemapStream(Primitive.Normals, NumVertices, NewToOld);
+	Geometry::RemapStream(Primitive.Tangents, NumVertices, NewToOld);
+	for (TArray<FVector2D>& UV : Primitive.UVs)
+	{
+		Geometry::RemapStream(UV, NumVertices, NewToOld);
+	}
+	for (TArray<FglTFRuntimeUInt16Vector4>& JointsSet : Primitive.Joints)
+	{
+		Geometry::RemapStream(JointsSet, NumVertices, NewToOld);
+	}
+	for (TArray<FVector4>& WeightsSet : Primitive.Weights)
+	{
+		Geometry::RemapStream(WeightsSet, NumVertices, NewToOld);
+	}
+	Geometry::RemapStream(Primitive.Colors, NumVertices, NewToOld);
+	for (FglTFRuntimeMorphTarget& MorphTarget : Primitive.MorphTargets)
+	{
+		Geometry::RemapStream(MorphTarget.Positions, NumVertices, NewToOld);
+		Geometry::RemapStream(MorphTarget.Normals, NumVertices, NewToOld);
+	}
+	for (TPair<FString, TArray<float>>& Pair : Primitive.WeightMaps)
+	{
+		Geometry::RemapStream(Pair.Value, NumVertices, NewToOld);
+	}
+
+	Geometry::RemapStream(Primitive.CompactPositions, NumVertices, NewToOld);
+	Geometry::RemapStream(Primitive.CompactNormals, NumVertices, NewToOld);
+	Geometry::RemapStream(Primitive.CompactTangents, NumVertices, NewToOld);
+	for (TArray<FglTFRuntimeCompactVector2D>& UV : Primitive.CompactUVs)
+	{
+		Geometry::RemapStream(UV, NumVertices, NewToOld);
+	}
+	Geometry::RemapStream(Primitive.CompactColors, NumVertices, NewToOld);
+}
+
+namespace glTFRuntime
+{
+	namespace Geometry
+	{
+		// symmetric 4x4 matrix of the squared distances from a set of (weighted) planes
+		struct FQuadric
+		{
+			double A00 = 0;
+			double A01 = 0;
+			double A02 = 0;
+			double A11 = 0;
+			double A12 = 0;
+			double A22 = 0;
+			double B0 = 0;
+			double B1 = 0;
+			double B2 = 0;
+			double C = 0;
+
+			FQuadric() = default;
+
+			FQuadric(const FVector& Normal, const double Distance, const double Weight)
+			{
+				A00 = Weight * Normal.X * Normal.X;
+				A01 = Weight * Normal.X * Normal.Y;
+				A02 = Weight * Normal.X * Normal.Z;
+				A11 = Weight * Normal.Y * Normal.Y;
+				A12 = Weight * Normal.Y * Normal.Z;
+				A22 = Weight * Normal.Z * Normal.Z;
+				B0 = Weight * Normal.X * Distance;
+				B1 = Weight * Normal.Y * Distance;
+				B2 = Weight * Normal.Z * Distance;
+				C = Weight * Distance * Distance;
+			}
+
+			FQuadric& operator+=(const FQuadric& Other)
+			{
+				A00 += Other.A00;
+				A01 += Other.A01;
+				A02 += Other.A02;
+				A11 += Other.A11;
+				A12 += Other.A12;
+				A22 += Other.A22;
+				B0 += Other.B0;
+				B1 += Other.B1;
+				B2 += Other.B2;
+				C += Other.C;
+				return *this;
+			}
+
+			double Evaluate(const FVector& Position) const
+			{
+				const double X = Position.X;
+				const double Y = Position.Y;
+				const double Z = Position.Z;
+				return A00 * X * X + 2 * A01 * X * Y + 2 * A02 * X * Z + A11 * Y * Y + 2 * A12 * Y * Z + A22 * Z * Z + 2 * (B0 * X + B1 * Y + B2 * Z) + C;
+			}
+		};
+
+		struct FCollapse
+		{
+			int32 From;
+			int32 To;
+			double Cost;
+		};
+
+		FORCEINLINE bool IsTriangleDegenerate(const uint32* Triangle)
+		{
+			return Triangle[0] == Triangle[1] || Triangle[1] == Triangle[2] || Triangle[0] == Triangle[2];
+		}
+
+		// exact comparison of a vertex attribute (missing values are considered equal)
+		template<typename T>
+		bool AreStreamValuesEqual(const TArray<T>& Stream, const int32 A, const int32 B)
+		{
+			return !Stream.IsValidIndex(A) || !Stream.IsValidIndex(B) || FMemory::Memcmp(&Stream[A], &Stream[B], sizeof(T)) == 0;
+		}
+
+		bool AreVerticesEqual(const FglTFRuntimePrimitive& Primitive, const int32 A, const int32 B)
+		{
+			if (!AreStreamValuesEqual(Primitive.Positions, A, B) || !AreStreamValuesEqual(Primitive.Normals, A, B) || !AreStreamValuesEqual(Primitive.Tangents, A, B) || !AreStreamValuesEqual(Primitive.Colors, A, B))
+			{
+				return false;
+			}
+			for (const TArray<FVector2D>& UV : Primitive.UVs)
+			{
+				if (!AreStreamValuesEqual(UV, A, B))
+				{
+					return false;
+				}
+			}
+			for (const TArray<FglTFRuntimeUInt16Vector4>& JointsSet : Primitive.Joints)
+			{
+				if (!AreStreamValuesEqual(JointsSet, A, B))
+				{
+					return false;
+				}
+			}
+			for (const TArray<FVector4>& WeightsSet : Primitive.Weights)
+			{
+				if (!AreStreamValuesEqual(WeightsSet, A, B))
+				{
+					return false;
+				}
+			}
+			for (const FglTFRuntimeMorphTarget& MorphTarget : Primitive.MorphTargets)
+			{
+				if (!AreStreamValuesEqual(MorphTarget.Positions, A, B) || !AreStreamValuesEqual(MorphTarget.Normals, A, B))
+				{
+					return false;
+				}
+			}
+			for (const TPair<FString, TArray<float>>& Pair : Primitive.WeightMaps)
+			{
+				if (!AreStreamValuesEqual(Pair.Value, A, B))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	}
+}
+
+int32 glTFRuntime::SimplifyMesh(const TArrayView<const FVector> Positions, const TArrayView<const uint32> Indices, const TArrayView<const bool> LockedVertices, const int32 TargetNumTriangles, TArray<uint32>& OutIndices)
+{
+	const int32 NumVertices = Positions.Num();
+	const int32 NumTriangles = Indices.Num() / 3;
+
+	OutIndices = TArray<uint32>(Indices.GetData(), NumTriangles * 3);
+
+	for (const uint32 Index : OutIndices)
+	{
+		if (Index >= static_cast<uint32>(NumVertices))
+		{
+			return NumTriangles;
+		}
+	}
+
+	// area weighted plane quadrics of the faces, summed per vertex
+	TArray<Geometry::FQuadric> FaceQuadrics;
+	FaceQuadrics.SetNum(NumTriangles);
+	ParallelFor(NumTriangles, [&](const int32 TriangleIndex)
+		{
+			const uint32* Triangle = &OutIndices[TriangleIndex * 3];
+			const FVector& Position0 = Positions[Triangle[0]];
+			const FVector Cross = FVector::CrossProduct(Positions[Triangle[2]] - Position0, Positions[Triangle[1]] - Position0);
+			if (Cross.IsNearlyZero(SMALL_NUMBER))
+			{
+				return;
+			}
+			const FVector Normal = Cross.GetSafeNormal();
+			FaceQuadrics[TriangleIndex] = Geometry::FQuadric(Normal, -FVector::DotProduct(Normal, Position0), Cross.Size() * 0.5);
+		});
+
+	TArray<Geometry::FQuadric> Quadrics;
+	Quadrics.SetNum(NumVertices);
+	{
+		FTriangleAdjacency Adjacency;
+		Adjacency.Build(OutIndices, NumVertices);
+		ParallelFor(NumVertices, [&](const int32 VertexIndex)
+			{
+				for (int32 Index = Adjacency.Offsets[VertexIndex]; Index < Adjacency.Offsets[VertexIndex + 1]; Index++)
+				{
+					Quadrics[VertexIndex] += FaceQuadrics[Adjacency.Corners[Index] / 3];
+				}
+			});
+	}
+
+	int32 LiveTriangles = 0;
+	for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+	{
+		if (!Geometry::IsTriangleDegenerate(&OutIndices[TriangleIndex * 3]))
+		{
+			LiveTriangles++;
+		}
+	}
+
+	TArray<Geometry::FCollapse> Collapses;
+	TArray<bool> TouchedVertices;
+
+	// every pass collapses the cheapest independent edges (no vertex is touched twice), so the adjacency only needs to be rebuilt between passes
+	while (LiveTriangles > TargetNumTriangles)
+	{
+		FTriangleAdjacency Adjacency;
+		Adjacency.Build(OutIndices, NumVertices);
+
+		// both directions of every triangle edge (half edge collapse: From is merged into To, that keeps all of its attributes)
+		Collapses.SetNumUninitialized(NumTriangles * 6);
+		ParallelFor(NumTriangles, [&](const int32 TriangleIndex)
+			{
+				const uint32* Triangle = &OutIndices[TriangleIndex * 3];
+				const bool bDegenerate = Geometry::IsTriangleDegenerate(Triangle);
+				for (int32 EdgeIndex = 0; EdgeIndex < 6; EdgeIndex++)
+				{
+					Geometry::FCollapse& Collapse = Collapses[TriangleIndex * 6 + EdgeIndex];
+					Collapse.From = Triangle[EdgeIndex % 3];
+					Collapse.To = Triangle[(EdgeIndex % 3 + (EdgeIndex < 3 ? 1 : 2)) % 3];
+					Collapse.Cost = -1;
+					if (bDegenerate || LockedVertices[Collapse.From])
+					{
+						continue;
+					}
+					Geometry::FQuadric Quadric = Quadrics[Collapse.From];
+					Quadric += Quadrics[Collapse.To];
+					Collapse.Cost = FMath::Max(Quadric.Evaluate(Positions[Collapse.To]), 0.0);
+				}
+			});
+
+		Collapses.RemoveAllSwap([](const Geometry::FCollapse& Collapse) { return Collapse.Cost < 0; });
+		if (Collapses.Num() == 0)
+		{
+			break;
+		}
+
+		Algo::Sort(Collapses, [](const Geometry::FCollapse& A, const Geometry::FCollapse& B)
+			{
+				if (A.Cost != B.Cost)
+				{
+					return A.Cost < B.Cost;
+				}
+				return A.From != B.From ? A.From < B.From : A.To < B.To;
+			});
+
+		// take only part of the way to the target per pass, so later collapses are chosen with updated quadrics
+		const int32 MaxCollapses = FMath::Max((LiveTriangles - TargetNumTriangles) / 4, 1);
+		int32 NumCollapses = 0;
+
+		TouchedVertices.Reset();
+		TouchedVertices.AddZeroed(NumVertices);
+
+		for (const Geometry::FCollapse& Collapse : Collapses)
+		{
+			if (LiveTriangles <= TargetNumTriangles || NumCollapses >= MaxCollapses)
+			{
+				break;
+			}
+
+			if (TouchedVertices[Collapse.From] || TouchedVertices[Collapse.To])
+			{
+				continue;
+			}
+
+			// reject collapses flipping the remaining triangles around From
+			bool bFlips = false;
+			for (int32 Index = Adjacency.Offsets[Collapse.From]; Index < Adjacency.Offsets[Collapse.From + 1] && !bFlips; Index++)
+			{
+				const uint32* Triangle = &OutIndices[(Adjacency.Corners[Index] / 3) * 3];
+				if (Geometry::IsTriangleDegenerate(Triangle) || Triangle[0] == static_cast<uint32>(Collapse.To) || Triangle[1] == static_cast<uint32>(Collapse.To) || Triangle[2] == static_cast<uint32>(Collapse.To))
+				{
+					continue;
+				}
+
+				FVector NewPositions[3];
+				for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+				{
+					NewPositions[CornerIndex] = Positions[Triangle[CornerIndex] == static_cast<uint32>(Collapse.From) ? Collapse.To : Triangle[CornerIndex]];
+				}
+
+				const FVector OldNormal = FVector::CrossProduct(Positions[Triangle[2]] - Positions[Triangle[0]], Positions[Triangle[1]] - Positions[Triangle[0]]);
+				const FVector NewNormal = FVector::CrossProduct(NewPositions[2] - NewPositions[0], NewPositions[1] - NewPositions[0]);
+				bFlips = FVector::DotProduct(OldNormal, NewNormal) <= 0;
+			}
+
+			if (bFlips)
+			{
+				continue;
+			}
+
+			for (int32 Index = Adjacency.Offsets[Collapse.From]; Index < Adjacency.Offsets[Collapse.From + 1]; Index++)
+			{
+				uint32* Triangle = &OutIndices[(Adjacency.Corners[Index] / 3) * 3];
+				if (Geometry::IsTriangleDegenerate(Triangle))
+				{
+					continue;
+				}
+
+				for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+				{
+					if (Triangle[CornerIndex] == static_cast<uint32>(Collapse.From))
+					{
+						Triangle[CornerIndex] = Collapse.To;
+					}
+				}
+
+				if (Geometry::IsTriangleDegenerate(Triangle))
+				{
+					LiveTriangles--;
+				}
+			}
+
+			Quadrics[Collapse.To] += Quadrics[Collapse.From];
+			TouchedVertices[Collapse.From] = true;
+			TouchedVertices[Collapse.To] = true;
+			NumCollapses++;
+		}
+
+		if (NumCollapses == 0)
+		{
+			break;
+		}
+	}
+
+	// drop the collapsed triangles
+	int32 NumOutIndices = 0;
+	for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+	{
+		if (!Geometry::IsTriangleDegenerate(&OutIndices[TriangleIndex * 3]))
+		{
+			OutIndices[NumOutIndices++] = OutIndices[TriangleIndex * 3];
+			OutIndices[NumOutIndices++] = OutIndices[TriangleIndex * 3 + 1];
+			OutIndices[NumOutIndices++] = OutIndices[TriangleIndex * 3 + 2];
+		}
+	}
+	OutIndices.SetNum(NumOutIndices);
+
+	return NumOutIndices / 3;
+}
+
+void glTFRuntime::SimplifyPrimitive(const FglTFRuntimePrimitive& Primitive, const float TrianglesRatio, FglTFRuntimePrimitive& OutPrimitive)
+{
+	OutPrimitive = Primitive;
+
+	const int32 NumTriangles = Primitive.Indices.Num() / 3;
+	if (TrianglesRatio >= 1 || NumTriangles * 3 != Primitive.Indices.Num())
+	{
+		return;
+	}
+
+	OutPrimitive.ExpandCompactVertexData();
+
+	const int32 NumVertices = OutPrimitive.NumVertices();
+	for (const uint32 Index : OutPrimitive.Indices)
+	{
+		if (Index >= static_cast<uint32>(NumVertices))
+		{
+			return;
+		}
+	}
+
+	// merge the vertices differing only by index (non indexed primitives, exporters duplicates), the remaining coincident ones are attribute seams
+	TArray<int32> GroupOffsets;
+	TArray<int32> GroupVertices;
+	TArray<int32> VertexGroups;
+	WeldVertices(OutPrimitive.Positions, 0, GroupOffsets, GroupVertices, VertexGroups);
+
+	const int32 NumGroups = GroupOffsets.Num() - 1;
+
+	TArray<int32> Remap;
+	Remap.AddUninitialized(NumVertices);
+	TArray<bool> LockedVertices;
+	LockedVertices.AddZeroed(NumVertices);
+
+	ParallelFor(NumGroups, [&](const int32 Group)
+		{
+			int32 NumUniqueVertices = 0;
+			for (int32 GroupIndex = GroupOffsets[Group]; GroupIndex < GroupOffsets[Group + 1]; GroupIndex++)
+			{
+				const int32 VertexIndex = GroupVertices[GroupIndex];
+				Remap[VertexIndex] = VertexIndex;
+				for (int32 OtherGroupIndex = GroupOffsets[Group]; OtherGroupIndex < GroupIndex; OtherGroupIndex++)
+				{
+					const int32 OtherVertexIndex = GroupVertices[OtherGroupIndex];
+					if (Remap[OtherVertexIndex] == OtherVertexIndex && Geometry::AreVerticesEqual(OutPrimitive, VertexIndex, OtherVertexIndex))
+					{
+						Remap[VertexIndex] = OtherVertexIndex;
+						break;
+					}
+				}
+				if (Remap[VertexIndex] == VertexIndex)
+				{
+					NumUniqueVertices++;
+				}
+			}
+
+			if (NumUniqueVertices > 1)
+			{
+				for (int32 GroupIndex = GroupOffsets[Group]; GroupIndex < GroupOffsets[Group + 1]; GroupIndex++)
+				{
+					LockedVertices[GroupVertices[GroupIndex]] = true;
+				}
+			}
+		});
+
+	TArray<uint32> Indices;
+	Indices.AddUninitialized(NumTriangles * 3);
+	for (int32 Index = 0; Index < NumTriangles * 3; Index++)
+	{
+		Indices[Index] = Remap[OutPrimitive.Indices[Index]];
+	}
+
+	// open borders are locked too (edges are matched by position, so attribute seams do not look like borders)
+	TSet<uint64> Edges;
+	Edges.Reserve(NumTriangles * 3);
+	for (int32 Index = 0; Index < NumTriangles * 3; Index++)
+	{
+		const uint32 VertexIndex0 = Indices[Index];
+		const uint32 VertexIndex1 = Indices[(Index % 3) == 2 ? Index - 2 : Index + 1];
+		Edges.Add((static_cast<uint64>(VertexGroups[VertexIndex0]) << 32) | static_cast<uint64>(VertexGroups[VertexIndex1]));
+	}
+
+	TArray<bool> BorderGroups;
+	BorderGroups.AddZeroed(NumGroups);
+	for (const uint64 Edge : Edges)
+	{
+		const uint64 ReversedEdge = (Edge << 32) | (Edge >> 32);
+		if (!Edges.Contains(ReversedEdge))
+		{
+			BorderGroups[static_cast<int32>(Edge >> 32)] = true;
+			BorderGroups[static_cast<int32>(Edge & 0xFFFFFFFF)] = true;
+		}
+	}
+
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		if (BorderGroups[VertexGroups[VertexIndex]])
+		{
+			LockedVertices[VertexIndex] = true;
+		}
+	}
+
+	const int32 TargetNumTriangles = FMath::Max(FMath::RoundToInt(NumTriangles * FMath::Max(TrianglesRatio, 0.0f)), 1);
+
+	TArray<uint32> SimplifiedIndices;
+	SimplifyMesh(OutPrimitive.Positions, Indices, LockedVertices, TargetNumTriangles, SimplifiedIndices);
+
+	// keep only the used vertices
+	TArray<int32> NewToOld;
+	OptimizeVertexFetch(SimplifiedIndices, NumVertices, NewToOld);
+
+	TArray<bool> UsedVertices;
+	UsedVertices.AddZeroed(NumVertices);
+	for (const uint32 Index : SimplifiedIndices)
+	{
+		UsedVertices[Index] = true;
+	}
+	int32 NumUsedVertices = 0;
+	while (NumUsedVertices < NewToOld.Num() && UsedVertices[NumUsedVertices])
+	{
+		NumUsedVertices++;
+	}
+	NewToOld.SetNum(NumUsedVertices);
+
+	RemapPrimitiveVertices(OutPrimitive, NewToOld);
+	OutPrimitive.Indices = MoveTemp(SimplifiedIndices);
+	OutPrimitive.bHasIndices = true;
+}
+
+void glTFRuntime::GenerateSimplifiedLODs(const FglTFRuntimeMeshLOD& LOD, const TArray<float>& TrianglesRatios, TArray<FglTFRuntimeMeshLOD>& OutLODs)
+{
+	OutLODs.SetNum(TrianglesRatios.Num());
+	for (FglTFRuntimeMeshLOD& OutLOD : OutLODs)
+	{
+		OutLOD.AdditionalTransforms = LOD.AdditionalTransforms;
+		OutLOD.Skeleton = LOD.Skeleton;
+		OutLOD.bHasNormals = LOD.bHasNormals;
+		OutLOD.bHasTangents = LOD.bHasTangents;
+		OutLOD.bHasUV = LOD.bHasUV;
+		OutLOD.bHasVertexColors = LOD.bHasVertexColors;
+		OutLOD.Primitives.SetNum(LOD.Primitives.Num());
+	}
+
+	// every LOD and primitive is independent
+	const int32 NumPrimitives = LOD.Primitives.Num();
+	ParallelFor(TrianglesRatios.Num() * NumPrimitives, [&](const int32 Index)
+		{
+			const int32 LODIndex = Index / NumPrimitives;
+			const int32 PrimitiveIndex = Index % NumPrimitives;
+			SimplifyPrimitive(LOD.Primitives[PrimitiveIndex], TrianglesRatios[LODIndex], OutLODs[LODIndex].Primitives[PrimitiveIndex]);
+		});
+}
+
+namespace glTFRuntime
+{
+	namespace Geometry
+	{
+		template<typename T>
+		bool AreStreamValuesNearlyEqual(const TArray<T>& Stream, const int32 A, const int32 B, const float Tolerance)
+		{
+			return !Stream.IsValidIndex(A) || !Stream.IsValidIndex(B) || Stream[A].Equals(Stream[B], Tolerance);
+		}
+
+		bool AreStreamValuesNearlyEqual(const TArray<float>& Stream, const int32 A, const int32 B, const float Tolerance)
+		{
+			return !Stream.IsValidIndex(A) || !Stream.IsValidIndex(B) || FMath::Abs(Stream[A] - Stream[B]) <= Tolerance;
+		}
+
+		// positions are matched by the caller
+		bool AreVerticesNearlyEqual(const FglTFRuntimePrimitive& Primitive, const int32 A, const int32 B, const float Tolerance, const float AttributesTolerance)
+		{
+			if (Primitive.bCompactVertexData)
+			{
+				if (!AreStreamValuesNearlyEqual(Primitive.CompactNormals, A, B, AttributesTolerance) || !AreStreamValuesNearlyEqual(Primitive.CompactTangents, A, B, AttributesTolerance) || !AreStreamValuesNearlyEqual(Primitive.CompactColors, A, B, AttributesTolerance))
+				{
+					return false;
+				}
+				for (const TArray<FglTFRuntimeCompactVector2D>& UV : Primitive.CompactUVs)
+				{
+					if (!AreStreamValuesNearlyEqual(UV, A, B, AttributesTolerance))
+					{
+						return false;
+					}
+				}
+			}
+			else
+			{
+				if (!AreStreamValuesNearlyEqual(Primitive.Normals, A, B, AttributesTolerance) || !AreStreamValuesNearlyEqual(Primitive.Tangents, A, B, AttributesTolerance) || !AreStreamValuesNearlyEqual(Primitive.Colors, A, B, AttributesTolerance))
+				{
+					return false;
+				}
+				for (const TArray<FVector2D>& UV : Primitive.UVs)
+				{
+					if (!AreStreamValuesNearlyEqual(UV, A, B, AttributesTolerance))
+					{
+						return false;
+					}
+				}
+			}
+			for (const TArray<FglTFRuntimeUInt16Vector4>& JointsSet : Primitive.Joints)
+			{
+				if (!AreStreamValuesEqual(JointsSet, A, B))
+				{
+					return false;
+				}
+			}
+			for (const TArray<FVector4>& WeightsSet : Primitive.Weights)
+			{
+				if (!AreStreamValuesNearlyEqual(WeightsSet, A, B, AttributesTolerance))
+				{
+					return false;
+				}
+			}
+			for (const FglTFRuntimeMorphTarget& MorphTarget : Primitive.MorphTargets)
+			{
+				if (!AreStreamValuesNearlyEqual(MorphTarget.Positions, A, B, Tolerance) || !AreStreamValuesNearlyEqual(MorphTarget.Normals, A, B, AttributesTolerance))
+				{
+					return false;
+				}
+			}
+			for (const TPair<FString, TArray<float>>& Pair : Primitive.WeightMaps)
+			{
+				if (!AreStreamValuesNearlyEqual(Pair.Value, A, B, AttributesTolerance))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	}
+}
+
+int32 glTFRuntime::WeldPrimitiveVertices(FglTFRuntimePrimitive& Primitive, const float Tolerance, const float AttributesTolerance)
+{
+	const int32 NumVertices = Primitive.NumVertices();
+	if (NumVertices < 2)
+	{
+		return 0;
+	}
+
+	// bone overrides are tracked per merged section, their vertices cannot be shared
+	if (Primitive.OverrideBoneMap.Num() > 1)
+	{
+		return 0;
+	}
+
+	// normals are generated later from the shared vertices, so a flat shaded primitive would become smooth
+	if ((Primitive.bCompactVertexData ? Primitive.CompactNormals.Num() : Primitive.Normals.Num()) != NumVertices)
+	{
+		return 0;
+	}
+
+	for (const uint32 Index : Primitive.Indices)
+	{
+		if (Index >= static_cast<uint32>(NumVertices))
+		{
+			return 0;
+		}
+	}
+
+	TArray<FVector> Positions;
+	Positions.AddUninitialized(NumVertices);
+	ParallelFor(NumVertices, [&](const int32 VertexIndex)
+		{
+			Positions[VertexIndex] = Primitive.bCompactVertexData ? FVector(Primitive.CompactPositions[VertexIndex]) : Primitive.Positions[VertexIndex];
+		});
+
+	// same grouping of WeldVertices(), with the other attributes compared too
+	TArray<int32> Remap;
+	Geometry::WeldRemap(Positions, Tolerance, [&](const int32 VertexIndex, const int32 OtherVertexIndex)
+		{
+			return Geometry::AreVerticesNearlyEqual(Primitive, VertexIndex, OtherVertexIndex, Tolerance, AttributesTolerance);
+		}, Remap);
+
+	TArray<int32> NewToOld;
+	TArray<int32> OldToNew;
+	OldToNew.AddUninitialized(NumVertices);
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		if (Remap[VertexIndex] == VertexIndex)
+		{
+			OldToNew[VertexIndex] = NewToOld.Add(VertexIndex);
+		}
+	}
+
+	const int32 NumRemovedVertices = NumVertices - NewToOld.Num();
+	if (NumRemovedVertices == 0)
+	{
+		return 0;
+	}
+
+	ParallelFor(FMath::DivideAndRoundUp(Primitive.Indices.Num(), Geometry::BlockSize), [&](const int32 BlockIndex)
+		{
+			const int32 End = FMath::Min((BlockIndex + 1) * Geometry::BlockSize, Primitive.Indices.Num());
+			for (int32 Index = BlockIndex * Geometry::BlockSize; Index < End; Index++)
+			{
+				Primitive.Indices[Index] = OldToNew[Remap[Primitive.Indices[Index]]];
+			}
+		});
+
+	RemapPrimitiveVertices(Primitive, NewToOld);
+
+	// same rule of LoadPrimitive()
+	if (Primitive.NumVertices() < Primitive.Indices.Num())
+	{
+		Primitive.bHasIndices = true;
+	}
+
+	return NumRemovedVertices;
+}
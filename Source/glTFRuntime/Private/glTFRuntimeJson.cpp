@@ -0,0 +1,1062 @@
+// Copyright 2026 - Roberto De Ioris
+
+#include "glTFRuntimeParser.h"
+
+EglTFRuntimeJsonSection FglTFRuntimeJsonTables::GetSection(const FString& FieldName)
+{
+	if (FieldName == TEXT("accessors"))
+	{
+		return EglTFRuntimeJsonSection::Accessors;
+	}
+	else if (FieldName == TEXT("bufferViews"))
+	{
+		return EglTFRuntimeJsonSection::BufferViews;
+	}
+	else if (FieldName == TEXT("nodes"))
+	{
+		return EglTFRuntimeJsonSection::Nodes;
+	}
+	return EglTFRuntimeJsonSection::None;
+}
+
+void FglTFRuntimeJsonTables::AddItem(const EglTFRuntimeJsonSection Section)
+{
+	switch (Section)
+	{
+	case EglTFRuntimeJsonSection::Accessors:
+		Accessors.AddDefaulted();
+		break;
+	case EglTFRuntimeJsonSection::BufferViews:
+		BufferViews.AddDefaulted();
+		break;
+	case EglTFRuntimeJsonSection::Nodes:
+		Nodes.AddDefaulted();
+		break;
+	default:
+		break;
+	}
+}
+
+// same conversions of the FJsonObject TryGet* functions
+void FglTFRuntimeJsonTables::SetItemField(const EglTFRuntimeJsonSection Section, const FString& FieldName, const FJsonValue& JsonValue)
+{
+	switch (Section)
+	{
+	case EglTFRuntimeJsonSection::Accessors:
+	{
+		FglTFRuntimeJsonAccessor& Accessor = Accessors.Last();
+		if (FieldName == TEXT("bufferView"))
+		{
+			JsonValue.TryGetNumber(Accessor.BufferView);
+		}
+		else if (FieldName == TEXT("byteOffset"))
+		{
+			JsonValue.TryGetNumber(Accessor.ByteOffset);
+		}
+		else if (FieldName == TEXT("componentType"))
+		{
+			JsonValue.TryGetNumber(Accessor.ComponentType);
+		}
+		else if (FieldName == TEXT("count"))
+		{
+			JsonValue.TryGetNumber(Accessor.Count);
+		}
+		else if (FieldName == TEXT("type"))
+		{
+			FString Type;
+			if (JsonValue.TryGetString(Type))
+			{
+				if (Type == TEXT("SCALAR"))
+				{
+					Accessor.Elements = 1;
+				}
+				else if (Type == TEXT("VEC2"))
+				{
+					Accessor.Elements = 2;
+				}
+				else if (Type == TEXT("VEC3"))
+				{
+					Accessor.Elements = 3;
+				}
+				else if (Type == TEXT("VEC4") || Type == TEXT("MAT2"))
+				{
+					Accessor.Elements = 4;
+				}
+				else if (Type == TEXT("MAT3"))
+				{
+					Accessor.Elements = 9;
+				}
+				else if (Type == TEXT("MAT4"))
+				{
+					Accessor.Elements = 16;
+				}
+			}
+		}
+		else if (FieldName == TEXT("normalized"))
+		{
+			Accessor.bHasNormalized = JsonValue.TryGetBool(Accessor.bNormalized);
+		}
+		else if (FieldName == TEXT("sparse"))
+		{
+			Accessor.bSparse = JsonValue.Type == EJson::Object;
+		}
+		break;
+	}
+	case EglTFRuntimeJsonSection::BufferViews:
+	{
+		FglTFRuntimeJsonBufferView& BufferView = BufferViews.Last();
+		if (FieldName == TEXT("buffer"))
+		{
+			JsonValue.TryGetNumber(BufferView.Buffer);
+		}
+		else if (FieldName == TEXT("byteOffset"))
+		{
+			JsonValue.TryGetNumber(BufferView.ByteOffset);
+		}
+		else if (FieldName == TEXT("byteLength"))
+		{
+			JsonValue.TryGetNumber(BufferView.ByteLength);
+		}
+		else if (FieldName == TEXT("byteStride"))
+		{
+			JsonValue.TryGetNumber(BufferView.ByteStride);
+		}
+		else if (FieldName == TEXT("target"))
+		{
+			JsonValue.TryGetNumber(BufferView.Target);
+		}
+		else if (FieldName == TEXT("extensions"))
+		{
+			BufferView.bHasExtensions = JsonValue.Type == EJson::Object;
+		}
+		break;
+	}
+	case EglTFRuntimeJsonSection::Nodes:
+	{
+		FglTFRuntimeJsonNode& Node = Nodes.Last();
+		if (FieldName == TEXT("mesh"))
+		{
+			JsonValue.TryGetNumber(Node.Mesh);
+		}
+		else if (FieldName == TEXT("skin"))
+		{
+			JsonValue.TryGetNumber(Node.Skin);
+		}
+		else if (FieldName == TEXT("camera"))
+		{
+			JsonValue.TryGetNumber(Node.Camera);
+		}
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+void FglTFRuntimeJsonTables::FillFromJsonObject(TSharedRef<FJsonObject> JsonObject)
+{
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : JsonObject->Values)
+	{
+		const EglTFRuntimeJsonSection Section = GetSection(Pair.Key);
+		const TArray<TSharedPtr<FJsonValue>>* JsonItems;
+		if ((Section != EglTFRuntimeJsonSection::Accessors && Section != EglTFRuntimeJsonSection::BufferViews) || !Pair.Value.IsValid() || !Pair.Value->TryGetArray(JsonItems))
+		{
+			continue;
+		}
+
+		for (const TSharedPtr<FJsonValue>& JsonItem : *JsonItems)
+		{
+			AddItem(Section);
+			if (JsonItem.IsValid() && JsonItem->Type == EJson::Object)
+			{
+				for (const TPair<FString, TSharedPtr<FJsonValue>>& ItemPair : JsonItem->AsObject()->Values)
+				{
+					if (ItemPair.Value.IsValid())
+					{
+						SetItemField(Section, ItemPair.Key, *ItemPair.Value);
+					}
+				}
+			}
+		}
+	}
+}
+
+const FglTFRuntimeJsonDeferredSection* FglTFRuntimeJsonTables::FindDeferredSection(const FString& FieldName) const
+{
+	for (const FglTFRuntimeJsonDeferredSection& DeferredSection : DeferredSections)
+	{
+		if (DeferredSection.FieldName == FieldName)
+		{
+			return &DeferredSection;
+		}
+	}
+	return nullptr;
+}
+
+namespace glTFRuntime
+{
+	namespace Json
+	{
+		constexpr int32 MaxDepth = 512;
+
+		class FUTF8Parser
+		{
+		public:
+			// without tables every value is built (deferred items)
+			FUTF8Parser(const uint8* InDataPtr, const int64 InDataNum, FglTFRuntimeJsonTables* InJsonTables) : DataPtr(InDataPtr), DataNum(InDataNum), Position(0), JsonTables(InJsonTables)
+			{
+			}
+
+			bool Parse(TSharedPtr<FJsonObject>& JsonObject)
+			{
+				// BOM
+				if (DataNum >= 3 && DataPtr[0] == 0xEF && DataPtr[1] == 0xBB && DataPtr[2] == 0xBF)
+				{
+					Position = 3;
+				}
+
+				SkipWhitespaces();
+				if (!Consume('{'))
+				{
+					return false;
+				}
+
+				JsonObject = MakeShared<FJsonObject>();
+				if (!ParseObject(*JsonObject, 1, true))
+				{
+					return false;
+				}
+
+				// binary chunks could be padded with zeros
+				while (Position < DataNum && (IsWhitespace(DataPtr[Position]) || DataPtr[Position] == 0))
+				{
+					Position++;
+				}
+
+				return Position == DataNum;
+			}
+
+			// an item of a top level array, at the same depth of the whole document parsing
+			bool ParseItem(TSharedPtr<FJsonValue>& JsonValue)
+			{
+				if (!ParseValue(JsonValue, 2))
+				{
+					return false;
+				}
+				SkipWhitespaces();
+				return Position == DataNum;
+			}
+
+			int64 GetPosition() const
+			{
+				return Position;
+			}
+
+		private:
+			const uint8* DataPtr;
+			const int64 DataNum;
+			int64 Position;
+			FglTFRuntimeJsonTables* JsonTables;
+			// unescaped strings and numbers
+			TArray<ANSICHAR> Scratch;
+			// strings of the scanned items, overwritten by every field
+			FString ScanFieldName;
+			FString ScanString;
+
+			static bool IsWhitespace(const uint8 Char)
+			{
+				return Char == ' ' || Char == '\t' || Char == '\n' || Char == '\r';
+			}
+
+			static bool IsDigit(const uint8 Char)
+			{
+				return Char >= '0' && Char <= '9';
+			}
+
+			void SkipWhitespaces()
+			{
+				while (Position < DataNum && IsWhitespace(DataPtr[Position]))
+				{
+					Position++;
+				}
+			}
+
+			bool Consume(const uint8 Char)
+			{
+				if (Position < DataNum && DataPtr[Position] == Char)
+				{
+					Position++;
+					return true;
+				}
+				return false;
+			}
+
+			bool ConsumeLiteral(const ANSICHAR* Literal, const int64 Len)
+			{
+				if (Position + Len > DataNum || FMemory::Memcmp(DataPtr + Position, Literal, Len) != 0)
+				{
+					return false;
+				}
+				Position += Len;
+				return true;
+			}
+
+			bool ParseObject(FJsonObject& JsonObject, const int32 Depth, const bool bRoot)
+			{
+				SkipWhitespaces();
+				if (Consume('}'))
+				{
+					return true;
+				}
+
+				while (true)
+				{
+					SkipWhitespaces();
+					FString FieldName;
+					if (!ParseString(FieldName))
+					{
+						return false;
+					}
+
+					SkipWhitespaces();
+					if (!Consume(':'))
+					{
+						return false;
+					}
+
+					SkipWhitespaces();
+					TSharedPtr<FJsonValue> JsonValue;
+					const EglTFRuntimeJsonSection Section = bRoot && JsonTables ? FglTFRuntimeJsonTables::GetSection(FieldName) : EglTFRuntimeJsonSection::None;
+					if (Section != EglTFRuntimeJsonSection::None && Position < DataNum && DataPtr[Position] == '[')
+					{
+						if (!DeferSection(Section, FieldName, Depth))
+						{
+							return false;
+						}
+						JsonValue = MakeShared<FJsonValueNull>();
+					}
+					else if (!ParseValue(JsonValue, Depth))
+					{
+						return false;
+					}
+
+					JsonObject.Values.Add(MoveTemp(FieldName), MoveTemp(JsonValue));
+
+					SkipWhitespaces();
+					if (Consume(','))
+					{
+						continue;
+					}
+					return Consume('}');
+				}
+			}
+
+			bool ParseArray(TArray<TSharedPtr<FJsonValue>>& JsonItems, const int32 Depth)
+			{
+				SkipWhitespaces();
+				if (Consume(']'))
+				{
+					return true;
+				}
+
+				while (true)
+				{
+					SkipWhitespaces();
+					TSharedPtr<FJsonValue> JsonItem;
+					if (!ParseValue(JsonItem, Depth))
+					{
+						return false;
+					}
+
+					JsonItems.Add(MoveTemp(JsonItem));
+
+					SkipWhitespaces();
+					if (Consume(','))
+					{
+						continue;
+					}
+					return Consume(']');
+				}
+			}
+
+			bool ParseValue(TSharedPtr<FJsonValue>& JsonValue, const int32 Depth)
+			{
+				if (Position >= DataNum)
+				{
+					return false;
+				}
+
+				const uint8 Char = DataPtr[Position];
+				if (Char == '{' || Char == '[')
+				{
+					if (Depth + 1 > MaxDepth)
+					{
+						return false;
+					}
+
+					Position++;
+					if (Char == '{')
+					{
+						TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+						if (!ParseObject(*JsonObject, Depth + 1, false))
+						{
+							return false;
+						}
+						JsonValue = MakeShared<FJsonValueObject>(JsonObject);
+						return true;
+					}
+
+					TArray<TSharedPtr<FJsonValue>> JsonItems;
+					if (!ParseArray(JsonItems, Depth + 1))
+					{
+						return false;
+					}
+					JsonValue = MakeShared<FJsonValueArray>(MoveTemp(JsonItems));
+					return true;
+				}
+				else if (Char == '"')
+				{
+					FString String;
+					if (!ParseString(String))
+					{
+						return false;
+					}
+					JsonValue = MakeShared<FJsonValueString>(MoveTemp(String));
+					return true;
+				}
+				else if (Char == 't')
+				{
+					JsonValue = MakeShared<FJsonValueBoolean>(true);
+					return ConsumeLiteral("true", 4);
+				}
+				else if (Char == 'f')
+				{
+					JsonValue = MakeShared<FJsonValueBoolean>(false);
+					return ConsumeLiteral("false", 5);
+				}
+				else if (Char == 'n')
+				{
+					JsonValue = MakeShared<FJsonValueNull>();
+					return ConsumeLiteral("null", 4);
+				}
+
+				double Number = 0;
+				if (!ParseNumber(Number))
+				{
+					return false;
+				}
+				JsonValue = MakeShared<FJsonValueNumber>(Number);
+				return true;
+			}
+
+			// fills the table of a top level array and records the source ranges of its items, no json value is built
+			bool DeferSection(const EglTFRuntimeJsonSection Section, const FString& FieldName, const int32 Depth)
+			{
+				if (Depth + 1 > MaxDepth)
+				{
+					return false;
+				}
+
+				const int64 Start = Position++;
+				const int64 SourceOffset = JsonTables->Source.Num() - Start;
+
+				FglTFRuntimeJsonDeferredSection& DeferredSection = JsonTables->DeferredSections.AddDefaulted_GetRef();
+				DeferredSection.Section = Section;
+				DeferredSection.FieldName = FieldName;
+
+				SkipWhitespaces();
+				if (!Consume(']'))
+				{
+					while (true)
+					{
+						SkipWhitespaces();
+						JsonTables->AddItem(Section);
+						const int64 ItemStart = Position;
+						if (Position < DataNum && DataPtr[Position] == '{')
+						{
+							if (Depth + 2 > MaxDepth)
+							{
+								return false;
+							}
+							Position++;
+							if (!ScanObject(Section, Depth + 2))
+							{
+								return false;
+							}
+						}
+						else if (!SkipValue(Depth + 1))
+						{
+							return false;
+						}
+
+						FglTFRuntimeJsonItemRange& Item = DeferredSection.Items.AddDefaulted_GetRef();
+						Item.Offset = SourceOffset + ItemStart;
+						Item.Size = Position - ItemStart;
+
+						SkipWhitespaces();
+						if (Consume(','))
+						{
+							continue;
+						}
+						if (!Consume(']'))
+						{
+							return false;
+						}
+						break;
+					}
+				}
+
+				JsonTables->Source.Append(DataPtr + Start, Position - Start);
+				return true;
+			}
+
+			// fills the last item of the section table, nested values are only validated
+			bool ScanObject(const EglTFRuntimeJsonSection Section, const int32 Depth)
+			{
+				SkipWhitespaces();
+				if (Consume('}'))
+				{
+					return true;
+				}
+
+				while (true)
+				{
+					SkipWhitespaces();
+					if (!ParseString(ScanFieldName))
+					{
+						return false;
+					}
+
+					SkipWhitespaces();
+					if (!Consume(':'))
+					{
+						return false;
+					}
+
+					SkipWhitespaces();
+					if (Position >= DataNum)
+					{
+						return false;
+					}
+
+					const uint8 Char = DataPtr[Position];
+					if (Char == '{')
+					{
+						if (!SkipValue(Depth))
+						{
+							return false;
+						}
+						JsonTables->SetItemField(Section, ScanFieldName, FJsonValueObject(nullptr));
+					}
+					else if (Char == '[')
+					{
+						if (!SkipValue(Depth))
+						{
+							return false;
+						}
+						JsonTables->SetItemField(Section, ScanFieldName, FJsonValueArray(TArray<TSharedPtr<FJsonValue>>()));
+					}
+					else if (Char == '"')
+					{
+						if (!ParseString(ScanString))
+						{
+							return false;
+						}
+						JsonTables->SetItemField(Section, ScanFieldName, FJsonValueString(ScanString));
+					}
+					else if (Char == 't' || Char == 'f')
+					{
+						const bool bValue = Char == 't';
+						if (!(bValue ? ConsumeLiteral("true", 4) : ConsumeLiteral("false", 5)))
+						{
+							return false;
+						}
+						JsonTables->SetItemField(Section, ScanFieldName, FJsonValueBoolean(bValue));
+					}
+					else if (Char == 'n')
+					{
+						if (!ConsumeLiteral("null", 4))
+						{
+							return false;
+						}
+					}
+					else
+					{
+						double Number = 0;
+						if (!ParseNumber(Number))
+						{
+							return false;
+						}
+						JsonTables->SetItemField(Section, ScanFieldName, FJsonValueNumber(Number));
+					}
+
+					SkipWhitespaces();
+					if (Consume(','))
+					{
+						continue;
+					}
+					return Consume('}');
+				}
+			}
+
+			// same grammar and depth limit of ParseValue
+			bool SkipValue(const int32 Depth)
+			{
+				if (Position >= DataNum)
+				{
+					return false;
+				}
+
+				const uint8 Char = DataPtr[Position];
+				if (Char == '{' || Char == '[')
+				{
+					if (Depth + 1 > MaxDepth)
+					{
+						return false;
+					}
+
+					Position++;
+					const uint8 CloseChar = Char == '{' ? '}' : ']';
+					SkipWhitespaces();
+					if (Consume(CloseChar))
+					{
+						return true;
+					}
+
+					while (true)
+					{
+						SkipWhitespaces();
+						if (Char == '{')
+						{
+							if (!ParseString(ScanString))
+							{
+								return false;
+							}
+							SkipWhitespaces();
+							if (!Consume(':'))
+							{
+								return false;
+							}
+							SkipWhitespaces();
+						}
+
+						if (!SkipValue(Depth + 1))
+						{
+							return false;
+						}
+
+						SkipWhitespaces();
+						if (Consume(','))
+						{
+							continue;
+						}
+						return Consume(CloseChar);
+					}
+				}
+				else if (Char == '"')
+				{
+					return ParseString(ScanString);
+				}
+				else if (Char == 't')
+				{
+					return ConsumeLiteral("true", 4);
+				}
+				else if (Char == 'f')
+				{
+					return ConsumeLiteral("false", 5);
+				}
+				else if (Char == 'n')
+				{
+					return ConsumeLiteral("null", 4);
+				}
+
+				double Number = 0;
+				return ParseNumber(Number);
+			}
+
+			bool ParseNumber(double& Number)
+			{
+				const int64 Start = Position;
+				const bool bNegative = Consume('-');
+
+				if (Position >= DataNum || !IsDigit(DataPtr[Position]))
+				{
+					return false;
+				}
+
+				uint64 Mantissa = 0;
+				int32 Digits = 0;
+				if (!Consume('0'))
+				{
+					while (Position < DataNum && IsDigit(DataPtr[Position]))
+					{
+						Mantissa = Mantissa * 10 + (DataPtr[Position++] - '0');
+						Digits++;
+					}
+				}
+
+				bool bInteger = true;
+				if (Consume('.'))
+				{
+					bInteger = false;
+					if (Position >= DataNum || !IsDigit(DataPtr[Position]))
+					{
+						return false;
+					}
+					while (Position < DataNum && IsDigit(DataPtr[Position]))
+					{
+						Position++;
+					}
+				}
+
+				if (Consume('e') || Consume('E'))
+				{
+					bInteger = false;
+					if (!Consume('+'))
+					{
+						Consume('-');
+					}
+					if (Position >= DataNum || !IsDigit(DataPtr[Position]))
+					{
+						return false;
+					}
+					while (Position < DataNum && IsDigit(DataPtr[Position]))
+					{
+						Position++;
+					}
+				}
+
+				// integers (indices, counts, offsets...) up to 15 digits are exactly representable
+				if (bInteger && Digits <= 15)
+				{
+					Number = bNegative ? -static_cast<double>(Mantissa) : static_cast<double>(Mantissa);
+					return true;
+				}
+
+				// let the C runtime do the correct rounding
+				Scratch.Reset();
+				Scratch.Append(reinterpret_cast<const ANSICHAR*>(DataPtr + Start), static_cast<int32>(Position - Start));
+				Scratch.Add(0);
+				Number = FCStringAnsi::Atod(Scratch.GetData());
+				return true;
+			}
+
+			static void AppendUTF8(TArray<ANSICHAR>& Output, const uint32 CodePoint)
+			{
+				if (CodePoint < 0x80)
+				{
+					Output.Add(static_cast<ANSICHAR>(CodePoint));
+				}
+				else if (CodePoint < 0x800)
+				{
+					Output.Add(static_cast<ANSICHAR>(0xC0 | (CodePoint >> 6)));
+					Output.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+				}
+				else if (CodePoint < 0x10000)
+				{
+					Output.Add(static_cast<ANSICHAR>(0xE0 | (CodePoint >> 12)));
+					Output.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+					Output.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+				}
+				else
+				{
+					Output.Add(static_cast<ANSICHAR>(0xF0 | (CodePoint >> 18)));
+					Output.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 12) & 0x3F)));
+					Output.Add(static_cast<ANSICHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+					Output.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+				}
+			}
+
+			bool ParseHex4(uint32& Value)
+			{
+				if (Position + 4 > DataNum)
+				{
+					return false;
+				}
+
+				Value = 0;
+				for (int32 Index = 0; Index < 4; Index++)
+				{
+					const uint8 Char = DataPtr[Position++];
+					Value <<= 4;
+					if (IsDigit(Char))
+					{
+						Value |= Char - '0';
+					}
+					else if (Char >= 'a' && Char <= 'f')
+					{
+						Value |= Char - 'a' + 10;
+					}
+					else if (Char >= 'A' && Char <= 'F')
+					{
+						Value |= Char - 'A' + 10;
+					}
+					else
+					{
+						return false;
+					}
+				}
+				return true;
+			}
+
+			static void SetString(FString& String, const ANSICHAR* Chars, const int64 Len, const bool bASCII)
+			{
+				if (bASCII)
+				{
+					String = FString(static_cast<int32>(Len), Chars);
+				}
+				else
+				{
+					FUTF8ToTCHAR Converter(Chars, static_cast<int32>(Len));
+					String = FString(Converter.Length(), Converter.Get());
+				}
+			}
+
+			bool ParseString(FString& String)
+			{
+				if (!Consume('"'))
+				{
+					return false;
+				}
+
+				// common case: no escapes, converted straight from the source bytes
+				const int64 Start = Position;
+				uint8 HighBits = 0;
+				while (Position < DataNum && DataPtr[Position] != '"' && DataPtr[Position] != '\\')
+				{
+					HighBits |= DataPtr[Position];
+					Position++;
+				}
+
+				if (Position >= DataNum || Position - Start > MAX_int32)
+				{
+					return false;
+				}
+
+				if (DataPtr[Position] == '"')
+				{
+					SetString(String, reinterpret_cast<const ANSICHAR*>(DataPtr + Start), Position - Start, (HighBits & 0x80) == 0);
+					Position++;
+					return true;
+				}
+
+				Scratch.Reset();
+				Scratch.Append(reinterpret_cast<const ANSICHAR*>(DataPtr + Start), static_cast<int32>(Position - Start));
+
+				while (true)
+				{
+					if (Position >= DataNum)
+					{
+						return false;
+					}
+
+					const uint8 Char = DataPtr[Position++];
+					if (Char == '"')
+					{
+						break;
+					}
+
+					HighBits |= Char;
+
+					if (Char != '\\')
+					{
+						Scratch.Add(static_cast<ANSICHAR>(Char));
+						continue;
+					}
+
+					if (Position >= DataNum)
+					{
+						return false;
+					}
+
+					const uint8 Escape = DataPtr[Position++];
+					switch (Escape)
+					{
+					case '"':
+					case '\\':
+					case '/':
+						Scratch.Add(static_cast<ANSICHAR>(Escape));
+						break;
+					case 'b':
+						Scratch.Add('\b');
+						break;
+					case 'f':
+						Scratch.Add('\f');
+						break;
+					case 'n':
+						Scratch.Add('\n');
+						break;
+					case 'r':
+						Scratch.Add('\r');
+						break;
+					case 't':
+						Scratch.Add('\t');
+						break;
+					case 'u':
+					{
+						uint32 CodePoint = 0;
+						if (!ParseHex4(CodePoint))
+						{
+							return false;
+						}
+
+						// surrogate pair
+						if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && Position + 1 < DataNum && DataPtr[Position] == '\\' && DataPtr[Position + 1] == 'u')
+						{
+							Position += 2;
+							uint32 LowSurrogate = 0;
+							if (!ParseHex4(LowSurrogate) || LowSurrogate < 0xDC00 || LowSurrogate > 0xDFFF)
+							{
+								return false;
+							}
+							CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+						}
+
+						if (CodePoint >= 0x80)
+						{
+							HighBits |= 0x80;
+						}
+						AppendUTF8(Scratch, CodePoint);
+						break;
+					}
+					default:
+						return false;
+					}
+				}
+
+				if (Scratch.Num() > MAX_int32)
+				{
+					return false;
+				}
+
+				SetString(String, Scratch.GetData(), Scratch.Num(), (HighBits & 0x80) == 0);
+				return true;
+			}
+		};
+	}
+
+	bool ParseJson(const uint8* DataPtr, const int64 DataNum, TSharedPtr<FJsonObject>& JsonObject, FglTFRuntimeJsonTables& JsonTables)
+	{
+		SCOPED_NAMED_EVENT(glTFRuntime_ParseJson, FColor::Magenta);
+
+		Json::FUTF8Parser Parser(DataPtr, DataNum, &JsonTables);
+		if (!Parser.Parse(JsonObject))
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid json at offset %lld."), static_cast<long long>(Parser.GetPosition()));
+			JsonObject = nullptr;
+			return false;
+		}
+
+		return true;
+	}
+}
+
+bool FglTFRuntimeParser::GetJsonObjectUri(TSharedRef<FJsonObject> JsonObject, FString& OutUri) const
+{
+	const TSharedPtr<FJsonValue>* JsonValue = JsonObject->Values.Find(TEXT("uri"));
+	if (!JsonValue || !JsonValue.IsValid() || (*JsonValue)->Type != EJson::String)
+	{
+		return false;
+	}
+
+	OutUri = (*JsonValue)->AsString();
+	return true;
+}
+
+TSharedPtr<FJsonValue> FglTFRuntimeParser::GetDeferredJsonValue(const FglTFRuntimeJsonDeferredSection& DeferredSection, const int32 Index) const
+{
+	if (!DeferredSection.Items.IsValidIndex(Index))
+	{
+		return nullptr;
+	}
+
+	FScopeLock Lock(&DeferredJsonLock);
+	if (DeferredSection.Values.Num() != DeferredSection.Items.Num())
+	{
+		DeferredSection.Values.SetNum(DeferredSection.Items.Num());
+	}
+
+	TSharedPtr<FJsonValue>& JsonValue = DeferredSection.Values[Index];
+	if (!JsonValue)
+	{
+		// already validated by the first parsing
+		const FglTFRuntimeJsonItemRange& Item = DeferredSection.Items[Index];
+		glTFRuntime::Json::FUTF8Parser Parser(JsonTables.Source.GetData() + Item.Offset, Item.Size, nullptr);
+		if (!Parser.ParseItem(JsonValue))
+		{
+			JsonValue = MakeShared<FJsonValueNull>();
+		}
+	}
+
+	return JsonValue;
+}
+
+void FglTFRuntimeParser::MaterializeJsonSection(const FString& FieldName) const
+{
+	if (bJsonSectionsMaterialized)
+	{
+		return;
+	}
+
+	const FglTFRuntimeJsonDeferredSection* DeferredSection = JsonTables.FindDeferredSection(FieldName);
+	if (!DeferredSection)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&DeferredJsonLock);
+	if (DeferredSection->bMaterialized)
+	{
+		return;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> JsonItems;
+	JsonItems.Reserve(DeferredSection->Items.Num());
+	for (int32 Index = 0; Index < DeferredSection->Items.Num(); Index++)
+	{
+		JsonItems.Add(GetDeferredJsonValue(*DeferredSection, Index));
+	}
+
+	// the field already exists, so the root map is never reallocated while other threads read it
+	if (TSharedPtr<FJsonValue>* JsonValue = Root->Values.Find(FieldName))
+	{
+		*JsonValue = MakeShared<FJsonValueArray>(MoveTemp(JsonItems));
+	}
+	DeferredSection->bMaterialized = true;
+}
+
+void FglTFRuntimeParser::MaterializeJsonSections() const
+{
+	if (bJsonSectionsMaterialized)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&DeferredJsonLock);
+	for (const FglTFRuntimeJsonDeferredSection& DeferredSection : JsonTables.DeferredSections)
+	{
+		MaterializeJsonSection(DeferredSection.FieldName);
+	}
+	bJsonSectionsMaterialized = true;
+}
+
+TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonRoot() const
+{
+	MaterializeJsonSections();
+	return Root;
+}
+
+TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonObjectFromRootIndex(const FString& FieldName, const int32 Index) const
+{
+	if (const FglTFRuntimeJsonDeferredSection* DeferredSection = JsonTables.FindDeferredSection(FieldName))
+	{
+		TSharedPtr<FJsonValue> JsonValue = GetDeferredJsonValue(*DeferredSection, Index);
+		if (!JsonValue || JsonValue->Type != EJson::Object)
+		{
+			return nullptr;
+		}
+		return JsonValue->AsObject();
+	}
+
+	return GetJsonObjectFromIndex(Root, FieldName, Index);
+}
@@ -5,6 +5,8 @@
 #include "Runtime/Launch/Resources/Version.h"
 #include "Engine/Texture2D.h"
 #include "GenericPlatform/GenericPlatformHttp.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
 #include "Misc/FileHelper.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -15,10 +17,13 @@
 #else
 #include "MaterialShared.h"
 #endif
-#include "Misc/Base64.h"
 #include "Misc/Compression.h"
 #include "Misc/Crc.h"
 #include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 #include "Interfaces/IPluginManager.h"
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 2
 #include "RenderMath.h"
@@ -28,6 +33,10 @@
 
 #include "glTFRuntimeAssetUserData.h"
 
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
 DEFINE_LOG_CATEGORY(LogGLTFRuntime);
 
 FglTFRuntimeOnPreLoadedPrimitive FglTFRuntimeParser::OnPreLoadedPrimitive;
@@ -45,6 +54,457 @@ FglTFRuntimeOnPostCreatedStaticMesh FglTFRuntimeParser::OnPostCreatedStaticMesh;
 FglTFRuntimeOnPreInitStaticMeshResources FglTFRuntimeParser::OnPreInitStaticMeshResources;
 FglTFRuntimeOnPreCreatedSkeletalMesh FglTFRuntimeParser::OnPreCreatedSkeletalMesh;
 
+namespace glTFRuntime
+{
+	// parses the header of the gzip member at MemberOffset, BgzfBlockSize is the whole member size (0 if the member is not a BGZF block)
+	bool ParseGzipMemberHeader(const uint8* DataPtr, const int64 DataNum, const int64 MemberOffset, int64& DeflateOffset, int64& BgzfBlockSize)
+	{
+		BgzfBlockSize = 0;
+
+		if (MemberOffset + 18 > DataNum || DataPtr[MemberOffset] != 0x1F || DataPtr[MemberOffset + 1] != 0x8B || DataPtr[MemberOffset + 2] != 0x08)
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip member header at offset %lld."), static_cast<long long>(MemberOffset));
+			return false;
+		}
+
+		const uint8 Flags = DataPtr[MemberOffset + 3];
+		int64 StartOfBuffer = MemberOffset + 10;
+
+		// FEXTRA
+		if (Flags & 0x04)
+		{
+			if (StartOfBuffer + 2 >= DataNum)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FEXTRA header."));
+				return false;
+			}
+			const int64 FExtraXLen = DataPtr[StartOfBuffer] | (DataPtr[StartOfBuffer + 1] << 8);
+			const int64 FExtraOffset = StartOfBuffer + 2;
+			StartOfBuffer = FExtraOffset + FExtraXLen;
+			if (StartOfBuffer >= DataNum)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FEXTRA XLEN."));
+				return false;
+			}
+
+			// BGZF: 'BC' subfield with the total block size minus 1
+			int64 SubFieldOffset = FExtraOffset;
+			while (SubFieldOffset + 4 <= StartOfBuffer)
+			{
+				const int64 SubFieldLen = DataPtr[SubFieldOffset + 2] | (DataPtr[SubFieldOffset + 3] << 8);
+				if (DataPtr[SubFieldOffset] == 'B' && DataPtr[SubFieldOffset + 1] == 'C' && SubFieldLen == 2 && SubFieldOffset + 6 <= StartOfBuffer)
+				{
+					BgzfBlockSize = (DataPtr[SubFieldOffset + 4] | (DataPtr[SubFieldOffset + 5] << 8)) + 1;
+				}
+				SubFieldOffset += 4 + SubFieldLen;
+			}
+		}
+
+		// FNAME
+		if (Flags & 0x08)
+		{
+			while (DataPtr[StartOfBuffer] != 0)
+			{
+				StartOfBuffer++;
+				if (StartOfBuffer >= DataNum)
+				{
+					UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FNAME header."));
+					return false;
+				}
+			}
+			if (++StartOfBuffer >= DataNum)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FNAME header."));
+				return false;
+			}
+		}
+
+		// FCOMMENT
+		if (Flags & 0x10)
+		{
+			while (DataPtr[StartOfBuffer] != 0)
+			{
+				StartOfBuffer++;
+				if (StartOfBuffer >= DataNum)
+				{
+					UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FCOMMENT header."));
+					return false;
+				}
+			}
+			if (++StartOfBuffer >= DataNum)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FCOMMENT header."));
+				return false;
+			}
+		}
+
+		// FHCRC
+		if (Flags & 0x02)
+		{
+			if (StartOfBuffer + 2 >= DataNum)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FHCRC header."));
+				return false;
+			}
+			StartOfBuffer += 2;
+		}
+
+		if (BgzfBlockSize > 0 && (BgzfBlockSize < StartOfBuffer - MemberOffset + 8 || MemberOffset + BgzfBlockSize > DataNum))
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid BGZF block size at offset %lld."), static_cast<long long>(MemberOffset));
+			return false;
+		}
+
+		DeflateOffset = StartOfBuffer;
+		return true;
+	}
+
+	// side index in the bgzip .gzi layout: uint64 count followed by (compressed offset, uncompressed offset) uint64 pairs, the first member is implicit
+	bool LoadGzipIndex(const FString& Filename, const int64 DataNum, TArray<int64>& MembersOffsets)
+	{
+		TArray64<uint8> IndexData;
+		if (!FFileHelper::LoadFileToArray(IndexData, *Filename) || IndexData.Num() < 8)
+		{
+			return false;
+		}
+
+		uint64 NumEntries = 0;
+		FMemory::Memcpy(&NumEntries, IndexData.GetData(), 8);
+		if (NumEntries > static_cast<uint64>((IndexData.Num() - 8) / 16))
+		{
+			return false;
+		}
+
+		int64 PreviousOffset = 0;
+		for (uint64 EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
+		{
+			uint64 CompressedOffset = 0;
+			FMemory::Memcpy(&CompressedOffset, IndexData.GetData() + 8 + EntryIndex * 16, 8);
+			if (static_cast<int64>(CompressedOffset) <= PreviousOffset || CompressedOffset >= static_cast<uint64>(DataNum))
+			{
+				MembersOffsets.Empty();
+				return false;
+			}
+			MembersOffsets.Add(static_cast<int64>(CompressedOffset));
+			PreviousOffset = static_cast<int64>(CompressedOffset);
+		}
+
+		return true;
+	}
+
+	// Decompression-bomb guard (untrusted input): gzip wraps DEFLATE (RFC 1952 / RFC 1951),
+	// whose maximum expansion is 1032:1, so an output larger than the compressed payload
+	// could produce is malformed/malicious.
+	constexpr uint64 GzipMaxDeflateExpansion = 1032;
+
+	// inflates all the members one after the other, required when the members boundaries are unknown
+	bool GzipDecompressSequential(const uint8* DataPtr, const int64 DataNum, TArray64<uint8>& UncompressedData)
+	{
+		const uint64 MaxPlausibleOutput = static_cast<uint64>(DataNum) * GzipMaxDeflateExpansion;
+		// ISIZE of the last member is a good hint for single member files
+		uint32 LastMemberSize = 0;
+		FMemory::Memcpy(&LastMemberSize, DataPtr + DataNum - 4, 4);
+		const int64 ChunkSize = 64 * 1024;
+		constexpr int64 MaxZlibChunk = 1024 * 1024 * 1024;
+
+		UncompressedData.SetNumUninitialized(FMath::Max<int64>(FMath::Min<uint64>(LastMemberSize, MaxPlausibleOutput), ChunkSize));
+
+		z_stream Stream;
+		FMemory::Memzero(Stream);
+		// 16 + MAX_WBITS enables the gzip wrapper
+		if (inflateInit2(&Stream, 16 + MAX_WBITS) != Z_OK)
+		{
+			return false;
+		}
+
+		bool bSuccess = false;
+		int64 InOffset = 0;
+		int64 OutOffset = 0;
+
+		while (true)
+		{
+			if (Stream.avail_in == 0 && InOffset < DataNum)
+			{
+				const int64 InSize = FMath::Min(DataNum - InOffset, MaxZlibChunk);
+				Stream.next_in = const_cast<uint8*>(DataPtr + InOffset);
+				Stream.avail_in = static_cast<uInt>(InSize);
+				InOffset += InSize;
+			}
+
+			// never grow past the plausible output (one more byte allows detecting the overflow)
+			if (UncompressedData.Num() - OutOffset < ChunkSize && static_cast<uint64>(UncompressedData.Num()) <= MaxPlausibleOutput)
+			{
+				UncompressedData.SetNumUninitialized(FMath::Min<uint64>(UncompressedData.Num() * 2, MaxPlausibleOutput + 1));
+			}
+
+			const int64 OutSize = FMath::Min(UncompressedData.Num() - OutOffset, MaxZlibChunk);
+			Stream.next_out = UncompressedData.GetData() + OutOffset;
+			Stream.avail_out = static_cast<uInt>(OutSize);
+
+			const int32 Result = inflate(&Stream, Z_NO_FLUSH);
+			OutOffset += OutSize - Stream.avail_out;
+
+			if (static_cast<uint64>(OutOffset) > MaxPlausibleOutput)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Refusing Gzip data: uncompressed output is implausible for %lld compressed bytes (possible decompression bomb)."), static_cast<long long>(DataNum));
+				break;
+			}
+
+			if (Result == Z_STREAM_END)
+			{
+				// another member ? (trailing garbage is ignored like gzip does, an incomplete member fails in inflate)
+				const int64 NextMember = InOffset - Stream.avail_in;
+				if (NextMember + 2 <= DataNum && DataPtr[NextMember] == 0x1F && DataPtr[NextMember + 1] == 0x8B)
+				{
+					inflateReset(&Stream);
+					continue;
+				}
+				bSuccess = true;
+				break;
+			}
+
+			if (Result != Z_OK)
+			{
+				break;
+			}
+		}
+
+		inflateEnd(&Stream);
+
+		if (!bSuccess)
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to uncompress Gzip data."));
+			return false;
+		}
+
+		UncompressedData.SetNum(OutOffset);
+		return true;
+	}
+
+	// BGZF blocks (or members listed in a side index) are inflated in parallel, anything else falls back to sequential decompression
+	bool GzipDecompress(const uint8* DataPtr, const int64 DataNum, const TArray<int64>& MembersOffsets, TArray64<uint8>& UncompressedData, FglTFRuntimeLoaderStats& LoaderStats)
+	{
+		struct FGzipMember
+		{
+			int64 DeflateOffset;
+			int64 DeflateSize;
+			int64 UncompressedOffset;
+			uint32 UncompressedSize;
+			uint32 Crc32;
+		};
+
+		TArray<FGzipMember> Members;
+		bool bBoundariesKnown = true;
+		int64 TotalUncompressedSize = 0;
+		int64 MemberOffset = 0;
+		int32 IndexCursor = 0;
+
+		while (MemberOffset < DataNum)
+		{
+			int64 DeflateOffset = 0;
+			int64 BgzfBlockSize = 0;
+			if (!ParseGzipMemberHeader(DataPtr, DataNum, MemberOffset, DeflateOffset, BgzfBlockSize))
+			{
+				// ignore trailing garbage after the first member, but not an incomplete member
+				const bool bHasMagic = MemberOffset + 2 <= DataNum && DataPtr[MemberOffset] == 0x1F && DataPtr[MemberOffset + 1] == 0x8B;
+				if (Members.Num() == 0 || bHasMagic)
+				{
+					return false;
+				}
+				break;
+			}
+
+			int64 MemberEnd = 0;
+			if (BgzfBlockSize > 0)
+			{
+				MemberEnd = MemberOffset + BgzfBlockSize;
+			}
+			else if (MembersOffsets.Num() > 0)
+			{
+				while (IndexCursor < MembersOffsets.Num() && MembersOffsets[IndexCursor] <= MemberOffset)
+				{
+					IndexCursor++;
+				}
+				MemberEnd = IndexCursor < MembersOffsets.Num() ? MembersOffsets[IndexCursor] : DataNum;
+			}
+			else
+			{
+				bBoundariesKnown = false;
+				break;
+			}
+
+			FGzipMember Member;
+			Member.DeflateOffset = DeflateOffset;
+			Member.DeflateSize = MemberEnd - 8 - DeflateOffset;
+			Member.UncompressedOffset = TotalUncompressedSize;
+			FMemory::Memcpy(&Member.Crc32, DataPtr + MemberEnd - 8, 4);
+			FMemory::Memcpy(&Member.UncompressedSize, DataPtr + MemberEnd - 4, 4);
+
+			// the FCompression api works with int32 sizes
+			if (Member.DeflateSize < 0 || Member.DeflateSize > INT32_MAX || Member.UncompressedSize > INT32_MAX)
+			{
+				bBoundariesKnown = false;
+				break;
+			}
+
+			TotalUncompressedSize += Member.UncompressedSize;
+			Members.Add(Member);
+			MemberOffset = MemberEnd;
+		}
+
+		if (!bBoundariesKnown || Members.Num() < 2)
+		{
+			LoaderStats.Chunks = 1;
+			return GzipDecompressSequential(DataPtr, DataNum, UncompressedData);
+		}
+
+		if (static_cast<uint64>(TotalUncompressedSize) > static_cast<uint64>(DataNum) * GzipMaxDeflateExpansion)
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Refusing Gzip data: declared uncompressed size %lld is implausible for %lld compressed bytes (possible decompression bomb)."), static_cast<long long>(TotalUncompressedSize), static_cast<long long>(DataNum));
+			return false;
+		}
+
+		LoaderStats.Chunks = Members.Num();
+		LoaderStats.bParallel = true;
+
+		UncompressedData.SetNumUninitialized(TotalUncompressedSize);
+
+		TArray<bool> MembersStates;
+		MembersStates.AddZeroed(Members.Num());
+
+		ParallelFor(Members.Num(), [&](const int32 MemberIndex)
+			{
+				const FGzipMember& Member = Members[MemberIndex];
+				uint8* MemberData = UncompressedData.GetData() + Member.UncompressedOffset;
+				if (Member.UncompressedSize > 0 && !FCompression::UncompressMemory(NAME_Zlib, MemberData, static_cast<int32>(Member.UncompressedSize), DataPtr + Member.DeflateOffset, static_cast<int32>(Member.DeflateSize), COMPRESS_NoFlags, -15))
+				{
+					MembersStates[MemberIndex] = false;
+					return;
+				}
+				// raw deflate does not check the gzip trailer, the CRC32 also catches an ISIZE not matching the actual data
+				MembersStates[MemberIndex] = crc32(0, MemberData, static_cast<uInt>(Member.UncompressedSize)) == Member.Crc32;
+			});
+
+		for (int32 MemberIndex = 0; MemberIndex < Members.Num(); MemberIndex++)
+		{
+			if (!MembersStates[MemberIndex])
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Gzip parallel decompression error @Member %d"), MemberIndex);
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+namespace glTFRuntime
+{
+	// 0xFF marks invalid characters (including padding)
+	struct FBase64DecodingTable
+	{
+		uint8 Values[256];
+
+		FBase64DecodingTable()
+		{
+			FMemory::Memset(Values, 0xFF, sizeof(Values));
+			const ANSICHAR* Alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+			for (uint8 Index = 0; Index < 64; Index++)
+			{
+				Values[static_cast<uint8>(Alphabet[Index])] = Index;
+			}
+		}
+	};
+
+	FORCEINLINE uint32 Base64DecodeChar(const uint8* Table, const TCHAR Char)
+	{
+		return static_cast<uint32>(Char) < 256 ? Table[static_cast<uint32>(Char)] : 0xFF;
+	}
+
+	// every group of 4 characters is independent, so the string is split in blocks decoded in parallel straight into the output
+	bool Base64Decode(const TCHAR* Chars, const int64 NumChars, TArray64<uint8>& Bytes)
+	{
+		static const FBase64DecodingTable DecodingTable;
+		const uint8* Table = DecodingTable.Values;
+
+		int64 NumGroups = NumChars / 4;
+		int64 LastGroupChars = NumChars % 4;
+		if (LastGroupChars == 1)
+		{
+			return false;
+		}
+
+		// padding
+		if (LastGroupChars == 0 && NumChars > 0 && Chars[NumChars - 1] == '=')
+		{
+			NumGroups--;
+			LastGroupChars = Chars[NumChars - 2] == '=' ? 2 : 3;
+		}
+
+		const int64 Offset = Bytes.Num();
+		Bytes.AddUninitialized(NumGroups * 3 + (LastGroupChars > 0 ? LastGroupChars - 1 : 0));
+		uint8* Output = Bytes.GetData() + Offset;
+
+		constexpr int64 BlockGroups = 16384;
+		const int32 NumBlocks = static_cast<int32>((NumGroups + BlockGroups - 1) / BlockGroups);
+
+		TArray<bool> BlocksStates;
+		BlocksStates.AddZeroed(NumBlocks);
+
+		ParallelFor(NumBlocks, [&](const int32 BlockIndex)
+			{
+				const int64 FirstGroup = BlockIndex * BlockGroups;
+				const int64 LastGroup = FMath::Min(FirstGroup + BlockGroups, NumGroups);
+				const TCHAR* Group = Chars + FirstGroup * 4;
+				uint8* Destination = Output + FirstGroup * 3;
+				uint32 Invalid = 0;
+				for (int64 GroupIndex = FirstGroup; GroupIndex < LastGroup; GroupIndex++)
+				{
+					const uint32 A = Base64DecodeChar(Table, Group[0]);
+					const uint32 B = Base64DecodeChar(Table, Group[1]);
+					const uint32 C = Base64DecodeChar(Table, Group[2]);
+					const uint32 D = Base64DecodeChar(Table, Group[3]);
+					Invalid |= A | B | C | D;
+					const uint32 Triple = (A << 18) | (B << 12) | (C << 6) | D;
+					Destination[0] = static_cast<uint8>(Triple >> 16);
+					Destination[1] = static_cast<uint8>(Triple >> 8);
+					Destination[2] = static_cast<uint8>(Triple);
+					Group += 4;
+					Destination += 3;
+				}
+				BlocksStates[BlockIndex] = (Invalid & 0x80) == 0;
+			});
+
+		for (const bool bBlockState : BlocksStates)
+		{
+			if (!bBlockState)
+			{
+				return false;
+			}
+		}
+
+		if (LastGroupChars > 0)
+		{
+			const TCHAR* Group = Chars + NumGroups * 4;
+			uint8* Destination = Output + NumGroups * 3;
+			const uint32 A = Base64DecodeChar(Table, Group[0]);
+			const uint32 B = Base64DecodeChar(Table, Group[1]);
+			const uint32 C = LastGroupChars > 2 ? Base64DecodeChar(Table, Group[2]) : 0;
+			if ((A | B | C) & 0x80)
+			{
+				return false;
+			}
+			Destination[0] = static_cast<uint8>((A << 2) | (B >> 4));
+			if (LastGroupChars > 2)
+			{
+				Destination[1] = static_cast<uint8>((B << 4) | (C >> 2));
+			}
+		}
+
+		return true;
+	}
+}
+
 TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromFilename(const FString& Filename, const FglTFRuntimeConfig& LoaderConfig)
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromFilename, FColor::Magenta);
@@ -80,14 +540,95 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromFilename(const FString& F
 		}
 	}
 
-	TArray64<uint8> Content;
-	if (!FFileHelper::LoadFileToArray(Content, *TruePath))
+	TSharedPtr<FglTFRuntimeParser> Parser = nullptr;
+
+	// zip and tar archives (when not mapped) are read on demand, only their directory is kept in memory
+	if (!LoaderConfig.bMemoryMapFiles && !LoaderConfig.bNoArchive)
 	{
-		UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to load file %s"), *Filename);
-		return nullptr;
+		TArray64<uint8> Header;
+		int64 HeaderFileSize = 0;
+		{
+			TUniquePtr<IFileHandle> FileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*TruePath));
+			if (FileHandle)
+			{
+				HeaderFileSize = FileHandle->Size();
+				Header.AddZeroed(FMath::Min<int64>(HeaderFileSize, 512));
+				if (!FileHandle->Read(Header.GetData(), Header.Num()))
+				{
+					Header.Empty();
+				}
+			}
+		}
+
+		TSharedPtr<FglTFRuntimeArchive> StreamingArchive = nullptr;
+
+		if (Header.Num() > 4 && Header[0] == 0x50 && Header[1] == 0x4b && Header[2] == 0x03 && Header[3] == 0x04)
+		{
+			TSharedPtr<FglTFRuntimeArchiveZip> ZipFile = MakeShared<FglTFRuntimeArchiveZip>();
+			ZipFile->ApplyConfig(LoaderConfig);
+			if (!ZipFile->FromFile(TruePath))
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to parse Zip archive."));
+				return nullptr;
+			}
+			StreamingArchive = ZipFile;
+		}
+		else if (Header.Num() == 512 && FglTFRuntimeArchiveTar::IsTar(Header.GetData(), HeaderFileSize))
+		{
+			TSharedPtr<FglTFRuntimeArchiveTar> TarFile = MakeShared<FglTFRuntimeArchiveTar>();
+			if (TarFile->FromFile(TruePath))
+			{
+				StreamingArchive = TarFile;
+			}
+		}
+		else if (LoaderConfig.bInflateArchivesToDisk && Header.Num() > 18 && Header[0] == 0x1F && Header[1] == 0x8B && Header[2] == 0x08)
+		{
+			const FString TempFilename = FPaths::CreateTempFilename(*FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("glTFRuntime")), TEXT("Archive"), TEXT(".tar"));
+			TSharedPtr<FglTFRuntimeArchiveTar> TarFile = MakeShared<FglTFRuntimeArchiveTar>();
+			// not a tar ? the in memory path below will deal with it
+			if (TarFile->FromGzipFile(TruePath, TempFilename))
+			{
+				StreamingArchive = TarFile;
+			}
+		}
+
+		if (StreamingArchive)
+		{
+			Parser = FromRawDataAndArchive(nullptr, 0, StreamingArchive, LoaderConfig);
+			if (!Parser)
+			{
+				return nullptr;
+			}
+		}
 	}
 
-	TSharedPtr<FglTFRuntimeParser> Parser = FromData(Content.GetData(), Content.Num(), LoaderConfig);
+	if (!Parser)
+	{
+		FglTFRuntimeBytesStoragePtr Content = nullptr;
+		int64 MemoryMappedBytes = 0;
+		if (LoaderConfig.bMemoryMapFiles)
+		{
+			Content = FglTFRuntimeMappedFile::Open(TruePath);
+			MemoryMappedBytes = Content ? Content->Num() : 0;
+		}
+
+		if (!Content)
+		{
+			TArray64<uint8> FileData;
+			if (!FFileHelper::LoadFileToArray(FileData, *TruePath))
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to load file %s"), *Filename);
+				return nullptr;
+			}
+			Content = FglTFRuntimeBytesStorage::FromArray(MoveTemp(FileData));
+		}
+
+		Parser = FromStorage(Content.ToSharedRef(), LoaderConfig);
+		if (Parser)
+		{
+			Parser->LoaderStats.MemoryMappedBytes += MemoryMappedBytes;
+		}
+	}
 
 	if (Parser)
 	{
@@ -100,15 +641,16 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromFilename(const FString& F
 			}
 		}
 		Parser->BaseFilename = FPaths::GetBaseFilename(TruePath);
+		Parser->SourceFilename = FPaths::ConvertRelativePathToFull(TruePath);
 	}
 
 	return Parser;
 }
 
-TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromRawDataAndArchive(const uint8* DataPtr, int64 DataNum, TSharedPtr<FglTFRuntimeArchive> InArchive, const FglTFRuntimeConfig& LoaderConfig)
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromRawDataAndArchive(const uint8* DataPtr, int64 DataNum, TSharedPtr<FglTFRuntimeArchive> InArchive, const FglTFRuntimeConfig& LoaderConfig, FglTFRuntimeBytesStoragePtr InStorage)
 {
 	// this must be defined here as we are dealing with raw C pointers
-	TArray64<uint8> ArchiveEntryPointData;
+	FglTFRuntimeBytesStoragePtr ArchiveEntryPointData;
 
 	if (InArchive)
 	{
@@ -134,7 +676,7 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromRawDataAndArchive(const u
 			return nullptr;
 		}
 
-		if (!LoaderConfig.bAsBlob && !InArchive->GetFileContent(Filename, ArchiveEntryPointData))
+		if (!LoaderConfig.bAsBlob && !InArchive->GetFileStorage(Filename, ArchiveEntryPointData))
 		{
 			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to get %s from Archive."), *Filename);
 			return nullptr;
@@ -145,15 +687,17 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromRawDataAndArchive(const u
 			InArchive->BaseDirectory = FPaths::GetPath(Filename);
 		}
 
-		if (ArchiveEntryPointData.Num() > 0)
+		if (ArchiveEntryPointData && ArchiveEntryPointData->Num() > 0)
 		{
-			DataPtr = ArchiveEntryPointData.GetData();
-			DataNum = ArchiveEntryPointData.Num();
+			DataPtr = ArchiveEntryPointData->GetData();
+			DataNum = ArchiveEntryPointData->Num();
+			InStorage = ArchiveEntryPointData;
 		}
 		else
 		{
 			DataPtr = nullptr;
 			DataNum = 0;
+			InStorage = nullptr;
 		}
 	}
 
@@ -212,119 +756,52 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromRawDataAndArchive(const u
 			DataPtr[2] == 0x54 &&
 			DataPtr[3] == 0x46)
 		{
-			return FromBinary(DataPtr, DataNum, LoaderConfig, InArchive);
+			return FromBinary(DataPtr, DataNum, LoaderConfig, InArchive, InStorage);
 		}
 	}
 
 	if (DataNum > 0 && DataNum <= INT32_MAX)
 	{
-		FString JsonData;
-		FFileHelper::BufferToString(JsonData, DataPtr, (int32)DataNum);
-		return FromString(JsonData, LoaderConfig, InArchive);
+		return FromUTF8(DataPtr, DataNum, LoaderConfig, InArchive);
 	}
 
 	return nullptr;
 }
 
-TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig)
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromStorage(FglTFRuntimeBytesStorageRef InStorage, const FglTFRuntimeConfig& LoaderConfig)
+{
+	return FromData(InStorage->GetData(), InStorage->Num(), LoaderConfig, InStorage);
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, FglTFRuntimeBytesStoragePtr InStorage)
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromData, FColor::Magenta);
 
-	// required for Gzip and LZ4;
+	// required for Gzip, LZ4 and Zstd;
 	TArray64<uint8> UncompressedData;
 
+	FglTFRuntimeLoaderStats LoaderStats;
+	LoaderStats.CompressedBytes = DataNum;
+	const double DecompressionStartTime = FPlatformTime::Seconds();
+
 	// Gzip Compressed ? 10 bytes header and 8 bytes footer
 	if (DataNum > 18 && DataPtr[0] == 0x1F && DataPtr[1] == 0x8B && DataPtr[2] == 0x08)
 	{
-		uint32* GzipOriginalSize = (uint32*)(&DataPtr[DataNum - 4]);
-		int64 StartOfBuffer = 10;
-		// FEXTRA
-		if (DataPtr[3] & 0x04)
-		{
-			uint16* FExtraXLen = (uint16*)(&DataPtr[StartOfBuffer]);
-			if (StartOfBuffer + 2 >= DataNum)
-			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FEXTRA header."));
-				return nullptr;
-			}
-			StartOfBuffer += 2 + *FExtraXLen;
-			if (StartOfBuffer >= DataNum)
-			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FEXTRA XLEN."));
-				return nullptr;
-			}
-		}
-
-		// FNAME
-		if (DataPtr[3] & 0x08)
-		{
-			while (DataPtr[StartOfBuffer] != 0)
-			{
-				StartOfBuffer++;
-				if (StartOfBuffer >= DataNum)
-				{
-					UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FNAME header."));
-					return nullptr;
-				}
-			}
-			if (++StartOfBuffer >= DataNum)
-			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FNAME header."));
-				return nullptr;
-			}
-		}
-
-		// FCOMMENT
-		if (DataPtr[3] & 0x10)
-		{
-			while (DataPtr[StartOfBuffer] != 0)
-			{
-				StartOfBuffer++;
-				if (StartOfBuffer >= DataNum)
-				{
-					UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FCOMMENT header."));
-					return nullptr;
-				}
-			}
-			if (++StartOfBuffer >= DataNum)
-			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FCOMMENT header."));
-				return nullptr;
-			}
-		}
-
-		// FHCRC
-		if (DataPtr[3] & 0x02)
+		TArray<int64> GzipIndex;
+		if (!LoaderConfig.GzipIndexFilename.IsEmpty() && !glTFRuntime::LoadGzipIndex(LoaderConfig.GzipIndexFilename, DataNum, GzipIndex))
 		{
-			if (StartOfBuffer + 2 >= DataNum)
-			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FHCRC header."));
-				return nullptr;
-			}
-			StartOfBuffer += 2;
+			UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to load Gzip index %s, falling back to sequential decompression."), *LoaderConfig.GzipIndexFilename);
 		}
 
-		// Decompression-bomb guard (untrusted input): gzip wraps DEFLATE (RFC 1952 / RFC 1951),
-		// whose maximum expansion is 1032:1, so a declared size larger than the compressed payload
-		// could produce is malformed/malicious. (ISIZE is only size mod 2^32, so this is a floor of
-		// protection, but it still stops the classic bomb.)
-		const int64 GzipCompressedSize = DataNum - StartOfBuffer - 8;
-		constexpr uint64 MaxDeflateExpansion = 1032;
-		if (GzipCompressedSize < 0 || static_cast<uint64>(*GzipOriginalSize) > static_cast<uint64>(GzipCompressedSize) * MaxDeflateExpansion)
+		LoaderStats.Compression = TEXT("Gzip");
+		if (!glTFRuntime::GzipDecompress(DataPtr, DataNum, GzipIndex, UncompressedData, LoaderStats))
 		{
-			UE_LOG(LogGLTFRuntime, Error, TEXT("Refusing Gzip data: declared uncompressed size %u is implausible for %lld compressed bytes (possible decompression bomb)."), *GzipOriginalSize, static_cast<long long>(GzipCompressedSize));
 			return nullptr;
 		}
 
-		UncompressedData.AddUninitialized(*GzipOriginalSize);
-		if (!FCompression::UncompressMemory(NAME_Zlib, UncompressedData.GetData(), *GzipOriginalSize, &DataPtr[StartOfBuffer], DataNum - StartOfBuffer - 8, COMPRESS_NoFlags, -15))
-		{
-			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to uncompress Gzip data."));
-			return nullptr;
-		}
-
-		DataPtr = UncompressedData.GetData();
-		DataNum = *GzipOriginalSize;
+		InStorage = FglTFRuntimeBytesStorage::FromArray(MoveTemp(UncompressedData));
+		DataPtr = InStorage->GetData();
+		DataNum = InStorage->Num();
 	}
 	// LZ4 ? magic number(4) + 3 (Note: Unreal includes the classic LZ4 c library, unfortunately it is exposed in a pretty annoying way, so I have reimplemented the decoding process as it is way more fun than messing around with the build system)
 	else if (DataNum > 7 && DataPtr[0] == 0x04 && DataPtr[1] == 0x22 && DataPtr[2] == 0x4D && DataPtr[3] == 0x18)
@@ -388,6 +865,10 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr
 
 		}
 
+		LoaderStats.Compression = TEXT("LZ4");
+		LoaderStats.Chunks = LZ4Blocks.Num();
+		LoaderStats.bParallel = bLZ4ThreadSafe;
+
 		// Decompression-bomb guard (untrusted input): in the LZ4 block format one length byte of
 		// 0xFF encodes 255 output bytes, so the maximum expansion is 255:1. Bound the pre-reservation
 		// and (below, in the decoder and after each block) the running output to that ratio.
@@ -551,8 +1032,29 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr
 			}
 		}
 
-		DataPtr = UncompressedData.GetData();
-		DataNum = UncompressedData.Num();
+		InStorage = FglTFRuntimeBytesStorage::FromArray(MoveTemp(UncompressedData));
+		DataPtr = InStorage->GetData();
+		DataNum = InStorage->Num();
+	}
+	// Zstd ? magic number(4) + frame header descriptor
+	else if (DataNum > 5 && DataPtr[0] == 0x28 && DataPtr[1] == 0xB5 && DataPtr[2] == 0x2F && DataPtr[3] == 0xFD)
+	{
+		LoaderStats.Compression = TEXT("Zstd");
+		if (!glTFRuntime::ZstdDecompress(DataPtr, DataNum, UncompressedData, LoaderStats))
+		{
+			return nullptr;
+		}
+
+		InStorage = FglTFRuntimeBytesStorage::FromArray(MoveTemp(UncompressedData));
+		DataPtr = InStorage->GetData();
+		DataNum = InStorage->Num();
+	}
+
+	if (!LoaderStats.Compression.IsEmpty())
+	{
+		LoaderStats.UncompressedBytes = DataNum;
+		LoaderStats.DecompressionTime = FPlatformTime::Seconds() - DecompressionStartTime;
+		UE_LOG(LogGLTFRuntime, Verbose, TEXT("%s data decompressed (%lld -> %lld bytes, %d chunks) in %f seconds"), *LoaderStats.Compression, static_cast<long long>(LoaderStats.CompressedBytes), static_cast<long long>(LoaderStats.UncompressedBytes), LoaderStats.Chunks, LoaderStats.DecompressionTime);
 	}
 
 	TSharedPtr<FglTFRuntimeArchive> Archive = nullptr;
@@ -561,22 +1063,9 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr
 	if (!LoaderConfig.bNoArchive && DataNum > 4 && DataPtr[0] == 0x50 && DataPtr[1] == 0x4b && DataPtr[2] == 0x03 && DataPtr[3] == 0x04)
 	{
 		TSharedPtr<FglTFRuntimeArchiveZip> ZipFile = MakeShared<FglTFRuntimeArchiveZip>();
-		if (!LoaderConfig.EncryptionKey.IsEmpty())
-		{
-			ZipFile->SetPassword(LoaderConfig.EncryptionKey);
-		}
-
-		if (LoaderConfig.PasswordPromptHook.IsBound())
-		{
-			ZipFile->PromptHook = LoaderConfig.PasswordPromptHook;
-		}
-
-		if (LoaderConfig.AESDecrypterHook.IsBound())
-		{
-			ZipFile->AESDecrypterHook = LoaderConfig.AESDecrypterHook;
-		}
+		ZipFile->ApplyConfig(LoaderConfig);
 
-		if (!ZipFile->FromData(DataPtr, DataNum))
+		if (!(InStorage ? ZipFile->FromStorage(InStorage.ToSharedRef()) : ZipFile->FromData(DataPtr, DataNum)))
 		{
 			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to parse Zip archive."));
 			return nullptr;
@@ -585,91 +1074,23 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr
 		Archive = ZipFile;
 	}
 	// tar ?
-	else if (!LoaderConfig.bNoArchive && DataNum % 512 == 0 && DataNum >= 10240 && DataPtr[257] == 'u' && DataPtr[258] == 's' && DataPtr[259] == 't' && DataPtr[260] == 'a' && DataPtr[261] == 'r')
+	else if (!LoaderConfig.bNoArchive && FglTFRuntimeArchiveTar::IsTar(DataPtr, DataNum))
 	{
-		TMap<FString, TArray64<uint8>> TarMap;
-
-		auto GetTarString = [](const uint8* StringDataPtr, const int32 StringLen) -> FString
-			{
-				TArray<uint8> StringData;
-				StringData.Reserve(StringLen + 1);
-				for (int32 StringByteIndex = 0; StringByteIndex < StringLen; StringByteIndex++)
-				{
-					if (StringDataPtr[StringByteIndex] == 0)
-					{
-						break;
-					}
-
-					StringData.Add(StringDataPtr[StringByteIndex]);
-				}
-
-				StringData.Add(0);
-
-				return FString(UTF8_TO_TCHAR(StringData.GetData()));
-			};
-
-		TSharedPtr<FglTFRuntimeArchiveMap> TarArchive = MakeShared<FglTFRuntimeArchiveMap>();
-
-		// given the block nature of tar files, it is more memory efficient to extract the files directly
-		int64 ByteIndex = 0;
-		bool bTarParsingFailed = false;
-		while (ByteIndex < DataNum)
+		TSharedPtr<FglTFRuntimeArchiveTar> TarArchive = MakeShared<FglTFRuntimeArchiveTar>();
+		// only headers are indexed, entries are views of the (uncompressed) data
+		if (InStorage ? TarArchive->FromStorage(InStorage.ToSharedRef()) : TarArchive->FromData(DataPtr, DataNum))
 		{
-			const uint8* Block = DataPtr + ByteIndex;
-			ByteIndex += 512;
-
-			// end of archive ?
-			if (Block[0] == 0)
-			{
-				// no entry ? assume error
-				if (TarMap.Num() < 1)
-				{
-					bTarParsingFailed = true;
-				}
-				break;
-			}
-
-			if (Block[257] != 'u' || Block[258] != 's' || Block[259] != 't' || Block[260] != 'a' || Block[261] != 'r')
-			{
-				bTarParsingFailed = true;
-				break;
-			}
-
-			const FString BlockSizeString = GetTarString(Block + 124, 12);
-			int64 FileSize = 0;
-			for (const TCHAR& BlockSizeChar : BlockSizeString)
-			{
-				FileSize *= 8;
-				FileSize += static_cast<char>(BlockSizeChar) - '0';
-			}
-
-			const int64 BlockSize = Align(FileSize, 512);
-
-			if (ByteIndex + BlockSize > DataNum)
-			{
-				bTarParsingFailed = true;
-				break;
-			}
-
-			if (Block[156] == 0 || Block[156] == '0' || Block[156] == '5' || Block[156] == '7')
-			{
-				const FString TarFilename = GetTarString(Block, 100);
-				TArray64<uint8>& TarFileContent = TarMap.Add(TarFilename);
-				TarFileContent.AddUninitialized(FileSize);
-				FMemory::Memcpy(TarFileContent.GetData(), DataPtr + ByteIndex, FileSize);
-			}
-
-			ByteIndex += BlockSize;
-		}
-
-		if (!bTarParsingFailed)
-		{
-			TarArchive->FromMap(TarMap);
 			Archive = TarArchive;
 		}
 	}
 
-	return FromRawDataAndArchive(DataPtr, DataNum, Archive, LoaderConfig);
+	TSharedPtr<FglTFRuntimeParser> Parser = FromRawDataAndArchive(DataPtr, DataNum, Archive, LoaderConfig, InStorage);
+	if (Parser)
+	{
+		Parser->LoaderStats = LoaderStats;
+	}
+
+	return Parser;
 }
 
 TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromMap(const TMap<FString, TArray64<uint8>> Map, const FglTFRuntimeConfig& LoaderConfig)
@@ -699,7 +1120,38 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromString(const FString& Jso
 	if (!JsonObject)
 		return nullptr;
 
-	TSharedPtr<FglTFRuntimeParser> Parser = MakeShared<FglTFRuntimeParser>(JsonObject.ToSharedRef(), LoaderConfig.GetMatrix(), LoaderConfig.SceneScale);
+	FglTFRuntimeJsonTables JsonTables;
+	JsonTables.FillFromJsonObject(JsonObject.ToSharedRef());
+
+	return FromJsonObject(JsonObject.ToSharedRef(), MoveTemp(JsonTables), LoaderConfig, InArchive);
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromUTF8(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromUTF8, FColor::Magenta);
+
+	const bool bUTF16 = DataNum >= 2 && ((DataPtr[0] == 0xFF && DataPtr[1] == 0xFE) || (DataPtr[0] == 0xFE && DataPtr[1] == 0xFF));
+
+	if (!LoaderConfig.bUseFastJsonParser || bUTF16 || DataNum > INT32_MAX)
+	{
+		FString JsonData;
+		FFileHelper::BufferToString(JsonData, DataPtr, (int32)DataNum);
+		return FromString(JsonData, LoaderConfig, InArchive);
+	}
+
+	TSharedPtr<FJsonObject> JsonObject;
+	FglTFRuntimeJsonTables JsonTables;
+	if (!glTFRuntime::ParseJson(DataPtr, DataNum, JsonObject, JsonTables))
+	{
+		return nullptr;
+	}
+
+	return FromJsonObject(JsonObject.ToSharedRef(), MoveTemp(JsonTables), LoaderConfig, InArchive);
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromJsonObject(TSharedRef<FJsonObject> JsonObject, FglTFRuntimeJsonTables&& JsonTables, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive)
+{
+	TSharedPtr<FglTFRuntimeParser> Parser = MakeShared<FglTFRuntimeParser>(JsonObject, MoveTemp(JsonTables), LoaderConfig.GetMatrix(), LoaderConfig.SceneScale);
 
 	if (Parser)
 	{
@@ -755,27 +1207,48 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromString(const FString& Jso
 		}
 		Parser->AssetUserDataClasses = LoaderConfig.AssetUserDataClasses;
 		Parser->UriRewriterHook = LoaderConfig.UriRewriterHook;
+		Parser->bMemoryMapFiles = LoaderConfig.bMemoryMapFiles;
+		Parser->DerivedDataCacheDirectory = LoaderConfig.DerivedDataCacheDirectory;
+		Parser->CacheBytesBudget = LoaderConfig.CacheBytesBudget;
+
+		if (LoaderConfig.bPrefetchArchiveEntries)
+		{
+			Parser->PrefetchArchiveEntries();
+		}
 	}
 
 	return Parser;
 }
 
-TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive)
+bool FglTFRuntimeParser::GetBinaryChunks(const uint8* DataPtr, const int64 DataNum, FString& JsonData, int64& BinaryOffset, int64& BinarySize)
 {
-	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromBinary, FColor::Magenta);
+	int64 JsonOffset = 0;
+	int64 JsonSize = 0;
+	if (!GetBinaryChunks(DataPtr, DataNum, JsonOffset, JsonSize, BinaryOffset, BinarySize))
+	{
+		return false;
+	}
 
-	FString JsonData;
-	TArray64<uint8> BinaryBuffer;
+	FFileHelper::BufferToString(JsonData, &DataPtr[JsonOffset], static_cast<int32>(JsonSize));
+	return true;
+}
 
+bool FglTFRuntimeParser::GetBinaryChunks(const uint8* DataPtr, const int64 DataNum, int64& JsonOffset, int64& JsonSize, int64& BinaryOffset, int64& BinarySize)
+{
 	bool bJsonFound = false;
 	bool bBinaryFound = false;
 	int64 BlobIndex = 12;
 
+	JsonOffset = 0;
+	JsonSize = 0;
+	BinaryOffset = 0;
+	BinarySize = 0;
+
 	while (BlobIndex < DataNum)
 	{
 		if (BlobIndex + 8 > DataNum)
 		{
-			return nullptr;
+			return false;
 		}
 
 		uint32* ChunkLength = (uint32*)&DataPtr[BlobIndex];
@@ -785,36 +1258,58 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataP
 
 		if ((BlobIndex + *ChunkLength) > DataNum)
 		{
-			return nullptr;
+			return false;
 		}
 
 		if (*ChunkType == 0x4E4F534A && !bJsonFound)
 		{
 			bJsonFound = true;
-			FFileHelper::BufferToString(JsonData, &DataPtr[BlobIndex], *ChunkLength);
+			JsonOffset = BlobIndex;
+			JsonSize = *ChunkLength;
 		}
 
 		else if (*ChunkType == 0x004E4942 && !bBinaryFound)
 		{
 			bBinaryFound = true;
-			BinaryBuffer.Append(&DataPtr[BlobIndex], *ChunkLength);
+			BinaryOffset = BlobIndex;
+			BinarySize = *ChunkLength;
 		}
 
 		BlobIndex += *ChunkLength;
 	}
 
-	if (!bJsonFound)
+	return bJsonFound;
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive, FglTFRuntimeBytesStoragePtr InStorage)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromBinary, FColor::Magenta);
+
+	int64 JsonOffset = 0;
+	int64 JsonSize = 0;
+	int64 BinaryOffset = 0;
+	int64 BinarySize = 0;
+
+	if (!GetBinaryChunks(DataPtr, DataNum, JsonOffset, JsonSize, BinaryOffset, BinarySize))
 	{
 		return nullptr;
 	}
 
-	TSharedPtr<FglTFRuntimeParser> Parser = FromString(JsonData, LoaderConfig, InArchive);
+	TSharedPtr<FglTFRuntimeParser> Parser = FromUTF8(&DataPtr[JsonOffset], JsonSize, LoaderConfig, InArchive);
 
 	if (Parser)
 	{
-		if (bBinaryFound)
+		if (BinarySize > 0)
 		{
-			Parser->SetBinaryBuffer(BinaryBuffer);
+			// if the data is already owned by someone, just reference it
+			if (InStorage)
+			{
+				Parser->BinaryBuffer = FglTFRuntimeBytesStorage::FromView(InStorage.ToSharedRef(), &DataPtr[BinaryOffset], BinarySize);
+			}
+			else
+			{
+				Parser->BinaryBuffer = FglTFRuntimeBytesStorage::FromCopy(&DataPtr[BinaryOffset], BinarySize);
+			}
 		}
 	}
 
@@ -968,10 +1463,31 @@ void FglTFRuntimeParser::LoadAndFillBaseMaterials()
 }
 
 
-FglTFRuntimeParser::FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const FMatrix& InSceneBasis, float InSceneScale) : Root(JsonObject), SceneBasis(InSceneBasis), SceneScale(InSceneScale)
+static FglTFRuntimeJsonTables MakeJsonTables(TSharedRef<FJsonObject> JsonObject)
 {
+	FglTFRuntimeJsonTables JsonTables;
+	JsonTables.FillFromJsonObject(JsonObject);
+	return JsonTables;
+}
+
+FglTFRuntimeParser::FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const FMatrix& InSceneBasis, float InSceneScale) : FglTFRuntimeParser(JsonObject, MakeJsonTables(JsonObject), InSceneBasis, InSceneScale)
+{
+}
+
+FglTFRuntimeParser::FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, FglTFRuntimeJsonTables&& InJsonTables, const FMatrix& InSceneBasis, float InSceneScale) : Root(JsonObject), SceneBasis(InSceneBasis), SceneScale(InSceneScale)
+{
+	// descriptors are ready before any extension or delegate can read the accessors
+	JsonTables = MoveTemp(InJsonTables);
+	ResolveDescriptors();
+
 	bAllNodesCached = false;
 	DownloadTime = 0;
+	bMemoryMapFiles = false;
+	CacheBytesBudget = 0;
+	CacheUseCounter = 0;
+	FMemory::Memzero(CachedBytes);
+	PinnedCacheBytes = 0;
+	bCacheOverBudgetLogged = false;
 
 	if (IsInGameThread())
 	{
@@ -1017,6 +1533,7 @@ FglTFRuntimeParser::FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const
 
 bool FglTFRuntimeParser::LoadNodes()
 {
+	FScopeLock Lock(&NodesLock);
 	if (bAllNodesCached)
 	{
 		return true;
@@ -1024,6 +1541,8 @@ bool FglTFRuntimeParser::LoadNodes()
 
 	const TArray<TSharedPtr<FJsonValue>>* JsonNodes;
 
+	MaterializeJsonSection(TEXT("nodes"));
+
 	// no nodes ?
 	if (!Root->TryGetArrayField(TEXT("nodes"), JsonNodes))
 	{
@@ -1471,6 +1990,7 @@ bool FglTFRuntimeParser::LoadScene(int32 SceneIndex, FglTFRuntimeScene& Scene)
 
 bool FglTFRuntimeParser::GetAllNodes(TArray<FglTFRuntimeNode>& Nodes)
 {
+	FScopeLock Lock(&NodesLock);
 	if (!bAllNodesCached)
 	{
 		if (!LoadNodes())
@@ -1486,6 +2006,7 @@ bool FglTFRuntimeParser::GetAllNodes(TArray<FglTFRuntimeNode>& Nodes)
 
 int32 FglTFRuntimeParser::AddFakeRootNode(const FString& BaseName)
 {
+	FScopeLock Lock(&NodesLock);
 	TArray<int32> OrphanNodes;
 	TArray<FglTFRuntimeNode> AllNodes;
 
@@ -1521,6 +2042,7 @@ int32 FglTFRuntimeParser::AddFakeRootNode(const FString& BaseName)
 
 bool FglTFRuntimeParser::LoadNode(const int32 Index, FglTFRuntimeNode& Node)
 {
+	FScopeLock Lock(&NodesLock);
 	// a bit hacky, but allows zero-copy for cached values
 	if (!bAllNodesCached)
 	{
@@ -1541,6 +2063,7 @@ bool FglTFRuntimeParser::LoadNode(const int32 Index, FglTFRuntimeNode& Node)
 
 bool FglTFRuntimeParser::LoadNodeByName(const FString& Name, FglTFRuntimeNode& Node)
 {
+	FScopeLock Lock(&NodesLock);
 	// a bit hacky, but allows zero-copy for cached values
 	if (!bAllNodesCached)
 	{
@@ -1600,7 +2123,10 @@ bool FglTFRuntimeParser::LoadJointByName(const int64 RootBoneIndex, const FStrin
 void FglTFRuntimeParser::AddError(const FString& ErrorContext, const FString& ErrorMessage)
 {
 	FString FullMessage = ErrorContext + ": " + ErrorMessage;
-	Errors.Add(FullMessage);
+	{
+		FScopeLock Lock(&ErrorsLock);
+		Errors.Add(FullMessage);
+	}
 	if (!GIsAutomationTesting)
 	{
 		UE_LOG(LogGLTFRuntime, Error, TEXT("%s"), *FullMessage);
@@ -1623,6 +2149,7 @@ const TArray<FString>& FglTFRuntimeParser::GetErrors() const
 
 void FglTFRuntimeParser::ClearErrors()
 {
+	FScopeLock Lock(&ErrorsLock);
 	Errors.Empty();
 }
 
@@ -1650,11 +2177,21 @@ bool FglTFRuntimeParser::LoadNode_Internal(int32 Index, TSharedRef<FJsonObject>
 	Node.Index = Index;
 	Node.Name = GetJsonObjectString(JsonNodeObject, "name", DefaultPrefixForUnnamedNodes + FString::FromInt(Node.Index));
 
-	Node.MeshIndex = GetJsonObjectIndex(JsonNodeObject, "mesh", INDEX_NONE);
+	if (JsonTables.Nodes.IsValidIndex(Index))
+	{
+		const FglTFRuntimeJsonNode& JsonNode = JsonTables.Nodes[Index];
+		Node.MeshIndex = JsonNode.Mesh;
+		Node.SkinIndex = JsonNode.Skin;
+		Node.CameraIndex = JsonNode.Camera;
+	}
+	else
+	{
+		Node.MeshIndex = GetJsonObjectIndex(JsonNodeObject, "mesh", INDEX_NONE);
 
-	Node.SkinIndex = GetJsonObjectIndex(JsonNodeObject, "skin", INDEX_NONE);
+		Node.SkinIndex = GetJsonObjectIndex(JsonNodeObject, "skin", INDEX_NONE);
 
-	Node.CameraIndex = GetJsonObjectIndex(JsonNodeObject, "camera", INDEX_NONE);
+		Node.CameraIndex = GetJsonObjectIndex(JsonNodeObject, "camera", INDEX_NONE);
+	}
 
 	FMatrix Matrix = FMatrix::Identity;
 
@@ -2300,9 +2837,12 @@ USkeleton* FglTFRuntimeParser::LoadSkeleton(const int32 SkinIndex, const FglTFRu
 		return nullptr;
 	}
 
-	if (CanReadFromCache(SkeletonConfig.CacheMode) && SkeletonsCache.Contains(SkinIndex))
+	if (CanReadFromCache(SkeletonConfig.CacheMode))
 	{
-		return SkeletonsCache[SkinIndex];
+		if (USkeleton* CachedSkeleton = FindInObjectsCache<USkeleton>(SkeletonsCache, SkinIndex))
+		{
+			return CachedSkeleton;
+		}
 	}
 
 	TMap<int32, FName> BoneMap;
@@ -2346,7 +2886,7 @@ USkeleton* FglTFRuntimeParser::LoadSkeleton(const int32 SkinIndex, const FglTFRu
 
 	if (CanWriteToCache(SkeletonConfig.CacheMode))
 	{
-		SkeletonsCache.Add(SkinIndex, Skeleton);
+		AddToObjectsCache(SkeletonsCache, SkinIndex, Skeleton);
 	}
 
 	return Skeleton;
@@ -3025,7 +3565,7 @@ bool FglTFRuntimeParser::TraverseJoints(FReferenceSkeletonModifier& Modifier, co
 	return true;
 }
 
-bool FglTFRuntimeParser::LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject, TArray<FglTFRuntimePrimitive>& Primitives, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines)
+bool FglTFRuntimeParser::LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject, TArray<FglTFRuntimePrimitive>& Primitives, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines, FglTFRuntimeLoadHandlePtr LoadHandle)
 {
 	// get primitives
 	const TArray<TSharedPtr<FJsonValue>>* JsonPrimitives;
@@ -3037,18 +3577,40 @@ bool FglTFRuntimeParser::LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject,
 
 	int32 FirstPrimitive = Primitives.Num();
 
-	for (TSharedPtr<FJsonValue> JsonPrimitive : *JsonPrimitives)
+	for (int32 JsonPrimitiveIndex = 0; JsonPrimitiveIndex < JsonPrimitives->Num(); JsonPrimitiveIndex++)
 	{
-		TSharedPtr<FJsonObject> JsonPrimitiveObject = JsonPrimitive->AsObject();
+		if (LoadHandle)
+		{
+			// no error for cancelled loads
+			if (LoadHandle->IsCancelled())
+			{
+				return false;
+			}
+			LoadHandle->SetStageProgress(0, 0.5f, JsonPrimitiveIndex, JsonPrimitives->Num());
+		}
+
+		TSharedPtr<FJsonObject> JsonPrimitiveObject = (*JsonPrimitives)[JsonPrimitiveIndex]->AsObject();
 		if (!JsonPrimitiveObject)
 		{
 			return false;
 		}
 
 		FglTFRuntimePrimitive Primitive;
-		if (!LoadPrimitive(JsonPrimitiveObject.ToSharedRef(), Primitive, MaterialsConfig, bTriangulatePointsAndLines))
+		const FString DerivedDataKey = GetPrimitiveDerivedDataKey(JsonPrimitiveObject.ToSharedRef(), MaterialsConfig);
+		if (LoadPrimitiveFromDerivedDataCache(DerivedDataKey, Primitive))
 		{
-			return false;
+			if (!LoadPrimitiveMaterial(JsonPrimitiveObject.ToSharedRef(), Primitive, MaterialsConfig, nullptr))
+			{
+				return false;
+			}
+		}
+		else
+		{
+			if (!LoadPrimitive(JsonPrimitiveObject.ToSharedRef(), Primitive, MaterialsConfig, bTriangulatePointsAndLines))
+			{
+				return false;
+			}
+			StorePrimitiveToDerivedDataCache(DerivedDataKey, Primitive);
 		}
 
 		// add the primitive only if it has at least one index 
@@ -3092,6 +3654,15 @@ bool FglTFRuntimeParser::LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject,
 	if (MaterialsConfig.bMergeSectionsByMaterial)
 	{
 		MergePrimitivesByMaterial(Primitives);
+
+		// merged sections can share vertices too
+		if (MaterialsConfig.bWeldVertices)
+		{
+			ParallelFor(Primitives.Num(), [&](const int32 PrimitiveIndex)
+				{
+					glTFRuntime::WeldPrimitiveVertices(Primitives[PrimitiveIndex], MaterialsConfig.WeldVerticesTolerance, MaterialsConfig.WeldVerticesAttributesTolerance);
+				});
+		}
 	}
 
 	return true;
@@ -3210,7 +3781,15 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		SupportedTexCoordComponentTypes.Append({ 5120, 5122 });
 	}
 
-	if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "POSITION", Primitive.Positions,
+	// vertex attributes (and indices) are only resolved here, their data is decoded in a single pass at the end
+	TArray<glTFRuntime::FAccessorStream> Streams;
+	Primitive.UVs.Reserve(2);
+	Primitive.CompactUVs.Reserve(2);
+	Primitive.Joints.Reserve(3);
+	Primitive.Weights.Reserve(3);
+	Primitive.bCompactVertexData = MaterialsConfig.bCompactVertexData;
+
+	if (!AddVertexAttributeStream(Streams, Primitive.bCompactVertexData, JsonAttributesObject->ToSharedRef(), "POSITION", Primitive.Positions, Primitive.CompactPositions,
 		{ 3 }, SupportedPositionComponentTypes, [this](FVector Value) -> FVector {return SceneBasis.TransformPosition(Value) * SceneScale; }, Primitive.AdditionalBufferView, false, nullptr))
 	{
 		AddError("LoadPrimitive()", "Unable to load POSITION attribute");
@@ -3219,7 +3798,7 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 
 	if ((*JsonAttributesObject)->HasField(TEXT("NORMAL")))
 	{
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "NORMAL", Primitive.Normals,
+		if (!AddVertexAttributeStream(Streams, Primitive.bCompactVertexData, JsonAttributesObject->ToSharedRef(), "NORMAL", Primitive.Normals, Primitive.CompactNormals,
 			{ 3 }, SupportedNormalComponentTypes, [this](FVector Value) -> FVector { return SceneBasis.TransformVector(Value); }, Primitive.AdditionalBufferView, true, nullptr))
 		{
 			AddError("LoadPrimitive()", "Unable to load NORMAL attribute");
@@ -3229,7 +3808,7 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 
 	if ((*JsonAttributesObject)->HasField(TEXT("TANGENT")))
 	{
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "TANGENT", Primitive.Tangents,
+		if (!AddVertexAttributeStream(Streams, Primitive.bCompactVertexData, JsonAttributesObject->ToSharedRef(), "TANGENT", Primitive.Tangents, Primitive.CompactTangents,
 			{ 4 }, SupportedTangentComponentTypes, [this](FVector4 Value) -> FVector4 { return SceneBasis.TransformFVector4(Value); }, Primitive.AdditionalBufferView, true, nullptr))
 		{
 			AddError("LoadPrimitive()", "Unable to load TANGENT attribute");
@@ -3239,9 +3818,10 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 
 	if ((*JsonAttributesObject)->HasField(TEXT("TEXCOORD_0")))
 	{
-		TArray<FVector2D> UV;
+		TArray<FVector2D>& UV = Primitive.UVs.AddDefaulted_GetRef();
+		TArray<FglTFRuntimeCompactVector2D>& CompactUV = Primitive.CompactUVs.AddDefaulted_GetRef();
 		int64 TexCoordComponentType = 0;
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "TEXCOORD_0", UV,
+		if (!AddVertexAttributeStream(Streams, Primitive.bCompactVertexData, JsonAttributesObject->ToSharedRef(), "TEXCOORD_0", UV, CompactUV,
 			{ 2 }, SupportedTexCoordComponentTypes, [](FVector2D Value) -> FVector2D {return FVector2D(Value.X, Value.Y); }, Primitive.AdditionalBufferView, !bHasMeshQuantization, &TexCoordComponentType))
 		{
 			AddError("LoadPrimitive()", "Error loading TEXCOORD_0");
@@ -3252,15 +3832,14 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		{
 			Primitive.bHighPrecisionUVs = true;
 		}
-
-		Primitive.UVs.Add(UV);
 	}
 
 	if ((*JsonAttributesObject)->HasField(TEXT("TEXCOORD_1")))
 	{
-		TArray<FVector2D> UV;
+		TArray<FVector2D>& UV = Primitive.UVs.AddDefaulted_GetRef();
+		TArray<FglTFRuntimeCompactVector2D>& CompactUV = Primitive.CompactUVs.AddDefaulted_GetRef();
 		int64 TexCoordComponentType = 0;
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "TEXCOORD_1", UV,
+		if (!AddVertexAttributeStream(Streams, Primitive.bCompactVertexData, JsonAttributesObject->ToSharedRef(), "TEXCOORD_1", UV, CompactUV,
 			{ 2 }, SupportedTexCoordComponentTypes, [](FVector2D Value) -> FVector2D {return FVector2D(Value.X, Value.Y); }, Primitive.AdditionalBufferView, !bHasMeshQuantization, &TexCoordComponentType))
 		{
 			AddError("LoadPrimitive()", "Error loading TEXCOORD_1");
@@ -3271,54 +3850,56 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		{
 			Primitive.bHighPrecisionUVs = true;
 		}
+	}
 
-		Primitive.UVs.Add(UV);
+	// only one of the two UV sets has been filled
+	if (Primitive.bCompactVertexData)
+	{
+		Primitive.UVs.Empty();
+	}
+	else
+	{
+		Primitive.CompactUVs.Empty();
 	}
 
 	if ((*JsonAttributesObject)->HasField(TEXT("JOINTS_0")))
 	{
-		TArray<FglTFRuntimeUInt16Vector4> Joints;
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "JOINTS_0", Joints,
+		TArray<FglTFRuntimeUInt16Vector4>& Joints = Primitive.Joints.AddDefaulted_GetRef();
+		if (!AddAccessorFieldStream(Streams, JsonAttributesObject->ToSharedRef(), "JOINTS_0", Joints,
 			{ 4 }, { 5121, 5123 }, Primitive.AdditionalBufferView, false, nullptr))
 		{
 			AddError("LoadPrimitive()", "Error loading JOINTS_0");
 			return false;
 		}
-
-		Primitive.Joints.Add(Joints);
 	}
 
 	if ((*JsonAttributesObject)->HasField(TEXT("JOINTS_1")))
 	{
-		TArray<FglTFRuntimeUInt16Vector4> Joints;
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "JOINTS_1", Joints,
+		TArray<FglTFRuntimeUInt16Vector4>& Joints = Primitive.Joints.AddDefaulted_GetRef();
+		if (!AddAccessorFieldStream(Streams, JsonAttributesObject->ToSharedRef(), "JOINTS_1", Joints,
 			{ 4 }, { 5121, 5123 }, Primitive.AdditionalBufferView, false, nullptr))
 		{
 			AddError("LoadPrimitive()", "Error loading JOINTS_1");
 			return false;
 		}
-
-		Primitive.Joints.Add(Joints);
 	}
 
 	if ((*JsonAttributesObject)->HasField(TEXT("JOINTS_2")))
 	{
-		TArray<FglTFRuntimeUInt16Vector4> Joints;
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "JOINTS_2", Joints,
+		TArray<FglTFRuntimeUInt16Vector4>& Joints = Primitive.Joints.AddDefaulted_GetRef();
+		if (!AddAccessorFieldStream(Streams, JsonAttributesObject->ToSharedRef(), "JOINTS_2", Joints,
 			{ 4 }, { 5121, 5123 }, Primitive.AdditionalBufferView, false, nullptr))
 		{
 			AddError("LoadPrimitive()", "Error loading JOINTS_2");
 			return false;
 		}
-
-		Primitive.Joints.Add(Joints);
 	}
 
 	if ((*JsonAttributesObject)->HasField(TEXT("WEIGHTS_0")))
 	{
-		TArray<FVector4> Weights;
+		TArray<FVector4>& Weights = Primitive.Weights.AddDefaulted_GetRef();
 		int64 WeightsComponentType = 0;
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "WEIGHTS_0", Weights,
+		if (!AddAccessorFieldStream(Streams, JsonAttributesObject->ToSharedRef(), "WEIGHTS_0", Weights,
 			{ 4 }, { 5126, 5121, 5123 }, Primitive.AdditionalBufferView, true, &WeightsComponentType))
 		{
 			AddError("LoadPrimitive()", "Error loading WEIGHTS_0");
@@ -3329,15 +3910,13 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		{
 			Primitive.bHighPrecisionWeights = true;
 		}
-
-		Primitive.Weights.Add(Weights);
 	}
 
 	if ((*JsonAttributesObject)->HasField(TEXT("WEIGHTS_1")))
 	{
-		TArray<FVector4> Weights;
+		TArray<FVector4>& Weights = Primitive.Weights.AddDefaulted_GetRef();
 		int64 WeightsComponentType = 0;
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "WEIGHTS_1", Weights,
+		if (!AddAccessorFieldStream(Streams, JsonAttributesObject->ToSharedRef(), "WEIGHTS_1", Weights,
 			{ 4 }, { 5126, 5121, 5123 }, Primitive.AdditionalBufferView, true, &WeightsComponentType))
 		{
 			AddError("LoadPrimitive()", "Error loading WEIGHTS_1");
@@ -3348,15 +3927,13 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		{
 			Primitive.bHighPrecisionWeights = true;
 		}
-
-		Primitive.Weights.Add(Weights);
 	}
 
 	if ((*JsonAttributesObject)->HasField(TEXT("WEIGHTS_2")))
 	{
-		TArray<FVector4> Weights;
+		TArray<FVector4>& Weights = Primitive.Weights.AddDefaulted_GetRef();
 		int64 WeightsComponentType = 0;
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "WEIGHTS_2", Weights,
+		if (!AddAccessorFieldStream(Streams, JsonAttributesObject->ToSharedRef(), "WEIGHTS_2", Weights,
 			{ 4 }, { 5126, 5121, 5123 }, Primitive.AdditionalBufferView, true, &WeightsComponentType))
 		{
 			AddError("LoadPrimitive()", "Error loading WEIGHTS_2");
@@ -3367,14 +3944,12 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		{
 			Primitive.bHighPrecisionWeights = true;
 		}
-
-		Primitive.Weights.Add(Weights);
 	}
 
 	if ((*JsonAttributesObject)->HasField(TEXT("COLOR_0")))
 	{
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "COLOR_0", Primitive.Colors,
-			{ 3, 4 }, { 5126, 5121, 5123 }, Primitive.AdditionalBufferView, true, nullptr))
+		if (!AddVertexAttributeStream(Streams, Primitive.bCompactVertexData, JsonAttributesObject->ToSharedRef(), "COLOR_0", Primitive.Colors, Primitive.CompactColors,
+			{ 3, 4 }, { 5126, 5121, 5123 }, [](FVector4 Value) -> FVector4 { return Value; }, Primitive.AdditionalBufferView, true, nullptr))
 		{
 			AddError("LoadPrimitive()", "Error loading COLOR_0");
 			return false;
@@ -3427,7 +4002,7 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 					AddError("LoadPrimitive()", "Unable to load POSITION attribute for MorphTarget");
 					return false;
 				}
-				if (MorphTarget.Positions.Num() != Primitive.Positions.Num())
+				if (MorphTarget.Positions.Num() != Primitive.NumVertices())
 				{
 					AddError("LoadPrimitive()", "Invalid POSITION attribute size for MorphTarget.");
 					return false;
@@ -3443,7 +4018,7 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 					AddError("LoadPrimitive()", "Unable to load NORMAL attribute for MorphTarget");
 					return false;
 				}
-				if (MorphTarget.Normals.Num() != Primitive.Normals.Num())
+				if (MorphTarget.Normals.Num() != Primitive.NumNormals())
 				{
 					AddError("LoadPrimitive()", "Invalid NORMAL attribute size for MorphTarget.");
 					return false;
@@ -3487,45 +4062,48 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 			return false;
 		}
 
-		Primitive.Indices.AddUninitialized(Count);
-		ParallelFor(Count, [&](const int32 Index)
-			{
-				int64 IndexIndex = Index * Stride;
+		glTFRuntime::FAccessorStream IndicesStream;
+		IndicesStream.Count = Count;
+		IndicesStream.Storage = IndicesBytes.Storage;
 
-				uint32 VertexIndex = 0;
-				if (ComponentType == 5121)
-				{
-					VertexIndex = IndicesBytes.Data[IndexIndex];
-				}
-				else if (ComponentType == 5123)
-				{
-					uint16* IndexPtr = (uint16*)&(IndicesBytes.Data[IndexIndex]);
-					VertexIndex = *IndexPtr;
-				}
-				else if (ComponentType == 5125)
-				{
-					uint32* IndexPtr = (uint32*)&(IndicesBytes.Data[IndexIndex]);
-					VertexIndex = *IndexPtr;
-				}
+		if (Count > MAX_int32 - Primitive.Indices.Num())
+		{
+			AddError("LoadPrimitive()", "Too many indices.");
+			return false;
+		}
 
-				Primitive.Indices[Index] = VertexIndex;
-			});
+		const int64 FirstIndex = Primitive.Indices.AddUninitialized(Count);
+		if (!glTFRuntime::DispatchAccessorDecoder<uint32, true>(ComponentType, false, IndicesBytes.Data, Stride, Elements, Primitive.Indices.GetData() + FirstIndex, [](uint32 Value) -> uint32 { return Value; }, IndicesStream))
+		{
+			return false;
+		}
+		Streams.Add(MoveTemp(IndicesStream));
 
 		// use indices only if their number is higher than positions (this reduces gpu usage on assets reusing the same POSITION buffer)
-		if (Primitive.Positions.Num() < Primitive.Indices.Num())
+		if (Primitive.NumVertices() < Primitive.Indices.Num())
 		{
 			Primitive.bHasIndices = true;
 		}
 	}
 	else
 	{
-		Primitive.Indices.AddUninitialized(Primitive.Positions.Num());
-		ParallelFor(Primitive.Positions.Num(), [&](const int32 VertexIndex)
+		glTFRuntime::FAccessorStream IndicesStream;
+		IndicesStream.Count = Primitive.NumVertices();
+
+		const int64 FirstIndex = Primitive.Indices.AddUninitialized(Primitive.NumVertices());
+		uint32* IndicesData = Primitive.Indices.GetData() + FirstIndex;
+		IndicesStream.Decoder = [IndicesData](const int64 FirstElement, const int64 LastElement)
 			{
-				Primitive.Indices[VertexIndex] = VertexIndex;
-			});
+				for (int64 VertexIndex = FirstElement; VertexIndex < LastElement; VertexIndex++)
+				{
+					IndicesData[VertexIndex] = static_cast<uint32>(VertexIndex);
+				}
+			};
+		Streams.Add(MoveTemp(IndicesStream));
 	}
 
+	glTFRuntime::DecodeAccessorStreams(Streams);
+
 	// fixing indices... 5: TRIANGLE_STRIP 6: TRIANGLE_FAN
 	if (Primitive.Mode == 5)
 	{
@@ -3545,7 +4123,7 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 			StripIndices[StripIndex + 2] = Primitive.Indices[Index];
 			StripIndex += 3;
 		}
-		Primitive.Indices = StripIndices;
+		Primitive.Indices = MoveTemp(StripIndices);
 	}
 	else if (Primitive.Mode == 6)
 	{
@@ -3565,13 +4143,30 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 			FanIndices[FanIndex + 2] = Primitive.Indices[Index];
 			FanIndex += 3;
 		}
-		Primitive.Indices = FanIndices;
+		Primitive.Indices = MoveTemp(FanIndices);
 	}
 	else if (bTriangulatePointsAndLines)
 	{
 		ForceBaseMaterial = TriangulatePointsAndLines(Primitive, MaterialsConfig);
 	}
 
+	if (!LoadPrimitiveMaterial(JsonPrimitiveObject, Primitive, MaterialsConfig, ForceBaseMaterial))
+	{
+		return false;
+	}
+
+	if (MaterialsConfig.bWeldVertices)
+	{
+		glTFRuntime::WeldPrimitiveVertices(Primitive, MaterialsConfig.WeldVerticesTolerance, MaterialsConfig.WeldVerticesAttributesTolerance);
+	}
+
+	OnLoadedPrimitive.Broadcast(AsShared(), JsonPrimitiveObject, Primitive);
+
+	return true;
+}
+
+bool FglTFRuntimeParser::LoadPrimitiveMaterial(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig, UMaterialInterface* ForceBaseMaterial)
+{
 	Primitive.Material = UMaterial::GetDefaultMaterial(MD_Surface);
 
 	if (!MaterialsConfig.bSkipLoad)
@@ -3615,26 +4210,253 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 
 		if (MaterialIndex != INDEX_NONE)
 		{
-			Primitive.Material = LoadMaterial(MaterialIndex, MaterialsConfig, Primitive.Colors.Num() > 0, Primitive.MaterialName, ForceBaseMaterial);
+			Primitive.Material = LoadMaterial(MaterialIndex, MaterialsConfig, Primitive.NumColors() > 0, Primitive.MaterialName, ForceBaseMaterial);
 			if (!Primitive.Material)
 			{
-				AddError("LoadPrimitive()", FString::Printf(TEXT("Unable to load material %lld"), MaterialIndex));
+				AddError("LoadPrimitiveMaterial()", FString::Printf(TEXT("Unable to load material %lld"), MaterialIndex));
 				return false;
 			}
 			Primitive.bHasMaterial = true;
 		}
 		// special case for primitives without a material but with a color buffer
-		else if (Primitive.Colors.Num() > 0)
+		else if (Primitive.NumColors() > 0)
 		{
 			Primitive.Material = BuildVertexColorOnlyMaterial(MaterialsConfig, false);
 		}
 	}
 
-	OnLoadedPrimitive.Broadcast(AsShared(), JsonPrimitiveObject, Primitive);
+	return true;
+}
+
+const FString& FglTFRuntimeParser::GetDerivedDataContentHash()
+{
+	FScopeLock Lock(&DerivedDataContentHashLock);
+
+	if (!DerivedDataContentHash.IsEmpty())
+	{
+		return DerivedDataContentHash;
+	}
+
+	FSHA1 SHA1;
+
+	// the whole json is hashed as accessors, bufferViews and extensions are all referenced by index (buffer uris and byteLengths included)
+	FString JsonString;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+	FJsonSerializer::Serialize(GetJsonRoot().ToSharedRef(), JsonWriter);
+	FTCHARToUTF8 JsonUTF8(*JsonString);
+	SHA1.Update(reinterpret_cast<const uint8*>(JsonUTF8.Get()), JsonUTF8.Length());
+
+	// files are streamed in small chunks, so the buffers are never loaded or retained by the parser
+	auto HashFileContent = [&SHA1](const FString& Path)
+		{
+			TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Path, FILEREAD_Silent));
+			if (!Reader)
+			{
+				return;
+			}
+
+			TArray<uint8> Chunk;
+			Chunk.SetNumUninitialized(256 * 1024);
+			int64 Remaining = Reader->TotalSize();
+			while (Remaining > 0 && !Reader->IsError())
+			{
+				const int32 ChunkSize = static_cast<int32>(FMath::Min<int64>(Remaining, Chunk.Num()));
+				Reader->Serialize(Chunk.GetData(), ChunkSize);
+				SHA1.Update(Chunk.GetData(), ChunkSize);
+				Remaining -= ChunkSize;
+			}
+		};
+
+	// the source file bytes cover the GLB BIN chunk and the archive entries too
+	const bool bHasSourceFile = !SourceFilename.IsEmpty();
+	if (bHasSourceFile)
+	{
+		HashFileContent(SourceFilename);
+	}
+	else if (BinaryBuffer)
+	{
+		// in memory GLB, the BIN chunk is already resident
+		SHA1.Update(BinaryBuffer->GetData(), BinaryBuffer->Num());
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* JsonBuffers;
+	if (Root->TryGetArrayField(TEXT("buffers"), JsonBuffers))
+	{
+		for (int32 BufferIndex = 0; BufferIndex < JsonBuffers->Num(); BufferIndex++)
+		{
+			TSharedPtr<FJsonObject> JsonBufferObject = (*JsonBuffers)[BufferIndex]->AsObject();
+			if (!JsonBufferObject)
+			{
+				continue;
+			}
+
+			FString Uri;
+			// data uris are part of the json
+			if (!GetJsonObjectUri(JsonBufferObject.ToSharedRef(), Uri) || Uri.StartsWith("data:"))
+			{
+				continue;
+			}
+
+			RewriteUri(Uri);
+
+			if (Archive)
+			{
+				if (bHasSourceFile)
+				{
+					continue;
+				}
+
+				// in memory archive, the entries are already resident
+				FglTFRuntimeBlob Blob;
+				if (GetBuffer(BufferIndex, Blob))
+				{
+					SHA1.Update(Blob.Data, Blob.Num);
+					continue;
+				}
+			}
+
+			if (!BaseDirectory.IsEmpty())
+			{
+				HashFileContent(FPaths::Combine(BaseDirectory, Uri));
+			}
+		}
+	}
+
+	SHA1.Final();
+	FSHAHash Hash;
+	SHA1.GetHash(Hash.Hash);
+	DerivedDataContentHash = Hash.ToString();
+
+	return DerivedDataContentHash;
+}
+
+FString FglTFRuntimeParser::GetPrimitiveDerivedDataKey(TSharedRef<FJsonObject> JsonPrimitiveObject, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
+{
+	// primitives can be freely manipulated by the delegates, do not cache them
+	if (DerivedDataCacheDirectory.IsEmpty() || OnPreLoadedPrimitive.IsBound() || OnLoadedPrimitive.IsBound())
+	{
+		return "";
+	}
+
+	// points and lines triangulation can force a base material, always rebuild them
+	int64 Mode = 4;
+	JsonPrimitiveObject->TryGetNumberField(TEXT("mode"), Mode);
+	if (Mode < 4)
+	{
+		return "";
+	}
+
+	FString JsonString;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+	FJsonSerializer::Serialize(JsonPrimitiveObject, JsonWriter);
+
+	FString ContentHash = GetDerivedDataContentHash();
+	FMatrix Basis = SceneBasis;
+	float Scale = SceneScale;
+	bool bCompactVertexData = MaterialsConfig.bCompactVertexData;
+	TArray<FString> CollectWeightMaps = MaterialsConfig.CollectWeightMaps;
+	bool bWeldVertices = MaterialsConfig.bWeldVertices;
+	float WeldVerticesTolerance = bWeldVertices ? MaterialsConfig.WeldVerticesTolerance : 0;
+	float WeldVerticesAttributesTolerance = bWeldVertices ? MaterialsConfig.WeldVerticesAttributesTolerance : 0;
+
+	TArray<uint8> KeyData;
+	FMemoryWriter Writer(KeyData);
+	Writer << ContentHash << JsonString << Basis << Scale << bCompactVertexData << CollectWeightMaps << bWeldVertices << WeldVerticesTolerance << WeldVerticesAttributesTolerance;
+
+	return FglTFRuntimeDerivedDataCache::MakeKey("Primitive", KeyData);
+}
+
+bool FglTFRuntimeParser::LoadPrimitiveFromDerivedDataCache(const FString& DerivedDataKey, FglTFRuntimePrimitive& Primitive)
+{
+	if (DerivedDataKey.IsEmpty())
+	{
+		return false;
+	}
+
+	TArray<uint8> Data;
+	if (!FglTFRuntimeDerivedDataCache::Get(DerivedDataCacheDirectory, DerivedDataKey, Data))
+	{
+		DerivedDataMisses++;
+		return false;
+	}
+
+	FglTFRuntimePrimitive CachedPrimitive;
+	FMemoryReader Reader(Data);
+	SerializePrimitiveGeometry(Reader, CachedPrimitive);
+	if (Reader.IsError())
+	{
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("Invalid derived data for key %s"), *DerivedDataKey);
+		DerivedDataMisses++;
+		return false;
+	}
 
+	Primitive = MoveTemp(CachedPrimitive);
+	DerivedDataHits++;
 	return true;
 }
 
+void FglTFRuntimeParser::StorePrimitiveToDerivedDataCache(const FString& DerivedDataKey, FglTFRuntimePrimitive& Primitive)
+{
+	if (DerivedDataKey.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	SerializePrimitiveGeometry(Writer, Primitive);
+	if (!FglTFRuntimeDerivedDataCache::Put(DerivedDataCacheDirectory, DerivedDataKey, Data))
+	{
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to store derived data for key %s"), *DerivedDataKey);
+	}
+}
+
+void FglTFRuntimeParser::SerializePrimitiveGeometry(FArchive& Ar, FglTFRuntimePrimitive& Primitive)
+{
+	Ar << Primitive.Mode;
+	Ar << Primitive.bHasIndices;
+	Ar << Primitive.bHighPrecisionUVs;
+	Ar << Primitive.bHighPrecisionWeights;
+	Ar << Primitive.bDisableShadows;
+	Ar << Primitive.AdditionalBufferView;
+	Ar << Primitive.bCompactVertexData;
+
+	Ar << Primitive.Positions;
+	Ar << Primitive.Normals;
+	Ar << Primitive.Tangents;
+	Ar << Primitive.UVs;
+	Ar << Primitive.Colors;
+	Ar << Primitive.CompactPositions;
+	Ar << Primitive.CompactNormals;
+	Ar << Primitive.CompactTangents;
+	Ar << Primitive.CompactUVs;
+	Ar << Primitive.CompactColors;
+
+	Ar << Primitive.Indices;
+	Ar << Primitive.Joints;
+	Ar << Primitive.Weights;
+	Ar << Primitive.WeightMaps;
+
+	int32 NumMorphTargets = Primitive.MorphTargets.Num();
+	Ar << NumMorphTargets;
+	if (Ar.IsLoading())
+	{
+		if (NumMorphTargets < 0)
+		{
+			Ar.SetError();
+			return;
+		}
+		Primitive.MorphTargets.SetNum(NumMorphTargets);
+	}
+
+	for (FglTFRuntimeMorphTarget& MorphTarget : Primitive.MorphTargets)
+	{
+		Ar << MorphTarget.Name;
+		Ar << MorphTarget.Positions;
+		Ar << MorphTarget.Normals;
+	}
+}
+
 UMaterialInterface* FglTFRuntimeParser::TriangulatePoints(FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
 {
 	TArray<uint32> PointsIndices;
@@ -4516,24 +5338,196 @@ UMaterialInterface* FglTFRuntimeParser::TriangulateLines(FglTFRuntimePrimitive&
 			Primitive.Colors = LinesColors;
 		}
 
-		return MaterialsConfig.LinesBaseMaterial;
-	}
+		return MaterialsConfig.LinesBaseMaterial;
+	}
+
+	return nullptr;
+}
+
+UMaterialInterface* FglTFRuntimeParser::TriangulatePointsAndLines(FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
+{
+	if (Primitive.Mode == 0 && !MaterialsConfig.bSkipPoints) // points
+	{
+		Primitive.ExpandCompactVertexData();
+		return TriangulatePoints(Primitive, MaterialsConfig);
+	}
+	else if (Primitive.Mode >= 1 && Primitive.Mode <= 3 && !MaterialsConfig.bSkipLines)
+	{
+		Primitive.ExpandCompactVertexData();
+		return TriangulateLines(Primitive, MaterialsConfig);
+	}
+
+	return nullptr;
+}
+
+void FglTFRuntimeParser::RewriteUri(FString& Uri)
+{
+	if (!UriRewriterHook.IsBound())
+	{
+		return;
+	}
+
+	if (IsInGameThread())
+	{
+		if (UriRewriterHook.UriRewriter.IsBound())
+		{
+			Uri = UriRewriterHook.UriRewriter.Execute(Uri, UriRewriterHook.Context);
+		}
+		else if (UriRewriterHook.NativeUriRewriter.IsBound())
+		{
+			Uri = UriRewriterHook.NativeUriRewriter.Execute(Uri, UriRewriterHook.Context);
+		}
+	}
+	else
+	{
+		FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&]()
+			{
+				if (UriRewriterHook.UriRewriter.IsBound())
+				{
+					Uri = UriRewriterHook.UriRewriter.Execute(Uri, UriRewriterHook.Context);
+				}
+				else if (UriRewriterHook.NativeUriRewriter.IsBound())
+				{
+					Uri = UriRewriterHook.NativeUriRewriter.Execute(Uri, UriRewriterHook.Context);
+				}
+			}, TStatId(), nullptr, ENamedThreads::GameThread);
+		FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+	}
+}
+
+bool FglTFRuntimeParser::GetArchiveUri(const FString& Uri, FString& ArchiveUri)
+{
+	if (!Archive || Uri.IsEmpty() || Uri.StartsWith("data:") || Uri.StartsWith("http://") || Uri.StartsWith("https://"))
+	{
+		return false;
+	}
+
+	ArchiveUri = Uri;
+	RewriteUri(ArchiveUri);
+
+	if (!Archive->BaseDirectory.IsEmpty())
+	{
+		ArchiveUri = FPaths::Combine(Archive->BaseDirectory, ArchiveUri);
+	}
+
+	return Archive->FileExists(ArchiveUri);
+}
+
+void FglTFRuntimeParser::PrefetchArchiveEntries()
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_PrefetchArchiveEntries, FColor::Magenta);
+
+	if (!Archive || !Archive->SupportsParallelReads())
+	{
+		return;
+	}
+
+	struct FPrefetchEntry
+	{
+		bool bIsImage;
+		int32 Index;
+		FString Uri;
+		FglTFRuntimeBytesStoragePtr Storage;
+	};
+
+	TArray<FPrefetchEntry> Entries;
+
+	// pinned entries count against the budget, what does not fit is left to the on demand loading path
+	int64 PrefetchBytesLeft = MAX_int64;
+	if (CacheBytesBudget > 0)
+	{
+		FScopeLock Lock(&CachesLock);
+		PrefetchBytesLeft = FMath::Max<int64>(CacheBytesBudget - PinnedCacheBytes, 0);
+	}
+	int32 SkippedEntries = 0;
+	int64 SkippedBytes = 0;
+
+	// uris are resolved here as the rewriter hook could require the game thread
+	auto CollectEntries = [&](const TCHAR* FieldName, const bool bIsImage)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* JsonItems;
+			if (!Root->TryGetArrayField(FieldName, JsonItems))
+			{
+				return;
+			}
+
+			for (int32 Index = 0; Index < JsonItems->Num(); Index++)
+			{
+				TSharedPtr<FJsonObject> JsonItemObject = (*JsonItems)[Index]->AsObject();
+				FString Uri;
+				if (!JsonItemObject || !GetJsonObjectUri(JsonItemObject.ToSharedRef(), Uri))
+				{
+					continue;
+				}
+
+				{
+					FScopeLock Lock(&CachesLock);
+					if ((bIsImage ? ImagesCache : BuffersCache).Contains(Index))
+					{
+						continue;
+					}
+				}
+
+				// buffers declare their size, do not even read the ones that cannot fit
+				int64 ByteLength = 0;
+				if (!bIsImage && JsonItemObject->TryGetNumberField(TEXT("byteLength"), ByteLength) && ByteLength > PrefetchBytesLeft)
+				{
+					SkippedEntries++;
+					SkippedBytes += ByteLength;
+					continue;
+				}
 
-	return nullptr;
-}
+				FPrefetchEntry Entry;
+				if (GetArchiveUri(Uri, Entry.Uri))
+				{
+					Entry.bIsImage = bIsImage;
+					Entry.Index = Index;
+					Entries.Add(MoveTemp(Entry));
+				}
+			}
+		};
 
-UMaterialInterface* FglTFRuntimeParser::TriangulatePointsAndLines(FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
-{
-	if (Primitive.Mode == 0 && !MaterialsConfig.bSkipPoints) // points
+	CollectEntries(TEXT("buffers"), false);
+	CollectEntries(TEXT("images"), true);
+
+	ParallelFor(Entries.Num(), [&](const int32 EntryIndex)
+		{
+			FPrefetchEntry& Entry = Entries[EntryIndex];
+			if (!Archive->GetFileStorage(Entry.Uri, Entry.Storage))
+			{
+				Entry.Storage = nullptr;
+			}
+		});
+
+	// failures are not reported here, the regular loading path will do it
+	// entries are pinned until their first use, otherwise a tight budget would evict them right away
+	for (FPrefetchEntry& Entry : Entries)
 	{
-		return TriangulatePoints(Primitive, MaterialsConfig);
+		if (Entry.Storage && Entry.Storage->Num() > 0)
+		{
+			if (Entry.Storage->Num() > PrefetchBytesLeft)
+			{
+				SkippedEntries++;
+				SkippedBytes += Entry.Storage->Num();
+				continue;
+			}
+			PrefetchBytesLeft -= Entry.Storage->Num();
+
+			if (Entry.bIsImage)
+			{
+				AddToCache(ImagesCache, ImagesCacheEntries, EglTFRuntimeCacheKind::Images, Entry.Index, Entry.Storage.ToSharedRef(), true);
+			}
+			else
+			{
+				AddToCache(BuffersCache, BuffersCacheEntries, EglTFRuntimeCacheKind::Buffers, Entry.Index, Entry.Storage.ToSharedRef(), true);
+			}
+		}
 	}
-	else if (Primitive.Mode >= 1 && Primitive.Mode <= 3 && !MaterialsConfig.bSkipLines)
+
+	if (SkippedEntries > 0)
 	{
-		return TriangulateLines(Primitive, MaterialsConfig);
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("%d archive entries (%lld bytes) not prefetched, pinning them would exceed the cache budget of %lld bytes"), SkippedEntries, static_cast<long long>(SkippedBytes), static_cast<long long>(CacheBytesBudget));
 	}
-
-	return nullptr;
 }
 
 bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
@@ -4543,19 +5537,21 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 		return false;
 	}
 
-	if (Index == 0 && BinaryBuffer.Num() > 0)
+	if (Index == 0 && BinaryBuffer && BinaryBuffer->Num() > 0)
 	{
-		Blob.Data = BinaryBuffer.GetData();
-		Blob.Num = BinaryBuffer.Num();
+		Blob.SetStorage(BinaryBuffer.ToSharedRef());
 		return true;
 	}
 
 	// first check cache
-	if (BuffersCache.Contains(Index))
 	{
-		Blob.Data = BuffersCache[Index].GetData();
-		Blob.Num = BuffersCache[Index].Num();
-		return true;
+		FScopeLock Lock(&CachesLock);
+		if (FglTFRuntimeBytesStorageRef* CachedBuffer = BuffersCache.Find(Index))
+		{
+			Blob.SetStorage(*CachedBuffer);
+			TouchCacheEntry(BuffersCacheEntries, Index);
+			return true;
+		}
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>* JsonBuffers;
@@ -4584,72 +5580,41 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 	}
 
 	FString Uri;
-	if (!JsonBufferObject->TryGetStringField(TEXT("uri"), Uri))
+	if (!GetJsonObjectUri(JsonBufferObject.ToSharedRef(), Uri))
 	{
 		return false;
 	}
 
-	// check it is a valid base64 data uri
+	// check it is a valid base64 data uri (decoded straight into the cache entry)
 	if (Uri.StartsWith("data:"))
 	{
 		TArray64<uint8> Base64Data;
 		if (ParseBase64Uri(Uri, Base64Data))
 		{
-			BuffersCache.Add(Index, Base64Data);
-			Blob.Data = BuffersCache[Index].GetData();
-			Blob.Num = BuffersCache[Index].Num();
+			Blob.SetStorage(AddToCache(BuffersCache, BuffersCacheEntries, EglTFRuntimeCacheKind::Buffers, Index, FglTFRuntimeBytesStorage::FromArray(MoveTemp(Base64Data))));
 			return true;
 		}
 		return false;
 	}
-	else if (Uri.StartsWith("http://") || Uri.StartsWith("https://"))
+
+	if (Uri.StartsWith("http://") || Uri.StartsWith("https://"))
 	{
 		AddError("GetBuffer()", FString::Printf(TEXT("Unable to open from external url %s (feature not supported)"), *Uri));
 		return false;
 	}
 
-	if (UriRewriterHook.IsBound())
-	{
-		if (IsInGameThread())
-		{
-			if (UriRewriterHook.UriRewriter.IsBound())
-			{
-				Uri = UriRewriterHook.UriRewriter.Execute(Uri, UriRewriterHook.Context);
-			}
-			else if (UriRewriterHook.NativeUriRewriter.IsBound())
-			{
-				Uri = UriRewriterHook.NativeUriRewriter.Execute(Uri, UriRewriterHook.Context);
-			}
-		}
-		else
-		{
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&]()
-				{
-					if (UriRewriterHook.UriRewriter.IsBound())
-					{
-						Uri = UriRewriterHook.UriRewriter.Execute(Uri, UriRewriterHook.Context);
-					}
-					else if (UriRewriterHook.NativeUriRewriter.IsBound())
-					{
-						Uri = UriRewriterHook.NativeUriRewriter.Execute(Uri, UriRewriterHook.Context);
-					}
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		}
-	}
+	RewriteUri(Uri);
 
 	if (Archive)
 	{
-		TArray64<uint8> ArchiveItemData;
+		FglTFRuntimeBytesStoragePtr ArchiveItemData;
 		if (!Archive->BaseDirectory.IsEmpty())
 		{
 			Uri = FPaths::Combine(Archive->BaseDirectory, Uri);
 		}
-		if (Archive->GetFileContent(Uri, ArchiveItemData))
+		if (Archive->GetFileStorage(Uri, ArchiveItemData))
 		{
-			BuffersCache.Add(Index, ArchiveItemData);
-			Blob.Data = BuffersCache[Index].GetData();
-			Blob.Num = BuffersCache[Index].Num();
+			Blob.SetStorage(AddToCache(BuffersCache, BuffersCacheEntries, EglTFRuntimeCacheKind::Buffers, Index, ArchiveItemData.ToSharedRef()));
 			return true;
 		}
 	}
@@ -4657,12 +5622,24 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 	// fallback
 	if (!BaseDirectory.IsEmpty())
 	{
+		if (bMemoryMapFiles)
+		{
+			TSharedPtr<FglTFRuntimeMappedFile, ESPMode::ThreadSafe> MappedBuffer = FglTFRuntimeMappedFile::Open(FPaths::Combine(BaseDirectory, Uri));
+			if (MappedBuffer)
+			{
+				{
+					FScopeLock Lock(&CachesLock);
+					LoaderStats.MemoryMappedBytes += MappedBuffer->Num();
+				}
+				Blob.SetStorage(AddToCache(BuffersCache, BuffersCacheEntries, EglTFRuntimeCacheKind::Buffers, Index, MappedBuffer.ToSharedRef()));
+				return true;
+			}
+		}
+
 		TArray64<uint8> FileData;
 		if (FFileHelper::LoadFileToArray(FileData, *FPaths::Combine(BaseDirectory, Uri)))
 		{
-			BuffersCache.Add(Index, FileData);
-			Blob.Data = BuffersCache[Index].GetData();
-			Blob.Num = BuffersCache[Index].Num();
+			Blob.SetStorage(AddToCache(BuffersCache, BuffersCacheEntries, EglTFRuntimeCacheKind::Buffers, Index, FglTFRuntimeBytesStorage::FromArray(MoveTemp(FileData))));
 			return true;
 		}
 	}
@@ -4682,106 +5659,81 @@ bool FglTFRuntimeParser::ParseBase64Uri(const FString& Uri, TArray64<uint8>& Byt
 
 	StringIndex += Base64Signature.Len();
 
-	TArray<uint8> BytesBase64;
-
-	bool bSuccess = FBase64::Decode(Uri.Mid(StringIndex), BytesBase64);
-	if (bSuccess)
-	{
-		Bytes.Append(BytesBase64);
-	}
-	return bSuccess;
+	return glTFRuntime::Base64Decode(*Uri + StringIndex, Uri.Len() - StringIndex, Bytes);
 }
 
 bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob, int64& Stride)
 {
-	TSharedPtr<FJsonObject> JsonBufferViewObject = GetJsonObjectFromRootIndex("bufferViews", Index);
-	if (!JsonBufferViewObject)
+	const FglTFRuntimeBufferViewDescriptor* BufferView = GetBufferViewDescriptor(Index);
+	if (!BufferView)
 	{
 		return false;
 	}
 
-	TSharedPtr<FJsonObject> JsonBufferViewCompressedObject = GetJsonObjectExtension(JsonBufferViewObject.ToSharedRef(), "EXT_meshopt_compression");
-	if (JsonBufferViewCompressedObject)
+	if (BufferView->bMeshOpt)
 	{
-		JsonBufferViewObject = JsonBufferViewCompressedObject;
-		if (CompressedBufferViewsCache.Contains(Index))
+		FScopeLock Lock(&CachesLock);
+		if (FglTFRuntimeBytesStorageRef* CachedBufferView = CompressedBufferViewsCache.Find(Index))
 		{
-			Blob.Data = CompressedBufferViewsCache[Index].GetData();
-			Blob.Num = CompressedBufferViewsCache[Index].Num();
+			Blob.SetStorage(*CachedBufferView);
 			Stride = CompressedBufferViewsStridesCache[Index];
+			TouchCacheEntry(CompressedBufferViewsCacheEntries, Index);
 			return true;
 		}
 	}
 
-	int64 BufferIndex;
-	if (!JsonBufferViewObject->TryGetNumberField(TEXT("buffer"), BufferIndex))
-	{
-		return false;
-	}
-
 	FglTFRuntimeBlob BufferBlob;
-	if (!GetBuffer(BufferIndex, BufferBlob))
-	{
-		return false;
-	}
-
-	int64 ByteLength;
-	if (!JsonBufferViewObject->TryGetNumberField(TEXT("byteLength"), ByteLength))
+	if (!GetBuffer(BufferView->Buffer, BufferBlob))
 	{
 		return false;
 	}
 
-	int64 ByteOffset;
-	if (!JsonBufferViewObject->TryGetNumberField(TEXT("byteOffset"), ByteOffset))
-	{
-		ByteOffset = 0;
-	}
-
-	if (!JsonBufferViewObject->TryGetNumberField(TEXT("byteStride"), Stride))
-	{
-		Stride = 0;
-	}
+	Stride = BufferView->ByteStride;
 
-	if (ByteOffset + ByteLength > BufferBlob.Num)
+	if (BufferView->ByteOffset + BufferView->ByteLength > BufferBlob.Num)
 	{
 		return false;
 	}
 
-	Blob.Data = BufferBlob.Data + ByteOffset;
-	Blob.Num = ByteLength;
+	Blob.Data = BufferBlob.Data + BufferView->ByteOffset;
+	Blob.Num = BufferView->ByteLength;
+	// cached buffers can be evicted, the view keeps its buffer alive
+	Blob.Storage = BufferBlob.Storage;
 
-	if (JsonBufferViewCompressedObject)
+	if (BufferView->bMeshOpt)
 	{
 		// decompress bitstream
-		if (Stride == 0)
+		TSharedPtr<FJsonObject> JsonBufferViewObject = GetJsonObjectFromRootIndex("bufferViews", Index);
+		if (!JsonBufferViewObject)
 		{
 			return false;
 		}
-		int64 Elements;
-		if (!JsonBufferViewObject->TryGetNumberField(TEXT("count"), Elements))
+
+		TSharedPtr<FJsonObject> JsonBufferViewCompressedObject = GetJsonObjectExtension(JsonBufferViewObject.ToSharedRef(), "EXT_meshopt_compression");
+		if (!JsonBufferViewCompressedObject)
 		{
 			return false;
 		}
+
 		FString MeshOptMode;
-		if (!JsonBufferViewObject->TryGetStringField(TEXT("mode"), MeshOptMode))
+		if (!JsonBufferViewCompressedObject->TryGetStringField(TEXT("mode"), MeshOptMode))
 		{
 			return false;
 		}
 		FString MeshOptFilter;
-		if (!JsonBufferViewObject->TryGetStringField(TEXT("filter"), MeshOptFilter))
+		if (!JsonBufferViewCompressedObject->TryGetStringField(TEXT("filter"), MeshOptFilter))
 		{
 			MeshOptFilter = "NONE";
 		}
 
-		CompressedBufferViewsCache.Add(Index);
-		if (!DecompressMeshOptimizer(Blob, Stride, Elements, MeshOptMode, MeshOptFilter, CompressedBufferViewsCache[Index]))
+		TArray64<uint8> DecompressedData;
+		if (!DecompressMeshOptimizer(Blob, Stride, BufferView->MeshOptCount, MeshOptMode, MeshOptFilter, DecompressedData))
 		{
-			CompressedBufferViewsCache.Remove(Index);
 			return false;
 		}
-		Blob.Data = CompressedBufferViewsCache[Index].GetData();
-		Blob.Num = CompressedBufferViewsCache[Index].Num();
+		FScopeLock Lock(&CachesLock);
 		CompressedBufferViewsStridesCache.Add(Index, Stride);
+		Blob.SetStorage(AddToCache(CompressedBufferViewsCache, CompressedBufferViewsCacheEntries, EglTFRuntimeCacheKind::CompressedBufferViews, Index, FglTFRuntimeBytesStorage::FromArray(MoveTemp(DecompressedData))));
 	}
 
 	return true;
@@ -4789,73 +5741,25 @@ bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob
 
 bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, int64& Stride, int64& Elements, int64& ElementSize, int64& Count, bool& bNormalized, FglTFRuntimeBlob& Blob, const FglTFRuntimeBlob* AdditionalBufferView)
 {
-
-	TSharedPtr<FJsonObject> JsonAccessorObject = GetJsonObjectFromRootIndex("accessors", Index);
-	if (!JsonAccessorObject)
-	{
-		return false;
-	}
-
-	bool bInitWithZeros = false;
-	bool bHasSparse = false;
-
-	int64 BufferViewIndex = INDEX_NONE;
-	int64 ByteOffset = 0;
-
-	if (!AdditionalBufferView)
-	{
-		if (!JsonAccessorObject->TryGetNumberField(TEXT("bufferView"), BufferViewIndex))
-		{
-			bInitWithZeros = true;
-		}
-
-
-		if (!JsonAccessorObject->TryGetNumberField(TEXT("byteOffset"), ByteOffset))
-		{
-			ByteOffset = 0;
-		}
-	}
-
-	const TSharedPtr<FJsonObject>* JsonSparseObject = nullptr;
-	if (JsonAccessorObject->TryGetObjectField(TEXT("sparse"), JsonSparseObject))
-	{
-		bHasSparse = true;
-	}
-
-	const bool bOriginalNormalized = bNormalized;
-
-	if (!JsonAccessorObject->TryGetBoolField(TEXT("normalized"), bNormalized))
-	{
-		bNormalized = bOriginalNormalized;
-	}
-
-	if (!JsonAccessorObject->TryGetNumberField(TEXT("componentType"), ComponentType))
-	{
-		return false;
-	}
-
-	if (!JsonAccessorObject->TryGetNumberField(TEXT("count"), Count))
+	const FglTFRuntimeAccessorDescriptor* Accessor = GetAccessorDescriptor(Index);
+	if (!Accessor)
 	{
 		return false;
 	}
 
-	FString Type;
-	if (!JsonAccessorObject->TryGetStringField(TEXT("type"), Type))
-	{
-		return false;
-	}
+	const bool bInitWithZeros = !AdditionalBufferView && Accessor->BufferView == INDEX_NONE;
+	const bool bHasSparse = Accessor->bSparse;
+	const int64 ByteOffset = AdditionalBufferView ? 0 : Accessor->ByteOffset;
 
-	ElementSize = GetComponentTypeSize(ComponentType);
-	if (ElementSize == 0)
+	if (Accessor->bHasNormalized)
 	{
-		return false;
+		bNormalized = Accessor->bNormalized;
 	}
 
-	Elements = GetTypeSize(Type);
-	if (Elements == 0)
-	{
-		return false;
-	}
+	ComponentType = Accessor->ComponentType;
+	Count = Accessor->Count;
+	ElementSize = Accessor->ElementSize;
+	Elements = Accessor->Elements;
 
 	int64 FinalSize = ElementSize * Elements * Count;
 
@@ -4867,6 +5771,7 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 		}
 		Blob.Data = AdditionalBufferView->Data;
 		Blob.Num = FinalSize;
+		Blob.Storage = AdditionalBufferView->Storage;
 
 		// special case for bigger buffers
 		if (FinalSize < AdditionalBufferView->Num && (AdditionalBufferView->Num % (ElementSize * Elements)) == 0)
@@ -4882,12 +5787,14 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 	}
 	else if (bInitWithZeros)
 	{
-
-		if (ZeroBuffer.Num() < FinalSize)
+		FScopeLock Lock(&CachesLock);
+		if (!ZeroBuffer || ZeroBuffer->Num() < FinalSize)
 		{
-			ZeroBuffer.AddZeroed(FinalSize - ZeroBuffer.Num());
+			TArray64<uint8> Zeros;
+			Zeros.AddZeroed(FinalSize);
+			ZeroBuffer = FglTFRuntimeBytesStorage::FromArray(MoveTemp(Zeros));
 		}
-		Blob.Data = ZeroBuffer.GetData();
+		Blob.SetStorage(ZeroBuffer.ToSharedRef());
 		Blob.Num = FinalSize;
 		if (!bHasSparse)
 		{
@@ -4897,7 +5804,12 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 	}
 	else
 	{
-		if (!GetBufferView(BufferViewIndex, Blob, Stride))
+		if (!Accessor->bInBounds)
+		{
+			return false;
+		}
+
+		if (!GetBufferView(Accessor->BufferView, Blob, Stride))
 		{
 			return false;
 		}
@@ -4933,12 +5845,22 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 		}
 	}
 
-	if (SparseAccessorsCache.Contains(Index))
 	{
-		Stride = SparseAccessorsStridesCache[Index];
-		Blob.Data = SparseAccessorsCache[Index].GetData();
-		Blob.Num = SparseAccessorsCache[Index].Num();
-		return true;
+		FScopeLock Lock(&CachesLock);
+		if (FglTFRuntimeBytesStorageRef* CachedSparseAccessor = SparseAccessorsCache.Find(Index))
+		{
+			Stride = SparseAccessorsStridesCache[Index];
+			Blob.SetStorage(*CachedSparseAccessor);
+			TouchCacheEntry(SparseAccessorsCacheEntries, Index);
+			return true;
+		}
+	}
+
+	TSharedPtr<FJsonObject> JsonAccessorObject = GetJsonObjectFromRootIndex("accessors", Index);
+	const TSharedPtr<FJsonObject>* JsonSparseObject = nullptr;
+	if (!JsonAccessorObject || !JsonAccessorObject->TryGetObjectField(TEXT("sparse"), JsonSparseObject))
+	{
+		return false;
 	}
 
 	int64 SparseCount;
@@ -5055,9 +5977,7 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 
 	Stride = SparseBufferViewValuesStride;
 
-	SparseAccessorsCache.Add(Index);
-	SparseAccessorsStridesCache.Add(Index, Stride);
-	TArray64<uint8>& SparseData = SparseAccessorsCache[Index];
+	TArray64<uint8> SparseData;
 	SparseData.Append(Blob.Data, Blob.Num);
 
 	for (int32 IndexToChange = 0; IndexToChange < SparseCount; IndexToChange++)
@@ -5073,7 +5993,9 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 		FMemory::Memcpy(OriginalValuePtr, NewValuePtr, SparseBufferViewValuesStride);
 	}
 
-	Blob.Data = SparseData.GetData();
+	FScopeLock Lock(&CachesLock);
+	SparseAccessorsStridesCache.Add(Index, Stride);
+	Blob.SetStorage(AddToCache(SparseAccessorsCache, SparseAccessorsCacheEntries, EglTFRuntimeCacheKind::SparseAccessors, Index, FglTFRuntimeBytesStorage::FromArray(MoveTemp(SparseData))));
 
 	return true;
 }
@@ -5121,8 +6043,109 @@ int64 FglTFRuntimeParser::GetTypeSize(const FString& Type) const
 	return 0;
 }
 
+void FglTFRuntimeParser::ResolveDescriptors()
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_ResolveDescriptors, FColor::Magenta);
+
+	BufferViewDescriptors.Empty(JsonTables.BufferViews.Num());
+	for (int32 BufferViewIndex = 0; BufferViewIndex < JsonTables.BufferViews.Num(); BufferViewIndex++)
+	{
+		const FglTFRuntimeJsonBufferView& JsonBufferView = JsonTables.BufferViews[BufferViewIndex];
+		FglTFRuntimeBufferViewDescriptor& BufferView = BufferViewDescriptors.AddDefaulted_GetRef();
+		BufferView.Buffer = JsonBufferView.Buffer;
+		BufferView.ByteOffset = JsonBufferView.ByteOffset;
+		BufferView.ByteLength = JsonBufferView.ByteLength;
+		BufferView.ByteStride = JsonBufferView.ByteStride;
+
+		if (JsonBufferView.bHasExtensions)
+		{
+			TSharedPtr<FJsonObject> JsonBufferViewObject = GetJsonObjectFromRootIndex("bufferViews", BufferViewIndex);
+			TSharedPtr<FJsonObject> JsonBufferViewCompressedObject = JsonBufferViewObject ? GetJsonObjectExtension(JsonBufferViewObject.ToSharedRef(), "EXT_meshopt_compression") : nullptr;
+			if (JsonBufferViewCompressedObject)
+			{
+				// the compressed data replaces the fallback bufferView
+				BufferView.bMeshOpt = true;
+				BufferView.Buffer = GetJsonObjectIndex(JsonBufferViewCompressedObject.ToSharedRef(), "buffer", INDEX_NONE);
+				BufferView.ByteOffset = static_cast<int64>(GetJsonObjectNumber(JsonBufferViewCompressedObject.ToSharedRef(), "byteOffset", 0));
+				BufferView.ByteLength = static_cast<int64>(GetJsonObjectNumber(JsonBufferViewCompressedObject.ToSharedRef(), "byteLength", -1));
+				BufferView.ByteStride = static_cast<int64>(GetJsonObjectNumber(JsonBufferViewCompressedObject.ToSharedRef(), "byteStride", 0));
+				BufferView.MeshOptCount = static_cast<int64>(GetJsonObjectNumber(JsonBufferViewCompressedObject.ToSharedRef(), "count", -1));
+			}
+		}
+
+		BufferView.bValid = BufferView.Buffer >= 0 && BufferView.ByteOffset >= 0 && BufferView.ByteLength >= 0 && BufferView.ByteStride >= 0 &&
+			BufferView.ByteLength <= MAX_int64 - BufferView.ByteOffset;
+
+		if (BufferView.bMeshOpt)
+		{
+			BufferView.bValid = BufferView.bValid && BufferView.ByteStride > 0 && BufferView.MeshOptCount >= 0 && BufferView.MeshOptCount <= MAX_int64 / BufferView.ByteStride;
+		}
+	}
+
+	AccessorDescriptors.Empty(JsonTables.Accessors.Num());
+	for (const FglTFRuntimeJsonAccessor& JsonAccessor : JsonTables.Accessors)
+	{
+		FglTFRuntimeAccessorDescriptor& Accessor = AccessorDescriptors.AddDefaulted_GetRef();
+		Accessor.BufferView = JsonAccessor.BufferView;
+		Accessor.ByteOffset = JsonAccessor.ByteOffset;
+		Accessor.ComponentType = JsonAccessor.ComponentType;
+		Accessor.ElementSize = GetComponentTypeSize(JsonAccessor.ComponentType);
+		Accessor.Elements = JsonAccessor.Elements;
+		Accessor.Count = JsonAccessor.Count;
+		Accessor.bNormalized = JsonAccessor.bNormalized;
+		Accessor.bHasNormalized = JsonAccessor.bHasNormalized;
+		Accessor.bSparse = JsonAccessor.bSparse;
+
+		const int64 ElementBytes = Accessor.ElementSize * Accessor.Elements;
+		Accessor.bValid = ElementBytes > 0 && Accessor.Count >= 0 && Accessor.Count <= MAX_int64 / ElementBytes && Accessor.ByteOffset >= 0;
+
+		if (!Accessor.bValid || Accessor.BufferView == INDEX_NONE || !BufferViewDescriptors.IsValidIndex(Accessor.BufferView))
+		{
+			continue;
+		}
+
+		const FglTFRuntimeBufferViewDescriptor& BufferView = BufferViewDescriptors[Accessor.BufferView];
+		if (!BufferView.bValid)
+		{
+			continue;
+		}
+
+		const int64 Stride = BufferView.ByteStride > 0 ? BufferView.ByteStride : ElementBytes;
+		const int64 BufferViewSize = BufferView.bMeshOpt ? BufferView.MeshOptCount * BufferView.ByteStride : BufferView.ByteLength;
+
+		// the last element does not need the whole stride
+		if (Accessor.Count == 0)
+		{
+			Accessor.bInBounds = Accessor.ByteOffset <= BufferViewSize;
+		}
+		else if (Accessor.ByteOffset <= BufferViewSize && ElementBytes <= BufferViewSize - Accessor.ByteOffset)
+		{
+			Accessor.bInBounds = Accessor.Count - 1 <= (BufferViewSize - Accessor.ByteOffset - ElementBytes) / Stride;
+		}
+	}
+}
+
+const FglTFRuntimeAccessorDescriptor* FglTFRuntimeParser::GetAccessorDescriptor(const int32 AccessorIndex) const
+{
+	if (!AccessorDescriptors.IsValidIndex(AccessorIndex) || !AccessorDescriptors[AccessorIndex].bValid)
+	{
+		return nullptr;
+	}
+	return &AccessorDescriptors[AccessorIndex];
+}
+
+const FglTFRuntimeBufferViewDescriptor* FglTFRuntimeParser::GetBufferViewDescriptor(const int32 BufferViewIndex) const
+{
+	if (!BufferViewDescriptors.IsValidIndex(BufferViewIndex) || !BufferViewDescriptors[BufferViewIndex].bValid)
+	{
+		return nullptr;
+	}
+	return &BufferViewDescriptors[BufferViewIndex];
+}
+
 void FglTFRuntimeParser::AddReferencedObjects(FReferenceCollector& Collector)
 {
+	FScopeLock Lock(&ObjectsCacheLock);
 	Collector.AddReferencedObjects(StaticMeshesCache);
 	Collector.AddReferencedObjects(MaterialsCache);
 	Collector.AddReferencedObjects(SkeletonsCache);
@@ -5136,8 +6159,163 @@ void FglTFRuntimeParser::AddReferencedObjects(FReferenceCollector& Collector)
 	Collector.AddReferencedObjects(ClearCoatMaterialsMap);
 }
 
+FglTFRuntimeCacheStats FglTFRuntimeParser::GetCacheStats() const
+{
+	FScopeLock Lock(&CachesLock);
+	FScopeLock ObjectsLock(&ObjectsCacheLock);
+
+	FglTFRuntimeCacheStats Stats;
+
+	Stats.BuffersBytes = CachedBytes[static_cast<int32>(EglTFRuntimeCacheKind::Buffers)];
+	Stats.CompressedBufferViewsBytes = CachedBytes[static_cast<int32>(EglTFRuntimeCacheKind::CompressedBufferViews)];
+	Stats.SparseAccessorsBytes = CachedBytes[static_cast<int32>(EglTFRuntimeCacheKind::SparseAccessors)];
+	Stats.ImagesBytes = CachedBytes[static_cast<int32>(EglTFRuntimeCacheKind::Images)];
+	Stats.ZeroBufferBytes = ZeroBuffer ? ZeroBuffer->Num() : 0;
+	Stats.LODsBytes = CachedBytes[static_cast<int32>(EglTFRuntimeCacheKind::LODs)];
+	Stats.PinnedBytes = PinnedCacheBytes;
+
+	Stats.StaticMeshes = StaticMeshesCache.Num();
+	Stats.SkeletalMeshes = SkeletalMeshesCache.Num();
+	Stats.Skeletons = SkeletonsCache.Num();
+	Stats.Materials = MaterialsCache.Num();
+	Stats.Textures = TexturesCache.Num();
+
+	Stats.DerivedDataHits = DerivedDataHits;
+	Stats.DerivedDataMisses = DerivedDataMisses;
+
+	return Stats;
+}
+
+FglTFRuntimeMeshOptimizationStats FglTFRuntimeParser::GetMeshOptimizationStats() const
+{
+	FScopeLock Lock(&MeshOptimizationStatsLock);
+	return MeshOptimizationStats;
+}
+
+void FglTFRuntimeParser::AddMeshOptimizationStats(const FglTFRuntimeMeshOptimizationStats& Stats)
+{
+	FScopeLock Lock(&MeshOptimizationStatsLock);
+	MeshOptimizationStats.Append(Stats);
+}
+
+void FglTFRuntimeParser::TrimCache(const bool bIncludeLODs)
+{
+	TrimCache(bIncludeLODs, nullptr);
+}
+
+void FglTFRuntimeParser::TrimCache(const bool bIncludeLODs, const FglTFRuntimeCacheEntry* ExemptEntry)
+{
+	if (CacheBytesBudget <= 0)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&CachesLock);
+
+	int64 CacheBytes = 0;
+	for (int32 KindIndex = 0; KindIndex < static_cast<int32>(EglTFRuntimeCacheKind::Num); KindIndex++)
+	{
+		if (bIncludeLODs || KindIndex != static_cast<int32>(EglTFRuntimeCacheKind::LODs))
+		{
+			CacheBytes += CachedBytes[KindIndex];
+		}
+	}
+
+	// the zero buffer is cheap to rebuild, drop it first
+	if (ZeroBuffer)
+	{
+		CacheBytes += ZeroBuffer->Num();
+		if (CacheBytes > CacheBytesBudget)
+		{
+			CacheBytes -= ZeroBuffer->Num();
+			ZeroBuffer.Reset();
+		}
+	}
+
+	while (CacheBytes > CacheBytesBudget)
+	{
+		// the exempt entry is the most recent one, when it reaches the head there is nothing else to evict
+		FglTFRuntimeCacheEntry* OldestEntry = BinaryCacheList.Head != ExemptEntry ? BinaryCacheList.Head : nullptr;
+		if (bIncludeLODs && LODsCacheList.Head && (!OldestEntry || LODsCacheList.Head->LastUse < OldestEntry->LastUse))
+		{
+			OldestEntry = LODsCacheList.Head;
+		}
+
+		if (!OldestEntry)
+		{
+			break;
+		}
+
+		CacheBytes -= OldestEntry->Bytes;
+		RemoveFromCache(OldestEntry);
+	}
+
+	// what is left over budget is pinned (or the entry being added), report it once per overflow
+	if (CacheBytes > CacheBytesBudget)
+	{
+		if (!bCacheOverBudgetLogged)
+		{
+			UE_LOG(LogGLTFRuntime, Warning, TEXT("Cache is %lld bytes over its budget of %lld bytes (%lld pinned bytes cannot be evicted yet)"), static_cast<long long>(CacheBytes - CacheBytesBudget), static_cast<long long>(CacheBytesBudget), static_cast<long long>(PinnedCacheBytes));
+			bCacheOverBudgetLogged = true;
+		}
+	}
+	else
+	{
+		bCacheOverBudgetLogged = false;
+	}
+}
+
+void FglTFRuntimeParser::RemoveFromCache(FglTFRuntimeCacheEntry* Entry)
+{
+	FScopeLock Lock(&CachesLock);
+
+	CachedBytes[static_cast<int32>(Entry->Kind)] -= Entry->Bytes;
+
+	if (Entry->bPinned)
+	{
+		PinnedCacheBytes -= Entry->Bytes;
+	}
+	else
+	{
+		(Entry->Kind == EglTFRuntimeCacheKind::LODs ? LODsCacheList : BinaryCacheList).Unlink(Entry);
+	}
+
+	if (Entry->Kind == EglTFRuntimeCacheKind::LODs)
+	{
+		const TSharedRef<FJsonObject> Key = Entry->JsonMeshObject.ToSharedRef();
+		LODsCache.Remove(Key);
+		// this destroys the entry
+		LODsCacheEntries.Remove(Key);
+		return;
+	}
+
+	const int32 Key = Entry->Index;
+	switch (Entry->Kind)
+	{
+	case EglTFRuntimeCacheKind::Buffers:
+		BuffersCache.Remove(Key);
+		BuffersCacheEntries.Remove(Key);
+		break;
+	case EglTFRuntimeCacheKind::Images:
+		ImagesCache.Remove(Key);
+		ImagesCacheEntries.Remove(Key);
+		break;
+	case EglTFRuntimeCacheKind::CompressedBufferViews:
+		CompressedBufferViewsCache.Remove(Key);
+		CompressedBufferViewsCacheEntries.Remove(Key);
+		break;
+	case EglTFRuntimeCacheKind::SparseAccessors:
+		SparseAccessorsCache.Remove(Key);
+		SparseAccessorsCacheEntries.Remove(Key);
+		break;
+	default:
+		break;
+	}
+}
+
 void FglTFRuntimeParser::ClearCache()
 {
+	FScopeLock Lock(&ObjectsCacheLock);
 	StaticMeshesCache.Empty();
 	MaterialsCache.Empty();
 	SkeletonsCache.Empty();
@@ -5195,6 +6373,12 @@ bool FglTFRuntimeParser::MergePrimitives(TArray<FglTFRuntimePrimitive> SourcePri
 		return false;
 	}
 
+	// merging works on the double precision streams
+	for (FglTFRuntimePrimitive& SourcePrimitive : SourcePrimitives)
+	{
+		SourcePrimitive.ExpandCompactVertexData();
+	}
+
 	FglTFRuntimePrimitive& MainPrimitive = SourcePrimitives[0];
 	for (FglTFRuntimePrimitive& SourcePrimitive : SourcePrimitives)
 	{
@@ -5420,144 +6604,314 @@ void FglTFRuntimeArchiveZip::SetPassword(const FString& EncryptionKey)
 	Password.Append(reinterpret_cast<const uint8*>(UTF8Conversion.Get()), UTF8Conversion.Length());
 }
 
-bool FglTFRuntimeArchiveZip::FromData(const uint8* DataPtr, const int64 DataNum)
+void FglTFRuntimeArchiveZip::ApplyConfig(const FglTFRuntimeConfig& LoaderConfig)
+{
+	if (!LoaderConfig.EncryptionKey.IsEmpty())
+	{
+		SetPassword(LoaderConfig.EncryptionKey);
+	}
+
+	if (LoaderConfig.PasswordPromptHook.IsBound())
+	{
+		PromptHook = LoaderConfig.PasswordPromptHook;
+	}
+
+	if (LoaderConfig.AESDecrypterHook.IsBound())
+	{
+		AESDecrypterHook = LoaderConfig.AESDecrypterHook;
+	}
+}
+
+FglTFRuntimeArchiveRandomAccess::FglTFRuntimeArchiveRandomAccess()
+{
+	FileSize = 0;
+}
+
+FglTFRuntimeArchiveRandomAccess::~FglTFRuntimeArchiveRandomAccess()
+{
+}
+
+void FglTFRuntimeArchiveRandomAccess::OpenStorage(FglTFRuntimeBytesStorageRef InStorage)
+{
+	Storage = InStorage;
+	FileHandle.Reset();
+	FileSize = 0;
+}
+
+bool FglTFRuntimeArchiveRandomAccess::OpenFile(const FString& Filename)
+{
+	Storage = nullptr;
+	FileHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*Filename));
+	if (!FileHandle)
+	{
+		return false;
+	}
+
+	FileSize = FileHandle->Size();
+	return true;
+}
+
+int64 FglTFRuntimeArchiveRandomAccess::GetArchiveSize() const
+{
+	return Storage ? Storage->Num() : FileSize;
+}
+
+bool FglTFRuntimeArchiveRandomAccess::IsValidRange(const int64 Offset, const int64 Size) const
+{
+	// offsets and sizes can come from crafted 64 bit fields, never sum them before checking them
+	const int64 ArchiveSize = GetArchiveSize();
+	return Offset >= 0 && Size >= 0 && Offset <= ArchiveSize && Size <= ArchiveSize - Offset;
+}
+
+bool FglTFRuntimeArchiveRandomAccess::ReadBytes(const int64 Offset, const int64 Size, uint8* OutData) const
 {
-	Data.Append(DataPtr, DataNum);
+	if (!IsValidRange(Offset, Size))
+	{
+		return false;
+	}
+
+	if (Storage)
+	{
+		FMemory::Memcpy(OutData, Storage->GetData() + Offset, Size);
+		return true;
+	}
+
+	if (!FileHandle)
+	{
+		return false;
+	}
+
+	FScopeLock Lock(&FileHandleLock);
+	return FileHandle->Seek(Offset) && FileHandle->Read(OutData, Size);
+}
+
+const uint8* FglTFRuntimeArchiveRandomAccess::GetBytes(const int64 Offset, const int64 Size, TArray64<uint8>& Scratch) const
+{
+	if (!IsValidRange(Offset, Size))
+	{
+		return nullptr;
+	}
+
+	if (Storage)
+	{
+		return Storage->GetData() + Offset;
+	}
+
+	// never return nullptr for empty entries
+	Scratch.SetNumUninitialized(FMath::Max<int64>(Size, 1));
+	if (!ReadBytes(Offset, Size, Scratch.GetData()))
+	{
+		return nullptr;
+	}
+
+	return Scratch.GetData();
+}
 
-	// step0: retrieve the trailer magic
-	TArray<uint8> Magic;
-	bool bIndexFound = false;
-	uint64 Index = 0;
-	for (Index = Data.Num() - 1; Index >= 0; Index--)
+namespace glTFRuntime
+{
+	// ZIP64 extended information: only the values saturated in the record are stored (in this order)
+	void ParseZip64ExtraField(const uint8* ExtraField, const int64 ExtraFieldLen, uint64& UncompressedSize, uint64& CompressedSize, int64* LocalHeaderOffset)
 	{
-		Magic.Insert(Data[Index], 0);
-		if (Magic.Num() == 4)
+		int64 Offset = 0;
+		while (Offset + 4 <= ExtraFieldLen)
 		{
-			if (Magic[0] == 0x50 && Magic[1] == 0x4b && Magic[2] == 0x05 && Magic[3] == 0x06)
+			uint16 FieldType;
+			uint16 FieldSize;
+			FMemory::Memcpy(&FieldType, ExtraField + Offset, sizeof(uint16));
+			FMemory::Memcpy(&FieldSize, ExtraField + Offset + 2, sizeof(uint16));
+			Offset += 4;
+
+			if (Offset + FieldSize > ExtraFieldLen)
 			{
-				bIndexFound = true;
-				break;
+				return;
+			}
+
+			if (FieldType == 0x0001)
+			{
+				int64 FieldOffset = Offset;
+				auto ReadSaturatedValue = [ExtraField, &FieldOffset, Offset, FieldSize](uint64& Value)
+					{
+						if (Value == MAX_uint32 && FieldOffset + 8 <= Offset + FieldSize)
+						{
+							FMemory::Memcpy(&Value, ExtraField + FieldOffset, sizeof(uint64));
+							FieldOffset += 8;
+						}
+					};
+
+				ReadSaturatedValue(UncompressedSize);
+				ReadSaturatedValue(CompressedSize);
+				if (LocalHeaderOffset)
+				{
+					uint64 Value = static_cast<uint64>(*LocalHeaderOffset);
+					ReadSaturatedValue(Value);
+					*LocalHeaderOffset = static_cast<int64>(Value);
+				}
+				return;
 			}
-			Magic.Pop();
+
+			Offset += FieldSize;
 		}
 	}
+}
+
+bool FglTFRuntimeArchiveZip::FromData(const uint8* DataPtr, const int64 DataNum)
+{
+	return FromStorage(FglTFRuntimeBytesStorage::FromCopy(DataPtr, DataNum));
+}
+
+bool FglTFRuntimeArchiveZip::FromStorage(FglTFRuntimeBytesStorageRef InStorage)
+{
+	OpenStorage(InStorage);
+	return ParseCentralDirectory();
+}
+
+bool FglTFRuntimeArchiveZip::FromFile(const FString& Filename)
+{
+	if (!OpenFile(Filename))
+	{
+		return false;
+	}
+
+	return ParseCentralDirectory();
+}
+
+bool FglTFRuntimeArchiveZip::ParseCentralDirectory()
+{
+	constexpr int64 TrailerMinSize = 22;
+	constexpr int64 CentralDirectoryMinSize = 46;
+	constexpr int64 Zip64LocatorSize = 20;
+	constexpr int64 Zip64TrailerMinSize = 56;
 
-	if (!bIndexFound)
+	const int64 ArchiveSize = GetArchiveSize();
+	if (ArchiveSize < TrailerMinSize)
 	{
 		return false;
 	}
 
-	uint16 DiskEntries = 0;
-	uint16 TotalEntries = 0;
-	uint32 CentralDirectorySize = 0;
-	uint32 CentralDirectoryOffset = 0;
-	uint16 CommentLen = 0;
+	// step0: retrieve the trailer magic, it can only be followed by a comment (max 64k)
+	const int64 TailSize = FMath::Min<int64>(ArchiveSize, TrailerMinSize + MAX_uint16);
+	const int64 TailOffset = ArchiveSize - TailSize;
+	TArray64<uint8> TailScratch;
+	const uint8* Tail = GetBytes(TailOffset, TailSize, TailScratch);
+	if (!Tail)
+	{
+		return false;
+	}
 
-	constexpr uint64 TrailerMinSize = 22;
-	constexpr uint64 CentralDirectoryMinSize = 46;
+	int64 Index = INDEX_NONE;
+	for (int64 TailIndex = TailSize - TrailerMinSize; TailIndex >= 0; TailIndex--)
+	{
+		if (Tail[TailIndex] == 0x50 && Tail[TailIndex + 1] == 0x4b && Tail[TailIndex + 2] == 0x05 && Tail[TailIndex + 3] == 0x06)
+		{
+			Index = TailIndex;
+			break;
+		}
+	}
 
-	if (Index + TrailerMinSize > Data.Num())
+	if (Index == INDEX_NONE)
 	{
 		return false;
 	}
 
 	// skip signature and disk data
-	Data.Seek(Index + 8);
-	Data << DiskEntries;
-	Data << TotalEntries;
-	Data << CentralDirectorySize;
-	Data << CentralDirectoryOffset;
-	Data << CommentLen;
-
-	uint16 DirectoryEntries = FMath::Min(DiskEntries, TotalEntries);
+	uint64 DirectoryEntries = FMath::Min(ReadValue<uint16>(Tail, Index + 8), ReadValue<uint16>(Tail, Index + 10));
+	int64 CentralDirectorySize = ReadValue<uint32>(Tail, Index + 12);
+	int64 CentralDirectoryOffset = ReadValue<uint32>(Tail, Index + 16);
 
-	for (uint16 DirectoryIndex = 0; DirectoryIndex < DirectoryEntries; DirectoryIndex++)
+	// ZIP64 locator (if any) is just before the trailer
+	const int64 TrailerOffset = TailOffset + Index;
+	uint8 Zip64Locator[Zip64LocatorSize];
+	if (TrailerOffset >= Zip64LocatorSize && ReadBytes(TrailerOffset - Zip64LocatorSize, Zip64LocatorSize, Zip64Locator) && ReadValue<uint32>(Zip64Locator, 0) == 0x07064b50)
 	{
-		if (CentralDirectoryOffset + CentralDirectoryMinSize > Data.Num())
+		uint8 Zip64Trailer[Zip64TrailerMinSize];
+		if (!ReadBytes(ReadValue<int64>(Zip64Locator, 8), Zip64TrailerMinSize, Zip64Trailer) || ReadValue<uint32>(Zip64Trailer, 0) != 0x06064b50)
 		{
 			return false;
 		}
 
-		uint32 GlobalCompressedSize = 0;
-		uint32 GlobalUncompressedSize = 0;
-		uint16 FilenameLen = 0;
-		uint16 ExtraFieldLen = 0;
-		uint16 EntryCommentLen = 0;
-		uint32 EntryOffset = 0;
+		DirectoryEntries = FMath::Min(ReadValue<uint64>(Zip64Trailer, 24), ReadValue<uint64>(Zip64Trailer, 32));
+		CentralDirectorySize = ReadValue<int64>(Zip64Trailer, 40);
+		CentralDirectoryOffset = ReadValue<int64>(Zip64Trailer, 48);
+	}
+
+	TArray64<uint8> DirectoryScratch;
+	const uint8* Directory = GetBytes(CentralDirectoryOffset, CentralDirectorySize, DirectoryScratch);
+	if (!Directory)
+	{
+		return false;
+	}
+
+	int64 DirectoryOffset = 0;
+	for (uint64 DirectoryIndex = 0; DirectoryIndex < DirectoryEntries; DirectoryIndex++)
+	{
+		if (DirectoryOffset + CentralDirectoryMinSize > CentralDirectorySize)
+		{
+			return false;
+		}
 
-		// seek to CompressedSize
-		Data.Seek(CentralDirectoryOffset + 20);
-		Data << GlobalCompressedSize;
-		Data << GlobalUncompressedSize;
+		const uint8* Entry = Directory + DirectoryOffset;
 
-		// seek to FilenameLen
-		Data.Seek(CentralDirectoryOffset + 28);
-		Data << FilenameLen;
-		Data << ExtraFieldLen;
-		Data << EntryCommentLen;
-		// seek to EntryOffset
-		Data.Seek(CentralDirectoryOffset + 42);
-		Data << EntryOffset;
+		uint64 GlobalCompressedSize = ReadValue<uint32>(Entry, 20);
+		uint64 GlobalUncompressedSize = ReadValue<uint32>(Entry, 24);
+		const uint16 FilenameLen = ReadValue<uint16>(Entry, 28);
+		const uint16 ExtraFieldLen = ReadValue<uint16>(Entry, 30);
+		const uint16 EntryCommentLen = ReadValue<uint16>(Entry, 32);
+		int64 EntryOffset = ReadValue<uint32>(Entry, 42);
 
-		if (CentralDirectoryOffset + CentralDirectoryMinSize + FilenameLen + ExtraFieldLen + EntryCommentLen > Data.Num())
+		if (DirectoryOffset + CentralDirectoryMinSize + FilenameLen + ExtraFieldLen + EntryCommentLen > CentralDirectorySize)
 		{
 			return false;
 		}
 
+		glTFRuntime::ParseZip64ExtraField(Entry + CentralDirectoryMinSize + FilenameLen, ExtraFieldLen, GlobalUncompressedSize, GlobalCompressedSize, &EntryOffset);
+
 		TArray64<uint8> FilenameBytes;
-		FilenameBytes.Append(Data.GetData() + CentralDirectoryOffset + CentralDirectoryMinSize, FilenameLen);
+		FilenameBytes.Append(Entry + CentralDirectoryMinSize, FilenameLen);
 		FilenameBytes.Add(0);
 
 		FString Filename = FString(UTF8_TO_TCHAR(FilenameBytes.GetData()));
 
 		OffsetsMap.Add(Filename, EntryOffset);
-		GlobalSizeMap.Add(Filename, TPair<uint32, uint32>(GlobalCompressedSize, GlobalUncompressedSize));
+		GlobalSizeMap.Add(Filename, TPair<uint64, uint64>(GlobalCompressedSize, GlobalUncompressedSize));
 
-		CentralDirectoryOffset += CentralDirectoryMinSize + FilenameLen + ExtraFieldLen + EntryCommentLen;
+		DirectoryOffset += CentralDirectoryMinSize + FilenameLen + ExtraFieldLen + EntryCommentLen;
 	}
 
 	return true;
 }
 
-bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<uint8>& OutData)
+bool FglTFRuntimeArchiveZip::GetLocalEntry(const FString& Filename, uint16& Flags, uint16& Compression, int64& CompressedDataOffset, uint64& CompressedSize, uint64& UncompressedSize, TArray<uint8>& ExtraField) const
 {
-	uint32* Offset = OffsetsMap.Find(Filename);
+	const int64* Offset = OffsetsMap.Find(Filename);
 	if (!Offset)
 	{
 		return false;
 	}
 
-	constexpr uint64 LocalEntryMinSize = 30;
+	constexpr int64 LocalEntryMinSize = 30;
 
-	if (*Offset + LocalEntryMinSize > Data.Num())
+	uint8 LocalEntry[LocalEntryMinSize];
+	if (!ReadBytes(*Offset, LocalEntryMinSize, LocalEntry))
 	{
 		return false;
 	}
 
-	uint16 Flags = 0;
-	uint16 Compression = 0;
-	uint32 CompressedSize;
-	uint32 UncompressedSize = 0;
-	uint16 FilenameLen = 0;
-	uint16 ExtraFieldLen = 0;
-
-	// seek to Compression
-	Data.Seek(*Offset + 6);
-	Data << Flags;
-	Data << Compression;
-	// seek to CompressedSize
-	Data.Seek(*Offset + 18);
-	Data << CompressedSize;
-	Data << UncompressedSize;
-	Data << FilenameLen;
-	Data << ExtraFieldLen;
-
-	if (*Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen + CompressedSize > Data.Num())
+	Flags = ReadValue<uint16>(LocalEntry, 6);
+	Compression = ReadValue<uint16>(LocalEntry, 8);
+	CompressedSize = ReadValue<uint32>(LocalEntry, 18);
+	UncompressedSize = ReadValue<uint32>(LocalEntry, 22);
+	const uint16 FilenameLen = ReadValue<uint16>(LocalEntry, 26);
+	const uint16 ExtraFieldLen = ReadValue<uint16>(LocalEntry, 28);
+
+	ExtraField.SetNumUninitialized(ExtraFieldLen);
+	if (ExtraFieldLen > 0 && !ReadBytes(*Offset + LocalEntryMinSize + FilenameLen, ExtraFieldLen, ExtraField.GetData()))
 	{
 		return false;
 	}
 
-	const uint8* CompressedData = Data.GetData() + *Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen;
+	glTFRuntime::ParseZip64ExtraField(ExtraField.GetData(), ExtraFieldLen, UncompressedSize, CompressedSize, nullptr);
+
+	CompressedDataOffset = *Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen;
 
 	// for streamed zips
 
@@ -5571,6 +6925,58 @@ bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<ui
 		UncompressedSize = GlobalSizeMap[Filename].Value;
 	}
 
+	// the local header has been read, so CompressedDataOffset cannot overflow
+	return CompressedSize <= static_cast<uint64>(MAX_int64) && IsValidRange(CompressedDataOffset, static_cast<int64>(CompressedSize));
+}
+
+bool FglTFRuntimeArchiveZip::GetFileStorage(const FString& Filename, FglTFRuntimeBytesStoragePtr& OutStorage)
+{
+	uint16 Flags = 0;
+	uint16 Compression = 0;
+	int64 CompressedDataOffset = 0;
+	uint64 CompressedSize = 0;
+	uint64 UncompressedSize = 0;
+	TArray<uint8> ExtraField;
+
+	if (!GetLocalEntry(Filename, Flags, Compression, CompressedDataOffset, CompressedSize, UncompressedSize, ExtraField))
+	{
+		return false;
+	}
+
+	// stored and not encrypted? no need to copy it
+	if (Storage && !(Flags & 1) && Compression == 0 && CompressedSize == UncompressedSize)
+	{
+		OutStorage = FglTFRuntimeBytesStorage::FromView(Storage.ToSharedRef(), Storage->GetData() + CompressedDataOffset, UncompressedSize);
+		return true;
+	}
+
+	return FglTFRuntimeArchive::GetFileStorage(Filename, OutStorage);
+}
+
+bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<uint8>& OutData)
+{
+	uint16 Flags = 0;
+	uint16 Compression = 0;
+	int64 CompressedDataOffset = 0;
+	uint64 CompressedSize = 0;
+	uint64 UncompressedSize = 0;
+	TArray<uint8> ExtraField;
+
+	if (!GetLocalEntry(Filename, Flags, Compression, CompressedDataOffset, CompressedSize, UncompressedSize, ExtraField))
+	{
+		return false;
+	}
+
+	const int64 ExtraFieldLen = ExtraField.Num();
+	// stored entries of file based archives are read straight into OutData
+	const bool bReadInPlace = !Storage && !(Flags & 1) && Compression == 0 && CompressedSize == UncompressedSize;
+	TArray64<uint8> CompressedScratch;
+	const uint8* CompressedData = bReadInPlace ? nullptr : GetBytes(CompressedDataOffset, CompressedSize, CompressedScratch);
+	if (!bReadInPlace && !CompressedData)
+	{
+		return false;
+	}
+
 	// encrypted ?
 
 	// first check for password prompt
@@ -5624,8 +7030,6 @@ bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<ui
 			}
 
 			// TODO, probably I should generalize it to allow custom fields to be managed by the user
-			TArray64<uint8> ExtraField;
-			ExtraField.Append(Data.GetData() + *Offset + LocalEntryMinSize + FilenameLen, ExtraFieldLen);
 			uint32 ExtraFieldsOffset = 0;
 			// 0 is not a valid AES strength so it acts as a marker
 			uint8 AESEncryptionStrength = 0;
@@ -5669,8 +7073,15 @@ bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<ui
 				return false;
 			}
 
+			// the decrypter hooks work on 32bit arrays
+			if (CompressedSize > MAX_int32)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("ZIP entry '%s' is too big for AES decryption"), *Filename);
+				return false;
+			}
+
 			TArray<uint8> EnryptedData;
-			EnryptedData.Append(CompressedData, CompressedSize);
+			EnryptedData.Append(CompressedData, static_cast<int32>(CompressedSize));
 
 			if (IsInGameThread())
 			{
@@ -5704,7 +7115,8 @@ bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<ui
 		}
 		else // ZipCrypto?
 		{
-			if (*Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen + CompressedSize + 12 > Data.Num())
+			CompressedData = GetBytes(CompressedDataOffset, CompressedSize + 12, CompressedScratch);
+			if (!CompressedData)
 			{
 				return false;
 			}
@@ -5727,56 +7139,182 @@ bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<ui
 					Key2 = Crc32(Key1 >> 24, Key2);
 				};
 
-			for (const uint8& Byte : Password)
-			{
-				UpdateKeys(Byte);
-			}
+			for (const uint8& Byte : Password)
+			{
+				UpdateKeys(Byte);
+			}
+
+			for (int64 EncryptedIndex = 0; EncryptedIndex < static_cast<int64>(CompressedSize) + 12; EncryptedIndex++)
+			{
+				const uint16 Temp = Key2 | 2;
+				DecryptedData[EncryptedIndex] = CompressedData[EncryptedIndex] ^ ((Temp * (Temp ^ 1)) >> 8);
+				UpdateKeys(DecryptedData[EncryptedIndex]);
+			}
+
+			CompressedData = DecryptedData.GetData() + 12;
+			CompressedSize = DecryptedData.Num() - 12;
+		}
+	}
+
+	if (bClearPassword)
+	{
+		SetPassword(TEXT(""));
+	}
+
+	if (Compression == 8)
+	{
+		// Decompression-bomb guard (untrusted archives): DEFLATE's maximum expansion is 1032:1
+		// (RFC 1951; a 258-byte max-length match encoded as 2 bits => 258*8/2 = 1032). Anything
+		// larger than that from the actual compressed bytes is malformed/malicious.
+		constexpr uint64 MaxDeflateExpansion = 1032;
+		if (UncompressedSize > CompressedSize * MaxDeflateExpansion)
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Refusing ZIP entry '%s': declared uncompressed size %llu is implausible for %llu compressed bytes (possible decompression bomb)."), *Filename, UncompressedSize, CompressedSize);
+			return false;
+		}
+
+		if (UncompressedSize > MAX_int32 || CompressedSize > MAX_int32)
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("ZIP entry '%s' is too big for deflate decompression"), *Filename);
+			return false;
+		}
+
+		OutData.AddUninitialized(UncompressedSize);
+		if (!FCompression::UncompressMemory(NAME_Zlib, OutData.GetData(), static_cast<int32>(UncompressedSize), CompressedData, static_cast<int32>(CompressedSize), COMPRESS_NoFlags, -15))
+		{
+			return false;
+		}
+	}
+	else if (Compression == 0 && CompressedSize == UncompressedSize)
+	{
+		if (bReadInPlace)
+		{
+			const int64 DataOffset = OutData.Num();
+			OutData.AddUninitialized(UncompressedSize);
+			return ReadBytes(CompressedDataOffset, UncompressedSize, OutData.GetData() + DataOffset);
+		}
+		OutData.Append(CompressedData, UncompressedSize);
+	}
+	else
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Unknown ZIP Compression format"));
+		return false;
+	}
+
+	return true;
+}
+
+TSharedPtr<FglTFRuntimeMappedFile, ESPMode::ThreadSafe> FglTFRuntimeMappedFile::Open(const FString& Filename)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+	FOpenMappedResult OpenMappedResult = PlatformFile.OpenMappedEx(*Filename);
+	if (OpenMappedResult.HasError())
+	{
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to memory map file %s"), *Filename);
+		return nullptr;
+	}
+	TUniquePtr<IMappedFileHandle> MappedHandle = OpenMappedResult.StealValue();
+#else
+	TUniquePtr<IMappedFileHandle> MappedHandle = TUniquePtr<IMappedFileHandle>(PlatformFile.OpenMapped(*Filename));
+#endif
+	if (!MappedHandle)
+	{
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to memory map file %s"), *Filename);
+		return nullptr;
+	}
+
+	const int64 FileSize = MappedHandle->GetFileSize();
+	if (FileSize <= 0)
+	{
+		return nullptr;
+	}
+
+	TUniquePtr<IMappedFileRegion> MappedRegion = TUniquePtr<IMappedFileRegion>(MappedHandle->MapRegion(0, FileSize));
+	if (!MappedRegion)
+	{
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to map region of file %s"), *Filename);
+		return nullptr;
+	}
+
+	TSharedPtr<FglTFRuntimeMappedFile, ESPMode::ThreadSafe> MappedFile = MakeShared<FglTFRuntimeMappedFile, ESPMode::ThreadSafe>();
+	MappedFile->MappedHandle = MoveTemp(MappedHandle);
+	MappedFile->MappedRegion = MoveTemp(MappedRegion);
+	return MappedFile;
+}
+
+FglTFRuntimeBytesStorageRef FglTFRuntimeBytesStorage::FromArray(TArray64<uint8>&& InData)
+{
+	return MakeShared<FglTFRuntimeBytesStorageArray, ESPMode::ThreadSafe>(MoveTemp(InData));
+}
+
+FglTFRuntimeBytesStorageRef FglTFRuntimeBytesStorage::FromCopy(const uint8* InData, const int64 InNum)
+{
+	TArray64<uint8> Data;
+	Data.Append(InData, InNum);
+	return FromArray(MoveTemp(Data));
+}
+
+FglTFRuntimeBytesStorageRef FglTFRuntimeBytesStorage::FromView(FglTFRuntimeBytesStorageRef InOwner, const uint8* InData, const int64 InNum)
+{
+	// callers validate the range, never compute InData + InNum as it could overflow
+	check(InNum >= 0 && InData >= InOwner->GetData() && InNum <= InOwner->Num() - (InData - InOwner->GetData()));
+	return MakeShared<FglTFRuntimeBytesStorageView, ESPMode::ThreadSafe>(InOwner, InData, InNum);
+}
+
+// bump it whenever the layout of the cached data changes
+#define GLTFRUNTIME_DERIVED_DATA_VERSION 1
+
+FString FglTFRuntimeDerivedDataCache::GetFilename(const FString& Directory, const FString& Key)
+{
+	return FPaths::Combine(Directory, Key + TEXT(".bin"));
+}
+
+FString FglTFRuntimeDerivedDataCache::MakeKey(const FString& Bucket, const TArray<uint8>& KeyData)
+{
+	FSHA1 SHA1;
+	SHA1.Update(KeyData.GetData(), KeyData.Num());
+	SHA1.Final();
+	FSHAHash Hash;
+	SHA1.GetHash(Hash.Hash);
+
+	return FString::Printf(TEXT("%s_%d_%d_%d_%s"), *Bucket, ENGINE_MAJOR_VERSION, ENGINE_MINOR_VERSION, GLTFRUNTIME_DERIVED_DATA_VERSION, *Hash.ToString());
+}
 
-			for (int64 EncryptedIndex = 0; EncryptedIndex < CompressedSize + 12; EncryptedIndex++)
-			{
-				const uint16 Temp = Key2 | 2;
-				DecryptedData[EncryptedIndex] = CompressedData[EncryptedIndex] ^ ((Temp * (Temp ^ 1)) >> 8);
-				UpdateKeys(DecryptedData[EncryptedIndex]);
-			}
+bool FglTFRuntimeDerivedDataCache::Get(const FString& Directory, const FString& Key, TArray<uint8>& OutData)
+{
+	return FFileHelper::LoadFileToArray(OutData, *GetFilename(Directory, Key), FILEREAD_Silent);
+}
 
-			CompressedData = DecryptedData.GetData() + 12;
-			CompressedSize = DecryptedData.Num() - 12;
-		}
+bool FglTFRuntimeDerivedDataCache::Put(const FString& Directory, const FString& Key, const TArray<uint8>& Data)
+{
+	const FString Filename = GetFilename(Directory, Key);
+	// write to a unique temp file first, so concurrent readers never see partial data
+	const FString TempFilename = Filename + TEXT(".") + FGuid::NewGuid().ToString() + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(Data, *TempFilename))
+	{
+		return false;
 	}
 
-	if (bClearPassword)
+	if (!IFileManager::Get().Move(*Filename, *TempFilename, true, true))
 	{
-		SetPassword(TEXT(""));
+		IFileManager::Get().Delete(*TempFilename, false, false, true);
+		return false;
 	}
 
-	if (Compression == 8)
-	{
-		// Decompression-bomb guard (untrusted archives): DEFLATE's maximum expansion is 1032:1
-		// (RFC 1951; a 258-byte max-length match encoded as 2 bits => 258*8/2 = 1032). Anything
-		// larger than that from the actual compressed bytes is malformed/malicious.
-		constexpr uint64 MaxDeflateExpansion = 1032;
-		if (static_cast<uint64>(UncompressedSize) > static_cast<uint64>(CompressedSize) * MaxDeflateExpansion)
-		{
-			UE_LOG(LogGLTFRuntime, Error, TEXT("Refusing ZIP entry '%s': declared uncompressed size %u is implausible for %u compressed bytes (possible decompression bomb)."), *Filename, UncompressedSize, CompressedSize);
-			return false;
-		}
+	return true;
+}
 
-		OutData.AddUninitialized(UncompressedSize);
-		if (!FCompression::UncompressMemory(NAME_Zlib, OutData.GetData(), UncompressedSize, CompressedData, CompressedSize, COMPRESS_NoFlags, -15))
-		{
-			return false;
-		}
-	}
-	else if (Compression == 0 && CompressedSize == UncompressedSize)
-	{
-		OutData.Append(CompressedData, UncompressedSize);
-	}
-	else
+bool FglTFRuntimeArchive::GetFileStorage(const FString& Filename, FglTFRuntimeBytesStoragePtr& OutStorage)
+{
+	TArray64<uint8> Content;
+	if (!GetFileContent(Filename, Content))
 	{
-		UE_LOG(LogGLTFRuntime, Error, TEXT("Unknown ZIP Compression format"));
 		return false;
 	}
 
+	OutStorage = FglTFRuntimeBytesStorage::FromArray(MoveTemp(Content));
 	return true;
 }
 
@@ -5789,7 +7327,7 @@ void FglTFRuntimeArchive::Remap(const FString& From, const FString& To)
 {
 	if (OffsetsMap.Contains(From))
 	{
-		const uint32 CurrentValue = OffsetsMap[From];
+		const int64 CurrentValue = OffsetsMap[From];
 		OffsetsMap.Remove(From);
 		if (OffsetsMap.Contains(To))
 		{
@@ -5800,7 +7338,7 @@ void FglTFRuntimeArchive::Remap(const FString& From, const FString& To)
 
 	if (GlobalSizeMap.Contains(From))
 	{
-		const TPair<uint32, uint32> CurrentValue = GlobalSizeMap[From];
+		const TPair<uint64, uint64> CurrentValue = GlobalSizeMap[From];
 		GlobalSizeMap.Remove(From);
 		if (GlobalSizeMap.Contains(To))
 		{
@@ -5812,7 +7350,7 @@ void FglTFRuntimeArchive::Remap(const FString& From, const FString& To)
 
 FString FglTFRuntimeArchive::GetFirstFilenameByExtension(const FString& Extension) const
 {
-	for (const TPair<FString, uint32>& Pair : OffsetsMap)
+	for (const TPair<FString, int64>& Pair : OffsetsMap)
 	{
 		if (Pair.Key.EndsWith(Extension, ESearchCase::IgnoreCase))
 		{
@@ -5826,9 +7364,9 @@ FString FglTFRuntimeArchive::GetFirstFilenameByExtension(const FString& Extensio
 bool FglTFRuntimeParser::GetJsonObjectBytes(TSharedRef<FJsonObject> JsonObject, TArray64<uint8>& Bytes)
 {
 	FString Uri;
-	if (JsonObject->TryGetStringField(TEXT("uri"), Uri))
+	if (GetJsonObjectUri(JsonObject, Uri))
 	{
-		// check it is a valid base64 data uri
+		// check it is a valid base64 data uri (decoded straight into Bytes)
 		if (Uri.StartsWith("data:"))
 		{
 			if (!ParseBase64Uri(Uri, Bytes))
@@ -5843,35 +7381,7 @@ bool FglTFRuntimeParser::GetJsonObjectBytes(TSharedRef<FJsonObject> JsonObject,
 		}
 		else
 		{
-			if (UriRewriterHook.IsBound())
-			{
-				if (IsInGameThread())
-				{
-					if (UriRewriterHook.UriRewriter.IsBound())
-					{
-						Uri = UriRewriterHook.UriRewriter.Execute(Uri, UriRewriterHook.Context);
-					}
-					else if (UriRewriterHook.NativeUriRewriter.IsBound())
-					{
-						Uri = UriRewriterHook.NativeUriRewriter.Execute(Uri, UriRewriterHook.Context);
-					}
-				}
-				else
-				{
-					FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&]()
-						{
-							if (UriRewriterHook.UriRewriter.IsBound())
-							{
-								Uri = UriRewriterHook.UriRewriter.Execute(Uri, UriRewriterHook.Context);
-							}
-							else if (UriRewriterHook.NativeUriRewriter.IsBound())
-							{
-								Uri = UriRewriterHook.NativeUriRewriter.Execute(Uri, UriRewriterHook.Context);
-							}
-						}, TStatId(), nullptr, ENamedThreads::GameThread);
-					FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-				}
-			}
+			RewriteUri(Uri);
 
 			bool bFound = false;
 			if (Archive)
@@ -5942,6 +7452,35 @@ FVector glTFRuntime::ComputeTangentYWithW(const FVector Normal, const FVector Ta
 	return (Normal ^ TangetX) * W;
 }
 
+float glTFRuntime::GetDefaultLODScreenSize(const int32 LODIndex, const int32 NumLODs, const float Multiplier)
+{
+	const float DeltaScreenSize = (1.0f / NumLODs) / Multiplier;
+	return 1 - DeltaScreenSize * LODIndex;
+}
+
+void glTFRuntime::DecodeAccessorStreams(const TArray<FAccessorStream>& Streams)
+{
+	int64 Count = 0;
+	for (const FAccessorStream& Stream : Streams)
+	{
+		Count = FMath::Max(Count, Stream.Count);
+	}
+
+	const int32 NumBlocks = static_cast<int32>((Count + AccessorBlockSize - 1) / AccessorBlockSize);
+	ParallelFor(NumBlocks, [&](const int32 BlockIndex)
+		{
+			const int64 FirstElement = static_cast<int64>(BlockIndex) * AccessorBlockSize;
+			for (const FAccessorStream& Stream : Streams)
+			{
+				const int64 LastElement = FMath::Min(FirstElement + AccessorBlockSize, Stream.Count);
+				if (FirstElement < LastElement)
+				{
+					Stream.Decoder(FirstElement, LastElement);
+				}
+			}
+		}, NumBlocks < 2);
+}
+
 TArray<TSharedRef<FJsonObject>> FglTFRuntimeParser::GetMeshes() const
 {
 	TArray<TSharedRef<FJsonObject>> Meshes;
@@ -6048,6 +7587,7 @@ const FglTFRuntimeBlob* FglTFRuntimeParser::GetAdditionalBufferView(const int64
 		return nullptr;
 	}
 
+	FScopeLock Lock(&CachesLock);
 	const TMap<FString, FglTFRuntimeBlob>* Value = AdditionalBufferViewsCache.Find(Index);
 	if (!Value)
 	{
@@ -6071,6 +7611,7 @@ void FglTFRuntimeParser::AddAdditionalBufferView(const int64 Index, const FStrin
 		return;
 	}
 
+	FScopeLock Lock(&CachesLock);
 	if (!AdditionalBufferViewsCache.Contains(Index))
 	{
 		AdditionalBufferViewsCache.Add(Index);
@@ -6886,26 +8427,28 @@ bool FglTFRuntimeParser::GetBlobByName(const FString& Name, TArray64<uint8>& Blo
 	return Archive->GetFileContent(Name, Blob);
 }
 
-void FglTFRuntimeParser::LoadMeshAsRuntimeLODAsync(const int32 MeshIndex, const FglTFRuntimeMeshLODAsync& AsyncCallback, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
+FglTFRuntimeLoadHandleRef FglTFRuntimeParser::LoadMeshAsRuntimeLODAsync(const int32 MeshIndex, const FglTFRuntimeMeshLODAsync& AsyncCallback, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
 {
 	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
 	if (!JsonMeshObject)
 	{
+		FglTFRuntimeLoadHandleRef LoadHandle = MakeShared<FglTFRuntimeLoadHandle, ESPMode::ThreadSafe>();
+		LoadHandle->Complete();
 		AsyncCallback.ExecuteIfBound(false, FglTFRuntimeMeshLOD());
+		return LoadHandle;
 	}
 
-	Async(EAsyncExecution::Thread, [this, JsonMeshObject, MaterialsConfig, AsyncCallback]()
+	return LoadAsRuntimeLODAsync([this, JsonMeshObject, MaterialsConfig](FglTFRuntimeMeshLOD& RuntimeLOD, FglTFRuntimeLoadHandleRef LoadHandle)
 		{
-			FglTFRuntimeMeshLOD* LOD;
-			bool bSuccess = LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, MaterialsConfig);
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([bSuccess, LOD, AsyncCallback]()
-				{
-					AsyncCallback.ExecuteIfBound(bSuccess, bSuccess ? *LOD : FglTFRuntimeMeshLOD());
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		}
-
-	);
+			TSharedPtr<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe> LOD;
+			if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, MaterialsConfig, LoadHandle))
+			{
+				return false;
+			}
+			// the cached LOD can be shared with other loads
+			RuntimeLOD = *LOD;
+			return true;
+		}, AsyncCallback);
 }
 
 bool FglTFRuntimeParser::LoadPathToBlob(const FString& Path, TArray64<uint8>& Blob)
@@ -6980,6 +8523,15 @@ TArray<FString> FglTFRuntimeParser::GetAnimationsNames(const bool bIncludeUnname
 void FglTFRuntimeArchiveMap::FromMap(const TMap<FString, TArray64<uint8>> InMap)
 {
 	for (const TPair<FString, TArray64<uint8>>& Pair : InMap)
+	{
+		const int32 NewOffset = MapItems.Add(FglTFRuntimeBytesStorage::FromCopy(Pair.Value.GetData(), Pair.Value.Num()));
+		OffsetsMap.Add(Pair.Key, NewOffset);
+	}
+}
+
+void FglTFRuntimeArchiveMap::FromStorageMap(const TMap<FString, FglTFRuntimeBytesStorageRef>& InMap)
+{
+	for (const TPair<FString, FglTFRuntimeBytesStorageRef>& Pair : InMap)
 	{
 		const int32 NewOffset = MapItems.Add(Pair.Value);
 		OffsetsMap.Add(Pair.Key, NewOffset);
@@ -6987,6 +8539,20 @@ void FglTFRuntimeArchiveMap::FromMap(const TMap<FString, TArray64<uint8>> InMap)
 }
 
 bool FglTFRuntimeArchiveMap::GetFileContent(const FString& Filename, TArray64<uint8>& OutData)
+{
+	FglTFRuntimeBytesStoragePtr Storage;
+	if (!GetFileStorage(Filename, Storage))
+	{
+		return false;
+	}
+
+	OutData.Empty(Storage->Num());
+	OutData.Append(Storage->GetData(), Storage->Num());
+
+	return true;
+}
+
+bool FglTFRuntimeArchiveMap::GetFileStorage(const FString& Filename, FglTFRuntimeBytesStoragePtr& OutStorage)
 {
 	if (!OffsetsMap.Contains(Filename))
 	{
@@ -6998,11 +8564,306 @@ bool FglTFRuntimeArchiveMap::GetFileContent(const FString& Filename, TArray64<ui
 		return false;
 	}
 
-	OutData = MapItems[OffsetsMap[Filename]];
+	OutStorage = MapItems[OffsetsMap[Filename]];
+
+	return true;
+}
+
+namespace glTFRuntime
+{
+	FString GetTarString(const uint8* StringDataPtr, const int32 StringLen)
+	{
+		TArray<uint8> StringData;
+		StringData.Reserve(StringLen + 1);
+		for (int32 StringByteIndex = 0; StringByteIndex < StringLen; StringByteIndex++)
+		{
+			if (StringDataPtr[StringByteIndex] == 0)
+			{
+				break;
+			}
+
+			StringData.Add(StringDataPtr[StringByteIndex]);
+		}
+
+		StringData.Add(0);
+
+		return FString(UTF8_TO_TCHAR(StringData.GetData()));
+	}
+}
+
+FglTFRuntimeArchiveTar::~FglTFRuntimeArchiveTar()
+{
+	// the handle must be closed before removing the file
+	FileHandle.Reset();
+	if (!OwnedTempFilename.IsEmpty())
+	{
+		IFileManager::Get().Delete(*OwnedTempFilename, false, false, true);
+	}
+}
+
+bool FglTFRuntimeArchiveTar::IsTar(const uint8* DataPtr, const int64 DataNum)
+{
+	return DataNum % 512 == 0 && DataNum >= 10240 && DataPtr[257] == 'u' && DataPtr[258] == 's' && DataPtr[259] == 't' && DataPtr[260] == 'a' && DataPtr[261] == 'r';
+}
+
+bool FglTFRuntimeArchiveTar::FromData(const uint8* DataPtr, const int64 DataNum)
+{
+	return FromStorage(FglTFRuntimeBytesStorage::FromCopy(DataPtr, DataNum));
+}
+
+bool FglTFRuntimeArchiveTar::FromStorage(FglTFRuntimeBytesStorageRef InStorage)
+{
+	OpenStorage(InStorage);
+	return ParseHeaders();
+}
+
+bool FglTFRuntimeArchiveTar::FromFile(const FString& Filename)
+{
+	if (!OpenFile(Filename))
+	{
+		return false;
+	}
+
+	return ParseHeaders();
+}
+
+bool FglTFRuntimeArchiveTar::FromGzipFile(const FString& Filename, const FString& TempFilename)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Filename));
+	if (!Reader)
+	{
+		return false;
+	}
+
+	// the temp file is created only when the first inflated 512 bytes are a tar header
+	TUniquePtr<FArchive> Writer;
+	TArray<uint8> TarHeader;
+
+	const int64 CompressedSize = Reader->TotalSize();
+	constexpr int64 ChunkSize = 256 * 1024;
+
+	TArray<uint8> InChunk;
+	InChunk.AddUninitialized(ChunkSize);
+	TArray<uint8> OutChunk;
+	OutChunk.AddUninitialized(ChunkSize);
+
+	z_stream Stream;
+	FMemory::Memzero(Stream);
+	// 16 + MAX_WBITS enables the gzip wrapper
+	if (inflateInit2(&Stream, 16 + MAX_WBITS) != Z_OK)
+	{
+		return false;
+	}
+
+	bool bSuccess = true;
+	bool bStreamEnded = false;
+	bool bTrailingData = false;
+	uint64 TotalOut = 0;
+	int64 Offset = 0;
+
+	while (bSuccess && !bTrailingData && Offset < CompressedSize)
+	{
+		const int64 InSize = FMath::Min(ChunkSize, CompressedSize - Offset);
+		Reader->Serialize(InChunk.GetData(), InSize);
+		if (Reader->IsError())
+		{
+			bSuccess = false;
+			break;
+		}
+		Offset += InSize;
+
+		Stream.next_in = InChunk.GetData();
+		Stream.avail_in = static_cast<uInt>(InSize);
+
+		while (Stream.avail_in > 0)
+		{
+			// concatenated members
+			if (bStreamEnded)
+			{
+				// zero padding (tar blocking, tape devices) or garbage after the last member are ignored like gzip does
+				if (*Stream.next_in != 0x1F)
+				{
+					UE_LOG(LogGLTFRuntime, Verbose, TEXT("Ignoring %lld trailing bytes after the last Gzip member of %s"), static_cast<long long>(CompressedSize - Offset + Stream.avail_in), *Filename);
+					bTrailingData = true;
+					break;
+				}
+				inflateReset(&Stream);
+				bStreamEnded = false;
+			}
+
+			const int64 OutSize = Writer ? ChunkSize : 512 - TarHeader.Num();
+			Stream.next_out = OutChunk.GetData();
+			Stream.avail_out = static_cast<uInt>(OutSize);
+
+			const int32 Result = inflate(&Stream, Z_NO_FLUSH);
+			if (Result != Z_OK && Result != Z_STREAM_END)
+			{
+				bSuccess = false;
+				break;
+			}
+
+			const int64 Produced = OutSize - Stream.avail_out;
+			TotalOut += Produced;
+			if (TotalOut > static_cast<uint64>(CompressedSize) * glTFRuntime::GzipMaxDeflateExpansion)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Refusing Gzip data: uncompressed output is implausible for %lld compressed bytes (possible decompression bomb)."), static_cast<long long>(CompressedSize));
+				bSuccess = false;
+				break;
+			}
+
+			if (Writer)
+			{
+				Writer->Serialize(OutChunk.GetData(), Produced);
+			}
+			else
+			{
+				TarHeader.Append(OutChunk.GetData(), Produced);
+				if (TarHeader.Num() == 512)
+				{
+					// not a tar, nothing is inflated any further
+					if (FMemory::Memcmp(TarHeader.GetData() + 257, "ustar", 5) != 0)
+					{
+						bSuccess = false;
+						break;
+					}
+
+					Writer.Reset(IFileManager::Get().CreateFileWriter(*TempFilename));
+					if (!Writer)
+					{
+						bSuccess = false;
+						break;
+					}
+					OwnedTempFilename = TempFilename;
+					Writer->Serialize(TarHeader.GetData(), TarHeader.Num());
+				}
+			}
+
+			if (Result == Z_STREAM_END)
+			{
+				bStreamEnded = true;
+			}
+			// no progress (truncated data)
+			else if (Produced == 0 && Stream.avail_in > 0)
+			{
+				bSuccess = false;
+				break;
+			}
+		}
+	}
+
+	inflateEnd(&Stream);
+
+	bSuccess = bSuccess && bStreamEnded && Writer && Writer->Close();
+	Writer.Reset();
+	Reader.Reset();
+
+	if (!bSuccess || !OpenFile(TempFilename))
+	{
+		return false;
+	}
+
+	TArray64<uint8> Scratch;
+	const uint8* Header = GetBytes(0, 512, Scratch);
+	if (!Header || !IsTar(Header, FileSize))
+	{
+		return false;
+	}
+
+	return ParseHeaders();
+}
+
+bool FglTFRuntimeArchiveTar::ParseHeaders()
+{
+	const int64 ArchiveSize = GetArchiveSize();
+	TArray64<uint8> Scratch;
+
+	int64 ByteIndex = 0;
+	while (ByteIndex + 512 <= ArchiveSize)
+	{
+		const uint8* Block = GetBytes(ByteIndex, 512, Scratch);
+		if (!Block)
+		{
+			return false;
+		}
+		ByteIndex += 512;
+
+		// end of archive ?
+		if (Block[0] == 0)
+		{
+			// no entry ? assume error
+			return OffsetsMap.Num() > 0;
+		}
+
+		if (Block[257] != 'u' || Block[258] != 's' || Block[259] != 't' || Block[260] != 'a' || Block[261] != 'r')
+		{
+			return false;
+		}
+
+		const FString BlockSizeString = glTFRuntime::GetTarString(Block + 124, 12);
+		int64 EntrySize = 0;
+		for (const TCHAR& BlockSizeChar : BlockSizeString)
+		{
+			EntrySize *= 8;
+			EntrySize += static_cast<char>(BlockSizeChar) - '0';
+		}
+
+		const int64 BlockSize = Align(EntrySize, 512);
+
+		if (EntrySize < 0 || ByteIndex + BlockSize > ArchiveSize)
+		{
+			return false;
+		}
+
+		if (Block[156] == 0 || Block[156] == '0' || Block[156] == '5' || Block[156] == '7')
+		{
+			const FString TarFilename = glTFRuntime::GetTarString(Block, 100);
+			OffsetsMap.Add(TarFilename, ByteIndex);
+			GlobalSizeMap.Add(TarFilename, TPair<uint64, uint64>(EntrySize, EntrySize));
+		}
+
+		ByteIndex += BlockSize;
+	}
 
 	return true;
 }
 
+bool FglTFRuntimeArchiveTar::GetFileContent(const FString& Filename, TArray64<uint8>& OutData)
+{
+	if (!OffsetsMap.Contains(Filename) || !GlobalSizeMap.Contains(Filename))
+	{
+		return false;
+	}
+
+	const int64 Offset = OffsetsMap[Filename];
+	const int64 Size = static_cast<int64>(GlobalSizeMap[Filename].Value);
+
+	OutData.SetNumUninitialized(Size);
+	return ReadBytes(Offset, Size, OutData.GetData());
+}
+
+bool FglTFRuntimeArchiveTar::GetFileStorage(const FString& Filename, FglTFRuntimeBytesStoragePtr& OutStorage)
+{
+	if (Storage)
+	{
+		if (!OffsetsMap.Contains(Filename) || !GlobalSizeMap.Contains(Filename))
+		{
+			return false;
+		}
+
+		const int64 Offset = OffsetsMap[Filename];
+		const int64 Size = static_cast<int64>(GlobalSizeMap[Filename].Value);
+		if (!IsValidRange(Offset, Size))
+		{
+			return false;
+		}
+
+		OutStorage = FglTFRuntimeBytesStorage::FromView(Storage.ToSharedRef(), Storage->GetData() + Offset, Size);
+		return true;
+	}
+
+	return FglTFRuntimeArchive::GetFileStorage(Filename, OutStorage);
+}
+
 void FglTFRuntimeParser::FillAssetUserData(const int32 Index, IInterface_AssetUserData* InObject)
 {
 	for (TSubclassOf<UglTFRuntimeAssetUserData> AssetUserDataClass : AssetUserDataClasses)
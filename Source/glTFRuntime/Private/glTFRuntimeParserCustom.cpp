@@ -68,7 +68,7 @@ TSharedPtr<FJsonValue> FglTFRuntimeParser::GetJSONObjectFromRelativePath(TShared
 
 TSharedPtr<FJsonValue> FglTFRuntimeParser::GetJSONObjectFromPath(const TArray<FglTFRuntimePathItem>& Path) const
 {
-	return GetJSONObjectFromRelativePath(Root, Path);
+	return GetJSONObjectFromRelativePath(GetJsonRoot().ToSharedRef(), Path);
 }
 
 FString FglTFRuntimeParser::GetJSONStringFromPath(const TArray<FglTFRuntimePathItem>& Path, bool& bFound) const
@@ -7,6 +7,7 @@
 #include "IImageWrapper.h"
 #include "ImageUtils.h"
 #include "Misc/FileHelper.h"
+#include "Misc/SecureHash.h"
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 2
 #include "MaterialDomain.h"
 #else
@@ -16,6 +17,8 @@
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Math/UnrealMathUtility.h"
 #include "Modules/ModuleManager.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 #include "TextureResource.h"
 
 
@@ -461,7 +464,7 @@ UTexture2D* FglTFRuntimeParser::BuildTexture(UObject* Outer, const TArray<FglTFR
 
 	if (Mips[0].TextureIndex >= 0)
 	{
-		TexturesCache.Add(Mips[0].TextureIndex, Texture);
+		AddToObjectsCache(TexturesCache, Mips[0].TextureIndex, Texture);
 	}
 
 	FillAssetUserData(Mips[0].TextureIndex, Texture);
@@ -1103,6 +1106,22 @@ bool FglTFRuntimeParser::LoadImageBytes(const int32 ImageIndex, TSharedPtr<FJson
 		return false;
 	}
 
+	// prefetched from the archive ?
+	FglTFRuntimeBytesStoragePtr PrefetchedImage;
+	{
+		FScopeLock Lock(&CachesLock);
+		if (FglTFRuntimeBytesStorageRef* CachedImage = ImagesCache.Find(ImageIndex))
+		{
+			PrefetchedImage = *CachedImage;
+			RemoveFromCache(ImagesCacheEntries[ImageIndex].Get());
+		}
+	}
+
+	if (PrefetchedImage)
+	{
+		Bytes.Append(PrefetchedImage->GetData(), PrefetchedImage->Num());
+		return true;
+	}
 
 	if (!GetJsonObjectBytes(JsonImageObject.ToSharedRef(), Bytes))
 	{
@@ -1140,9 +1159,9 @@ UTexture2D* FglTFRuntimeParser::LoadTexture(const int32 TextureIndex, TArray<Fgl
 	}
 
 	// first check cache
-	if (TexturesCache.Contains(TextureIndex))
+	if (UTexture2D* CachedTexture = FindInObjectsCache<UTexture2D>(TexturesCache, TextureIndex))
 	{
-		return TexturesCache[TextureIndex];
+		return CachedTexture;
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>* JsonTextures;
@@ -1258,6 +1277,10 @@ UTexture2D* FglTFRuntimeParser::LoadTexture(const int32 TextureIndex, TArray<Fgl
 
 bool FglTFRuntimeParser::LoadBlobToMips(const int32 TextureIndex, TSharedRef<FJsonObject> JsonTextureObject, TSharedRef<FJsonObject> JsonImageObject, const TArray64<uint8>& Blob, TArray<FglTFRuntimeMipMap>& Mips, const bool sRGB, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
 {
+	const FString DerivedDataKey = Mips.Num() == 0 ? GetMipsDerivedDataKey(JsonImageObject, Blob, sRGB, MaterialsConfig) : FString();
+	// on hit Mips is no more empty, so the decoding steps below are skipped
+	const bool bMipsFromDerivedDataCache = LoadMipsFromDerivedDataCache(DerivedDataKey, TextureIndex, Mips);
+
 	if (MaterialsConfig.bLoadMipMaps)
 	{
 		OnTextureMips.Broadcast(AsShared(), TextureIndex, JsonTextureObject, JsonImageObject, Blob, Mips, MaterialsConfig.ImagesConfig);
@@ -1372,11 +1395,108 @@ bool FglTFRuntimeParser::LoadBlobToMips(const int32 TextureIndex, TSharedRef<FJs
 		}
 	}
 
+	if (!bMipsFromDerivedDataCache)
+	{
+		StoreMipsToDerivedDataCache(DerivedDataKey, Mips);
+	}
+
 	OnTextureFilterMips.Broadcast(AsShared(), Mips, MaterialsConfig.ImagesConfig);
 
 	return true;
 }
 
+FString FglTFRuntimeParser::GetMipsDerivedDataKey(TSharedRef<FJsonObject> JsonImageObject, const TArray64<uint8>& Blob, const bool sRGB, const FglTFRuntimeMaterialsConfig& MaterialsConfig) const
+{
+	// mips generated or altered by delegates cannot be cached
+	if (DerivedDataCacheDirectory.IsEmpty() || OnTextureMips.IsBound() || OnLoadedTexturePixels.IsBound())
+	{
+		return "";
+	}
+
+	FSHA1 SHA1;
+	SHA1.Update(Blob.GetData(), Blob.Num());
+	SHA1.Final();
+	FSHAHash BlobHash;
+	SHA1.GetHash(BlobHash.Hash);
+
+	FString MimeType;
+	JsonImageObject->TryGetStringField(TEXT("mimeType"), MimeType);
+
+	FglTFRuntimeImagesConfig ImagesConfig = MaterialsConfig.ImagesConfig;
+	bool bSRGB = sRGB;
+	bool bLoadMipMaps = MaterialsConfig.bLoadMipMaps;
+	bool bGeneratesMipMaps = MaterialsConfig.bGeneratesMipMaps;
+
+	TArray<uint8> KeyData;
+	FMemoryWriter Writer(KeyData);
+	Writer << BlobHash << MimeType << bSRGB << bLoadMipMaps << bGeneratesMipMaps;
+	Writer << ImagesConfig.Compression << ImagesConfig.bSRGB << ImagesConfig.MaxWidth << ImagesConfig.MaxHeight << ImagesConfig.bVerticalFlip << ImagesConfig.bForceHDR << ImagesConfig.bCompressMips << ImagesConfig.bForceAutoDetect << ImagesConfig.ForcePixelFormat;
+
+	return FglTFRuntimeDerivedDataCache::MakeKey("Mips", KeyData);
+}
+
+bool FglTFRuntimeParser::LoadMipsFromDerivedDataCache(const FString& DerivedDataKey, const int32 TextureIndex, TArray<FglTFRuntimeMipMap>& Mips)
+{
+	if (DerivedDataKey.IsEmpty())
+	{
+		return false;
+	}
+
+	TArray<uint8> Data;
+	if (!FglTFRuntimeDerivedDataCache::Get(DerivedDataCacheDirectory, DerivedDataKey, Data))
+	{
+		DerivedDataMisses++;
+		return false;
+	}
+
+	FMemoryReader Reader(Data);
+	int32 NumMips = 0;
+	Reader << NumMips;
+
+	TArray<FglTFRuntimeMipMap> CachedMips;
+	for (int32 MipIndex = 0; MipIndex < NumMips && !Reader.IsError(); MipIndex++)
+	{
+		FglTFRuntimeMipMap& MipMap = CachedMips.Add_GetRef(FglTFRuntimeMipMap(TextureIndex));
+		uint8 PixelFormat = 0;
+		Reader << MipMap.Width << MipMap.Height << PixelFormat << MipMap.Pixels;
+		MipMap.PixelFormat = static_cast<EPixelFormat>(PixelFormat);
+	}
+
+	if (Reader.IsError() || CachedMips.Num() == 0)
+	{
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("Invalid derived data for key %s"), *DerivedDataKey);
+		DerivedDataMisses++;
+		return false;
+	}
+
+	Mips.Append(CachedMips);
+	DerivedDataHits++;
+	return true;
+}
+
+void FglTFRuntimeParser::StoreMipsToDerivedDataCache(const FString& DerivedDataKey, TArray<FglTFRuntimeMipMap>& Mips)
+{
+	if (DerivedDataKey.IsEmpty() || Mips.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	int32 NumMips = Mips.Num();
+	Writer << NumMips;
+	for (FglTFRuntimeMipMap& MipMap : Mips)
+	{
+		uint8 PixelFormat = static_cast<uint8>(MipMap.PixelFormat);
+		Writer << MipMap.Width << MipMap.Height << PixelFormat << MipMap.Pixels;
+	}
+
+	if (!FglTFRuntimeDerivedDataCache::Put(DerivedDataCacheDirectory, DerivedDataKey, Data))
+	{
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to store derived data for key %s"), *DerivedDataKey);
+	}
+}
+
 UMaterialInterface* FglTFRuntimeParser::LoadMaterial(const int32 Index, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bUseVertexColors, FString& MaterialName, UMaterialInterface* ForceBaseMaterial)
 {
 	if (Index < 0)
@@ -1390,13 +1510,17 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial(const int32 Index, const Fg
 	}
 
 	// first check cache
-	if (CanReadFromCache(MaterialsConfig.CacheMode) && MaterialsCache.Contains(Index))
+	if (CanReadFromCache(MaterialsConfig.CacheMode))
 	{
-		if (MaterialsNameCache.Contains(MaterialsCache[Index]))
+		FScopeLock Lock(&ObjectsCacheLock);
+		if (MaterialsCache.Contains(Index))
 		{
-			MaterialName = MaterialsNameCache[MaterialsCache[Index]];
+			if (MaterialsNameCache.Contains(MaterialsCache[Index]))
+			{
+				MaterialName = MaterialsNameCache[MaterialsCache[Index]];
+			}
+			return MaterialsCache[Index];
 		}
-		return MaterialsCache[Index];
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>* JsonMaterials;
@@ -1451,6 +1575,7 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial(const int32 Index, const Fg
 
 	if (CanWriteToCache(MaterialsConfig.CacheMode))
 	{
+		FScopeLock Lock(&ObjectsCacheLock);
 		MaterialsNameCache.Add(Material, MaterialName);
 		MaterialsCache.Add(Index, Material);
 	}
@@ -1,6 +1,7 @@
 // Copyright 2020-2025, Roberto De Ioris.
 
 #include "glTFRuntimeParser.h"
+#include "glTFRuntimeGameThreadQueue.h"
 #include "Runtime/Launch/Resources/Version.h"
 #if ENGINE_MAJOR_VERSION > 4
 #include "Animation/AnimData/AnimDataModel.h"
@@ -62,28 +63,45 @@
 struct FglTFRuntimeSkeletalMeshContextFinalizer
 {
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext;
-	FglTFRuntimeSkeletalMeshAsync AsyncCallback;
+	FglTFRuntimeNativeSkeletalMeshAsync AsyncCallback;
+	FglTFRuntimeLoadHandleRef LoadHandle;
+
+	FglTFRuntimeSkeletalMeshContextFinalizer(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> InSkeletalMeshContext, FglTFRuntimeNativeSkeletalMeshAsync InAsyncCallback, FglTFRuntimeLoadHandleRef InLoadHandle) :
+		SkeletalMeshContext(InSkeletalMeshContext),
+		AsyncCallback(InAsyncCallback),
+		LoadHandle(InLoadHandle)
+	{
+	}
 
 	FglTFRuntimeSkeletalMeshContextFinalizer(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> InSkeletalMeshContext, FglTFRuntimeSkeletalMeshAsync InAsyncCallback) :
 		SkeletalMeshContext(InSkeletalMeshContext),
-		AsyncCallback(InAsyncCallback)
+		LoadHandle(MakeShared<FglTFRuntimeLoadHandle, ESPMode::ThreadSafe>(InSkeletalMeshContext->SkeletalMeshConfig.GameThreadPriority))
 	{
+		AsyncCallback.BindLambda([InAsyncCallback](USkeletalMesh* SkeletalMesh)
+			{
+				InAsyncCallback.ExecuteIfBound(SkeletalMesh);
+			});
 	}
 
 	~FglTFRuntimeSkeletalMeshContextFinalizer()
 	{
-		FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([this]()
+		FGraphEventRef Task = FglTFRuntimeGameThreadQueue::Get().Enqueue([this]()
 			{
+				if (LoadHandle->IsCancelled())
+				{
+					SkeletalMeshContext->SkeletalMesh = nullptr;
+				}
 				if (SkeletalMeshContext->SkeletalMesh)
 				{
 					SkeletalMeshContext->SkeletalMesh = SkeletalMeshContext->Parser->FinalizeSkeletalMeshWithLODs(SkeletalMeshContext);
 				}
+				LoadHandle->Complete();
 				AsyncCallback.ExecuteIfBound(SkeletalMeshContext->SkeletalMesh);
 #if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2) || ENGINE_MAJOR_VERSION > 5
 				// this is ugly, but we need to avoid at all costs to have the FGCObject dtor to be run out of the game thread
 				SkeletalMeshContext->UnregisterGCObject();
 #endif
-			}, TStatId(), nullptr, ENamedThreads::GameThread);
+			}, LoadHandle);
 		FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 	}
 };
@@ -216,19 +234,31 @@ void FglTFRuntimeParser::CopySkeletonRotationsFrom(FReferenceSkeleton& RefSkelet
 	}
 }
 
-bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData, const TArray<FglTFRuntimeMeshLOD*>& LODs, const FReferenceSkeleton& RefSkeleton, const int32 SkinIndex, const TMap<int32, FName>& MainBoneMap, FBox& BoundingBox, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, TFunction<void(const FString& ErrorContext, const FString& ErrorMessage)> ErrorCallback)
+bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData, const TArray<FglTFRuntimeMeshLOD*>& LODs, const FReferenceSkeleton& RefSkeleton, const int32 SkinIndex, const TMap<int32, FName>& MainBoneMap, FBox& BoundingBox, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, TFunction<void(const FString& ErrorContext, const FString& ErrorMessage)> ErrorCallback, FglTFRuntimeLoadHandlePtr LoadHandle, TArray<FglTFRuntimeMeshLODFlags>* OutLODsFlags)
 {
 	TMap<int32, int32> MainBonesCache;
 
 	const float TangentsDirection = SkeletalMeshConfig.bReverseTangents ? -1 : 1;
 
+	int32 NumSectionsToBuild = 0;
+	int32 NumSectionsBuilt = 0;
+	for (const FglTFRuntimeMeshLOD* LOD : LODs)
+	{
+		NumSectionsToBuild += LOD->Primitives.Num();
+	}
+
+	// the LODs can be shared with other builds (parser cache), so they are never written
+	TArray<FglTFRuntimeMeshLODFlags> LODsFlags;
+	LODsFlags.Reserve(LODs.Num());
+
 	for (FglTFRuntimeMeshLOD* LOD : LODs)
 	{
 		TArray<uint32> LODIndices;
 
-		LOD->bHasTangents = true;
-		LOD->bHasNormals = true;
-		LOD->bHasVertexColors = false;
+		FglTFRuntimeMeshLODFlags& LODFlags = LODsFlags.AddDefaulted_GetRef();
+		LODFlags.bHasTangents = true;
+		LODFlags.bHasNormals = true;
+		LODFlags.bHasVertexColors = false;
 
 		FSkeletalMeshLODRenderData* LodRenderData = new FSkeletalMeshLODRenderData();
 		int32 LODIndex = RenderData->LODRenderData.Add(LodRenderData);
@@ -243,7 +273,7 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 		for (int32 PrimitiveIndex = 0; PrimitiveIndex < LOD->Primitives.Num(); PrimitiveIndex++)
 		{
 			NumLODIndices += LOD->Primitives[PrimitiveIndex].Indices.Num();
-			NumLODPositions += LOD->Primitives[PrimitiveIndex].Positions.Num();
+			NumLODPositions += LOD->Primitives[PrimitiveIndex].NumVertices();
 
 			if (LOD->Primitives[PrimitiveIndex].bHighPrecisionUVs)
 			{
@@ -253,9 +283,9 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 			{
 				bUseHighPrecisionWeights = true;
 			}
-			if (LOD->Primitives[PrimitiveIndex].Colors.Num() > 0)
+			if (LOD->Primitives[PrimitiveIndex].NumColors() > 0)
 			{
-				LOD->bHasVertexColors = true;
+				LODFlags.bHasVertexColors = true;
 			}
 		}
 
@@ -263,7 +293,7 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 		LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetUseFullPrecisionUVs(bUseHighPrecisionUVs || SkeletalMeshConfig.bUseHighPrecisionUVs);
 		LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetUseHighPrecisionTangentBasis(SkeletalMeshConfig.bUseHighPrecisionTangentBasis);
 		LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.Init(NumLODPositions, 1);
-		if (LOD->bHasVertexColors)
+		if (LODFlags.bHasVertexColors)
 		{
 			LodRenderData->StaticVertexBuffers.ColorVertexBuffer.Init(NumLODPositions);
 		}
@@ -285,7 +315,22 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 
 		for (int32 PrimitiveIndex = 0; PrimitiveIndex < LOD->Primitives.Num(); PrimitiveIndex++)
 		{
+			if (LoadHandle)
+			{
+				if (LoadHandle->IsCancelled())
+				{
+					// the render data is destroyed with the mesh, so the remaining sections must be valid
+					for (int32 RemainingIndex = PrimitiveIndex; RemainingIndex < LOD->Primitives.Num(); RemainingIndex++)
+					{
+						new(&LodRenderData->RenderSections[RemainingIndex]) FSkelMeshRenderSection();
+					}
+					return false;
+				}
+				LoadHandle->SetStageProgress(0.5f, 0.9f, NumSectionsBuilt++, NumSectionsToBuild);
+			}
+
 			FglTFRuntimePrimitive& Primitive = LOD->Primitives[PrimitiveIndex];
+			TMap<int32, int32> OverrideBonesCache;
 
 			new(&LodRenderData->RenderSections[PrimitiveIndex]) FSkelMeshRenderSection();
 			FSkelMeshRenderSection& MeshSection = LodRenderData->RenderSections[PrimitiveIndex];
@@ -301,7 +346,7 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 				MaxBoneInfluences = MeshSection.MaxBoneInfluences;
 			}
 
-			MeshSection.NumVertices = Primitive.Positions.Num();
+			MeshSection.NumVertices = Primitive.NumVertices();
 
 			BaseIndex += Primitive.Indices.Num();
 
@@ -311,59 +356,61 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 			// this is used for non-skinned asset loaded as skinned ones
 			int32 OverrideVertexToCheck = 0;
 
-			for (int32 VertexIndex = 0; VertexIndex < Primitive.Positions.Num(); VertexIndex++)
+			for (int32 VertexIndex = 0; VertexIndex < Primitive.NumVertices(); VertexIndex++)
 			{
 				FModelVertex ModelVertex;
 
 				float TangentXW = 1;
+				bool bMissing = false;
 
 #if ENGINE_MAJOR_VERSION > 4
-				ModelVertex.Position = FVector3f(Primitive.Positions[VertexIndex]);
+				ModelVertex.Position = FVector3f(Primitive.GetPosition(VertexIndex, bMissing));
 				BoundingBox += FVector(ModelVertex.Position) * SkeletalMeshConfig.BoundsScale;
 				ModelVertex.TangentX = FVector3f::ZeroVector;
 				ModelVertex.TangentZ = FVector3f::ZeroVector;
 #else
-				ModelVertex.Position = Primitive.Positions[VertexIndex];
+				ModelVertex.Position = Primitive.GetPosition(VertexIndex, bMissing);
 				BoundingBox += ModelVertex.Position * SkeletalMeshConfig.BoundsScale;
 				ModelVertex.TangentX = FVector::ZeroVector;
 				ModelVertex.TangentZ = FVector::ZeroVector;
 #endif
-				if (VertexIndex < Primitive.Normals.Num())
+				if (VertexIndex < Primitive.NumNormals())
 				{
 #if ENGINE_MAJOR_VERSION > 4
-					ModelVertex.TangentZ = FVector3f(FVector(Primitive.Normals[VertexIndex]));
+					ModelVertex.TangentZ = FVector3f(Primitive.GetNormal(VertexIndex, bMissing));
 #else
-					ModelVertex.TangentZ = Primitive.Normals[VertexIndex];
+					ModelVertex.TangentZ = Primitive.GetNormal(VertexIndex, bMissing);
 #endif
 				}
 				else
 				{
-					LOD->bHasNormals = false;
+					LODFlags.bHasNormals = false;
 				}
 
-				if (VertexIndex < Primitive.Tangents.Num())
+				if (VertexIndex < Primitive.NumTangents())
 				{
 #if ENGINE_MAJOR_VERSION > 4
-					TangentXW = Primitive.Tangents[VertexIndex].W;
-					ModelVertex.TangentX = FVector4f(Primitive.Tangents[VertexIndex]);
+					const FVector4 TangentX = Primitive.GetTangent(VertexIndex, bMissing);
+					TangentXW = TangentX.W;
+					ModelVertex.TangentX = FVector4f(TangentX);
 #else
-					ModelVertex.TangentX = Primitive.Tangents[VertexIndex];
+					ModelVertex.TangentX = Primitive.GetTangent(VertexIndex, bMissing);
 #endif
 				}
 				else
 				{
-					LOD->bHasTangents = false;
+					LODFlags.bHasTangents = false;
 				}
 
-				if (Primitive.UVs.Num() > 0 && VertexIndex < Primitive.UVs[0].Num())
+				if (Primitive.NumUVs() > 0 && VertexIndex < Primitive.NumUVs(0))
 				{
 
 #if ENGINE_MAJOR_VERSION > 4
-					ModelVertex.TexCoord = FVector2f(Primitive.UVs[0][VertexIndex]);
+					ModelVertex.TexCoord = FVector2f(Primitive.GetUV(0, VertexIndex, bMissing));
 #else
-					ModelVertex.TexCoord = Primitive.UVs[0][VertexIndex];
+					ModelVertex.TexCoord = Primitive.GetUV(0, VertexIndex, bMissing);
 #endif
-					LOD->bHasUV = true;
+					LODFlags.bHasUV = true;
 				}
 				else
 				{
@@ -372,7 +419,7 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 #else
 					ModelVertex.TexCoord = FVector2D::ZeroVector;
 #endif
-					LOD->bHasUV = false;
+					LODFlags.bHasUV = false;
 				}
 
 #if ENGINE_MAJOR_VERSION > 4
@@ -381,21 +428,21 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 				FVector TangentY = ComputeTangentYWithW(ModelVertex.TangentZ, ModelVertex.TangentX, TangentXW * TangentsDirection);
 #endif
 				FColor Color = FColor::White;
-				if (VertexIndex < Primitive.Colors.Num())
+				if (VertexIndex < Primitive.NumColors())
 				{
-					Color = FLinearColor(Primitive.Colors[VertexIndex]).ToFColor(true);
+					Color = FLinearColor(Primitive.GetColor(VertexIndex, FVector4(1, 1, 1, 1), bMissing)).ToFColor(true);
 				}
 
 				LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(BaseVertexIndex) = ModelVertex.Position;
 				LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(BaseVertexIndex, ModelVertex.TangentX, TangentY, ModelVertex.TangentZ);
 				LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexUV(BaseVertexIndex, 0, ModelVertex.TexCoord);
-				if (LOD->bHasVertexColors)
+				if (LODFlags.bHasVertexColors)
 				{
 					LodRenderData->StaticVertexBuffers.ColorVertexBuffer.VertexColor(BaseVertexIndex) = Color;
 				}
 
 				const TMap<int32, FName>& BoneMapInUse = Primitive.OverrideBoneMap.Num() > 0 ? Primitive.OverrideBoneMap : MainBoneMap;
-				TMap<int32, int32>& BonesCacheInUse = Primitive.OverrideBoneMap.Num() > 0 ? Primitive.BonesCache : MainBonesCache;
+				TMap<int32, int32>& BonesCacheInUse = Primitive.OverrideBoneMap.Num() > 0 ? OverrideBonesCache : MainBonesCache;
 
 				if ((!SkeletalMeshConfig.bIgnoreSkin && SkinIndex > INDEX_NONE) || LOD->Skeleton.Num() > 0)
 				{
@@ -503,20 +550,20 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 
 		if (SkeletalMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Always)
 		{
-			LOD->bHasNormals = false;
+			LODFlags.bHasNormals = false;
 		}
 		else if (SkeletalMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Never)
 		{
-			LOD->bHasNormals = true;
+			LODFlags.bHasNormals = true;
 		}
 
 		if (SkeletalMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::Always)
 		{
-			LOD->bHasTangents = false;
+			LODFlags.bHasTangents = false;
 		}
 		else if (SkeletalMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::Never)
 		{
-			LOD->bHasTangents = true;
+			LODFlags.bHasTangents = true;
 		}
 
 		// generate indices (and eventually normals/tangents)
@@ -527,16 +574,12 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 			FglTFRuntimePrimitive& Primitive = LOD->Primitives[PrimitiveIndex];
 			const int32 NumVertexInstancesPerSection = Primitive.Indices.Num();
 
-			TArray<uint32> CurrentIndices;
-			CurrentIndices.Reserve(NumVertexInstancesPerSection);
-
 			for (const uint32 Index : Primitive.Indices)
 			{
 				LodRenderData->MultiSizeIndexContainer.GetIndexBuffer()->AddItem(LodRenderData->RenderSections[PrimitiveIndex].BaseVertexIndex + Index);
-				CurrentIndices.Add(LodRenderData->RenderSections[PrimitiveIndex].BaseVertexIndex + Index);
 			}
 
-			if ((!LOD->bHasTangents || !LOD->bHasNormals) && ((NumVertexInstancesPerSection % 3) == 0))
+			if ((!LODFlags.bHasTangents || !LODFlags.bHasNormals) && ((NumVertexInstancesPerSection % 3) == 0))
 			{
 
 				//normals with NaNs are incorrectly handled on Android
@@ -549,188 +592,86 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 						}
 					};
 
-				TSet<uint32> ProcessedVertices;
-				ProcessedVertices.Reserve(NumVertexInstancesPerSection);
-
-				FCriticalSection TangentsGenerationLock;
+				const int32 SectionBaseVertexIndex = LodRenderData->RenderSections[PrimitiveIndex].BaseVertexIndex;
+				const int32 NumVerticesInSection = LodRenderData->RenderSections[PrimitiveIndex].NumVertices;
 
-				ParallelFor(NumVertexInstancesPerSection / 3, [&](const int32 VertexTriangleIndex)
+				// section local copies (Primitive.Indices are already relative to the section)
+				TArray<FVector> SectionPositions;
+				SectionPositions.AddUninitialized(NumVerticesInSection);
+				TArray<FVector> SectionNormals;
+				SectionNormals.AddUninitialized(NumVerticesInSection);
+				ParallelFor(NumVerticesInSection, [&](const int32 VertexIndex)
 					{
-						bool bSetVertex0 = false;
-						bool bSetVertex1 = false;
-						bool bSetVertex2 = false;
-
-						const int32 VertexIndex0 = CurrentIndices[VertexTriangleIndex * 3];
-						const int32 VertexIndex1 = CurrentIndices[VertexTriangleIndex * 3 + 1];
-						const int32 VertexIndex2 = CurrentIndices[VertexTriangleIndex * 3 + 2];
-
-						if (Primitive.bHasIndices)
-						{
-							FScopeLock Lock(&TangentsGenerationLock);
-
-							if (!ProcessedVertices.Contains(VertexIndex0))
-							{
-								ProcessedVertices.Add(VertexIndex0);
-								bSetVertex0 = true;
-							}
-
-							if (!ProcessedVertices.Contains(VertexIndex1))
-							{
-								ProcessedVertices.Add(VertexIndex1);
-								bSetVertex1 = true;
-							}
-
-							if (!ProcessedVertices.Contains(VertexIndex2))
-							{
-								ProcessedVertices.Add(VertexIndex2);
-								bSetVertex2 = true;
-							}
-
-							if (!bSetVertex0 && !bSetVertex1 && !bSetVertex2)
-							{
-								return;
-							}
-						}
-						else
-						{
-							bSetVertex0 = true;
-							bSetVertex1 = true;
-							bSetVertex2 = true;
-						}
-
 #if ENGINE_MAJOR_VERSION > 4
-						FVector Position0 = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex0));
-						FVector4 TangentZ0 = FVector4(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex0));
+						SectionPositions[VertexIndex] = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(SectionBaseVertexIndex + VertexIndex));
+						SectionNormals[VertexIndex] = FVector(FVector4(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(SectionBaseVertexIndex + VertexIndex)));
 #else
-						FVector Position0 = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex0);
-						FVector4 TangentZ0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex0);
+						SectionPositions[VertexIndex] = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(SectionBaseVertexIndex + VertexIndex);
+						SectionNormals[VertexIndex] = FVector(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(SectionBaseVertexIndex + VertexIndex));
 #endif
+					});
 
+				if (!LODFlags.bHasNormals)
+				{
+					ComputeSmoothNormals(SectionPositions, Primitive.Indices, SectionNormals);
+				}
 
-#if ENGINE_MAJOR_VERSION > 4
-						FVector Position1 = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex1));
-						FVector4 TangentZ1 = FVector4(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex1));
-#else
-						FVector Position1 = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex1);
-						FVector4 TangentZ1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex1);
-#endif
-
-
-#if ENGINE_MAJOR_VERSION > 4
-						FVector Position2 = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex2));
-						FVector4 TangentZ2 = FVector4(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex2));
-#else
-						FVector Position2 = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(VertexIndex2);
-						FVector4 TangentZ2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex2);
-#endif
-
-						if (!LOD->bHasNormals)
-						{
-							const FVector SideA = Position1 - Position0;
-							const FVector SideB = Position2 - Position0;
-
-							const FVector NormalFromCross = FVector::CrossProduct(SideB, SideA).GetSafeNormal();
-
-							TangentZ0 = NormalFromCross;
-							TangentZ1 = NormalFromCross;
-							TangentZ2 = NormalFromCross;
-						}
-
-						// if we do not have tangents but we have normals and a UV channel, we can compute them
-						if (!LOD->bHasTangents)
-						{
-							const FVector DeltaPosition0 = Position1 - Position0;
-							const FVector DeltaPosition1 = Position2 - Position0;
-
-							FVector TangentX0;
-							FVector TangentX1;
-							FVector TangentX2;
-
-							if (LOD->bHasUV)
+				TArray<FVector4> SectionTangents;
+				if (!LODFlags.bHasTangents)
+				{
+					// if we do not have tangents but we have normals and a UV channel, we can compute them
+					if (LODFlags.bHasUV)
+					{
+						TArray<FVector2D> SectionUVs;
+						SectionUVs.AddUninitialized(NumVerticesInSection);
+						ParallelFor(NumVerticesInSection, [&](const int32 VertexIndex)
 							{
-#if ENGINE_MAJOR_VERSION > 4
-								const FVector2f& UV0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex0, 0);
-								const FVector2f& UV1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex1, 0);
-								const FVector2f& UV2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex2, 0);
-								const FVector2f DeltaUV0 = UV1 - UV0;
-								const FVector2f DeltaUV1 = UV2 - UV0;
-#else
-								const FVector2D& UV0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex0, 0);
-								const FVector2D& UV1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex1, 0);
-								const FVector2D& UV2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(VertexIndex2, 0);
-								const FVector2D DeltaUV0 = UV1 - UV0;
-								const FVector2D DeltaUV1 = UV2 - UV0;
-#endif
-
-								const float Factor = 1.0f / (DeltaUV0.X * DeltaUV1.Y - DeltaUV0.Y * DeltaUV1.X);
-
-								const FVector TriangleTangentX = ((DeltaPosition0 * DeltaUV1.Y) - (DeltaPosition1 * DeltaUV0.Y)) * Factor;
-								const FVector TriangleTangentY = ((DeltaPosition0 * DeltaUV1.X) - (DeltaPosition1 * DeltaUV0.X)) * Factor;
-
-								TangentX0 = TriangleTangentX - (TangentZ0 * FVector::DotProduct(TangentZ0, TriangleTangentX));
-								TangentX0.Normalize();
-
-								TangentX1 = TriangleTangentX - (TangentZ1 * FVector::DotProduct(TangentZ1, TriangleTangentX));
-								TangentX1.Normalize();
-
-								TangentX2 = TriangleTangentX - (TangentZ2 * FVector::DotProduct(TangentZ2, TriangleTangentX));
-								TangentX2.Normalize();
-							}
-							else
+								SectionUVs[VertexIndex] = FVector2D(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(SectionBaseVertexIndex + VertexIndex, 0));
+							});
+						ComputeMikkTSpaceTangents(SectionPositions, SectionNormals, SectionUVs, Primitive.Indices, SectionTangents);
+					}
+					else
+					{
+						SectionTangents.AddUninitialized(NumVerticesInSection);
+						ParallelFor(NumVerticesInSection, [&](const int32 VertexIndex)
 							{
-								TangentX0 = FVector::CrossProduct(TangentZ0, FVector::UpVector);
-								TangentX1 = FVector::CrossProduct(TangentZ1, FVector::UpVector);
-								TangentX2 = FVector::CrossProduct(TangentZ2, FVector::UpVector);
-							}
+								SectionTangents[VertexIndex] = FVector4(FVector::CrossProduct(SectionNormals[VertexIndex], FVector::UpVector), 1);
+							});
+					}
+				}
+
+				ParallelFor(NumVerticesInSection, [&](const int32 VertexIndex)
+					{
+						const int32 SectionVertexIndex = SectionBaseVertexIndex + VertexIndex;
+						const FVector TangentZ = SectionNormals[VertexIndex];
 
+						if (!LODFlags.bHasTangents)
+						{
+							FVector TangentX = FVector(SectionTangents[VertexIndex]);
 #if PLATFORM_ANDROID
-							FixVectorIfNan(TangentX0, 0);
-							FixVectorIfNan(TangentX1, 0);
-							FixVectorIfNan(TangentX2, 0);
+							FixVectorIfNan(TangentX, 0);
 #endif
-
-							FVector TangentY0 = ComputeTangentY(TangentZ0, TangentX0) * TangentsDirection;
-							FVector TangentY1 = ComputeTangentY(TangentZ1, TangentX1) * TangentsDirection;
-							FVector TangentY2 = ComputeTangentY(TangentZ2, TangentX2) * TangentsDirection;
+							FVector TangentY = ComputeTangentYWithW(TangentZ, TangentX, SectionTangents[VertexIndex].W * TangentsDirection);
 #if PLATFORM_ANDROID
-							FixVectorIfNan(TangentY0, 1);
-							FixVectorIfNan(TangentY1, 1);
-							FixVectorIfNan(TangentY2, 1);
+							FixVectorIfNan(TangentY, 1);
 #endif
 
-
 #if ENGINE_MAJOR_VERSION > 4
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex0, FVector3f(TangentX0), FVector3f(TangentY0), FVector3f(FVector(TangentZ0)));
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex1, FVector3f(TangentX1), FVector3f(TangentY1), FVector3f(FVector(TangentZ1)));
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex2, FVector3f(TangentX2), FVector3f(TangentY2), FVector3f(FVector(TangentZ2)));
+							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(SectionVertexIndex, FVector3f(TangentX), FVector3f(TangentY), FVector3f(TangentZ));
 #else
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex0, TangentX0, TangentY0, TangentZ0);
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex1, TangentX1, TangentY1, TangentZ1);
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex2, TangentX2, TangentY2, TangentZ2);
+							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(SectionVertexIndex, TangentX, TangentY, TangentZ);
 #endif
 						}
-						else if (!LOD->bHasNormals) // if we are here we need to reapply normals
+						else if (!LODFlags.bHasNormals) // if we are here we need to reapply normals
 						{
 #if ENGINE_MAJOR_VERSION > 4
-							FVector4f TangentX0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex0);
-							FVector4f TangentX1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex1);
-							FVector4f TangentX2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex2);
-							FVector3f TangentY0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex0);
-							FVector3f TangentY1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex1);
-							FVector3f TangentY2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex2);
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex0, TangentX0, TangentY0, FVector4f(TangentZ0));
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex1, TangentX1, TangentY1, FVector4f(TangentZ1));
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex2, TangentX2, TangentY2, FVector4f(TangentZ2));
+							const FVector4f TangentX = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(SectionVertexIndex);
+							const FVector3f TangentY = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(SectionVertexIndex);
+							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(SectionVertexIndex, TangentX, TangentY, FVector4f(FVector3f(TangentZ)));
 #else
-							FVector4 TangentX0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex0);
-							FVector4 TangentX1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex1);
-							FVector4 TangentX2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex2);
-							FVector TangentY0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex0);
-							FVector TangentY1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex1);
-							FVector TangentY2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(VertexIndex2);
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex0, TangentX0, TangentY0, TangentZ0);
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex1, TangentX1, TangentY1, TangentZ1);
-							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex2, TangentX2, TangentY2, TangentZ2);
+							const FVector4 TangentX = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(SectionVertexIndex);
+							const FVector TangentY = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentY(SectionVertexIndex);
+							LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(SectionVertexIndex, TangentX, TangentY, TangentZ);
 #endif
 						}
 					});
@@ -760,6 +701,11 @@ bool glTFRuntime::FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData
 #endif
 	}
 
+	if (OutLODsFlags)
+	{
+		*OutLODsFlags = MoveTemp(LODsFlags);
+	}
+
 	return true;
 }
 
@@ -916,9 +862,70 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 
 	OnPreCreatedSkeletalMesh.Broadcast(SkeletalMeshContext);
 
+	// after the hooks, so LOD generators bound there take precedence
+	if (SkeletalMeshContext->SkeletalMeshConfig.AutoLODsTrianglesRatios.Num() > 0 && SkeletalMeshContext->LODs.Num() == 1)
+	{
+		TArray<FglTFRuntimeMeshLOD> AutoLODs;
+		glTFRuntime::GenerateSimplifiedLODs(*SkeletalMeshContext->LODs[0], SkeletalMeshContext->SkeletalMeshConfig.AutoLODsTrianglesRatios, AutoLODs);
+		for (FglTFRuntimeMeshLOD& AutoLOD : AutoLODs)
+		{
+			SkeletalMeshContext->AddContextLOD() = MoveTemp(AutoLOD);
+		}
+		SkeletalMeshContext->bHasAutoLODs = true;
+	}
+
+	if (SkeletalMeshContext->SkeletalMeshConfig.bOptimizeVertexCache)
+	{
+		// LODs can be shared with the parser cache, so reorder context owned copies (the pointers must stay valid, hence the Reserve)
+		SkeletalMeshContext->OptimizedLODs.Reserve(SkeletalMeshContext->OptimizedLODs.Num() + SkeletalMeshContext->LODs.Num());
+		TArray<FglTFRuntimePrimitive*> PrimitivesToOptimize;
+		for (FglTFRuntimeMeshLOD*& LOD : SkeletalMeshContext->LODs)
+		{
+			LOD = &SkeletalMeshContext->OptimizedLODs.Add_GetRef(*LOD);
+			for (FglTFRuntimePrimitive& Primitive : LOD->Primitives)
+			{
+				if ((Primitive.Indices.Num() % 3) == 0)
+				{
+					PrimitivesToOptimize.Add(&Primitive);
+				}
+			}
+		}
+
+		TArray<FglTFRuntimeMeshOptimizationStats> PrimitivesStats;
+		PrimitivesStats.AddDefaulted(PrimitivesToOptimize.Num());
+
+		ParallelFor(PrimitivesToOptimize.Num(), [&](const int32 PrimitiveIndex)
+			{
+				FglTFRuntimePrimitive& Primitive = *PrimitivesToOptimize[PrimitiveIndex];
+				TArray<FVector> Positions;
+				if (SkeletalMeshContext->SkeletalMeshConfig.OverdrawThreshold >= 1)
+				{
+					Positions.AddUninitialized(Primitive.NumVertices());
+					for (int32 VertexIndex = 0; VertexIndex < Positions.Num(); VertexIndex++)
+					{
+						bool bMissing = false;
+						Positions[VertexIndex] = Primitive.GetPosition(VertexIndex, bMissing);
+					}
+				}
+
+				TArray<int32> NewToOld;
+				if (glTFRuntime::OptimizeSection(Primitive.Indices, Primitive.NumVertices(), SkeletalMeshContext->SkeletalMeshConfig.VertexCacheSize, NewToOld, PrimitivesStats[PrimitiveIndex], Positions, SkeletalMeshContext->SkeletalMeshConfig.OverdrawThreshold))
+				{
+					glTFRuntime::RemapPrimitiveVertices(Primitive, NewToOld);
+				}
+			});
+
+		FglTFRuntimeMeshOptimizationStats Stats;
+		for (const FglTFRuntimeMeshOptimizationStats& PrimitiveStats : PrimitivesStats)
+		{
+			Stats.Append(PrimitiveStats);
+		}
+		AddMeshOptimizationStats(Stats);
+	}
+
 	if (!glTFRuntime::FillSkeletalMeshRenderData(SkeletalMeshContext->SkeletalMesh->GetResourceForRendering(), SkeletalMeshContext->LODs, RefSkeleton, SkeletalMeshContext->SkinIndex, MainBoneMap, SkeletalMeshContext->BoundingBox, SkeletalMeshContext->SkeletalMeshConfig, [this](const FString& ErrorContext, const FString& ErrorMessage) {
 		AddError(ErrorContext, ErrorMessage);
-		}))
+		}, SkeletalMeshContext->LoadHandle, &SkeletalMeshContext->LODsFlags))
 	{
 		return nullptr;
 	}
@@ -943,9 +950,22 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 
 	for (int32 LODIndex = 0; LODIndex < SkeletalMeshContext->LODs.Num(); LODIndex++)
 	{
+		// the LODs can be shared with other builds, so the flags found by this one are copied
+		FglTFRuntimeMeshLODFlags LODFlags;
+		if (SkeletalMeshContext->LODsFlags.IsValidIndex(LODIndex))
+		{
+			LODFlags = SkeletalMeshContext->LODsFlags[LODIndex];
+		}
+		else
+		{
+			LODFlags.bHasNormals = SkeletalMeshContext->LODs[LODIndex]->bHasNormals;
+			LODFlags.bHasTangents = SkeletalMeshContext->LODs[LODIndex]->bHasTangents;
+			LODFlags.bHasUV = SkeletalMeshContext->LODs[LODIndex]->bHasUV;
+			LODFlags.bHasVertexColors = SkeletalMeshContext->LODs[LODIndex]->bHasVertexColors;
+		}
 
 		// vertex colors?
-		if (SkeletalMeshContext->LODs[LODIndex]->bHasVertexColors)
+		if (LODFlags.bHasVertexColors)
 		{
 			bHasVertexColors = true;
 		}
@@ -953,28 +973,28 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 		// LOD tuning
 		if (SkeletalMeshContext->SkeletalMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Always)
 		{
-			SkeletalMeshContext->LODs[LODIndex]->bHasNormals = false;
+			LODFlags.bHasNormals = false;
 		}
 		else if (SkeletalMeshContext->SkeletalMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Never)
 		{
-			SkeletalMeshContext->LODs[LODIndex]->bHasNormals = true;
+			LODFlags.bHasNormals = true;
 		}
 
 		if (SkeletalMeshContext->SkeletalMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::Always)
 		{
-			SkeletalMeshContext->LODs[LODIndex]->bHasTangents = false;
+			LODFlags.bHasTangents = false;
 		}
 		else if (SkeletalMeshContext->SkeletalMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::Never)
 		{
-			SkeletalMeshContext->LODs[LODIndex]->bHasTangents = true;
+			LODFlags.bHasTangents = true;
 		}
 
 		FSkeletalMeshLODInfo& LODInfo = SkeletalMeshContext->SkeletalMesh->AddLODInfo();
 		LODInfo.ReductionSettings.NumOfTrianglesPercentage = 1.0f;
 		LODInfo.ReductionSettings.NumOfVertPercentage = 1.0f;
 		LODInfo.ReductionSettings.MaxDeviationPercentage = 0.0f;
-		LODInfo.BuildSettings.bRecomputeNormals = !SkeletalMeshContext->LODs[LODIndex]->bHasNormals;
-		LODInfo.BuildSettings.bRecomputeTangents = !SkeletalMeshContext->LODs[LODIndex]->bHasTangents;
+		LODInfo.BuildSettings.bRecomputeNormals = !LODFlags.bHasNormals;
+		LODInfo.BuildSettings.bRecomputeTangents = !LODFlags.bHasTangents;
 		LODInfo.BuildSettings.bUseFullPrecisionUVs = SkeletalMeshContext->SkeletalMeshConfig.bUseHighPrecisionUVs;
 		LODInfo.BuildSettings.bUseHighPrecisionTangentBasis = SkeletalMeshContext->SkeletalMeshConfig.bUseHighPrecisionTangentBasis;
 		LODInfo.LODHysteresis = 0.02f;
@@ -983,6 +1003,10 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 		{
 			LODInfo.ScreenSize = SkeletalMeshContext->SkeletalMeshConfig.LODScreenSize[LODIndex];
 		}
+		else if (SkeletalMeshContext->bHasAutoLODs)
+		{
+			LODInfo.ScreenSize = glTFRuntime::GetDefaultLODScreenSize(LODIndex, SkeletalMeshContext->LODs.Num(), SkeletalMeshContext->SkeletalMeshConfig.LODScreenSizeMultiplier);
+		}
 
 #if WITH_EDITOR
 		ImportedResource->LODModels.Add(new FSkeletalMeshLODModel());
@@ -1013,7 +1037,7 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 					MorphTargetLODModel.NumBaseMeshVerts = Primitive.Indices.Num();
 					MorphTargetLODModel.SectionIndices.Add(PrimitiveIndex);
 
-					for (int32 VertexIndex = 0; VertexIndex < Primitive.Positions.Num(); VertexIndex++)
+					for (int32 VertexIndex = 0; VertexIndex < Primitive.NumVertices(); VertexIndex++)
 					{
 						FMorphTargetDelta Delta;
 						if (VertexIndex < MorphTargetData.Positions.Num())
@@ -1219,12 +1243,13 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 	}
 	else
 	{
-		if (CanReadFromCache(SkeletalMeshContext->SkeletalMeshConfig.SkeletonConfig.CacheMode) && SkeletalMeshContext->SkinIndex > -1 && SkeletonsCache.Contains(SkeletalMeshContext->SkinIndex))
+		USkeleton* CachedSkeleton = CanReadFromCache(SkeletalMeshContext->SkeletalMeshConfig.SkeletonConfig.CacheMode) && SkeletalMeshContext->SkinIndex > -1 ? FindInObjectsCache<USkeleton>(SkeletonsCache, SkeletalMeshContext->SkinIndex) : nullptr;
+		if (CachedSkeleton)
 		{
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
-			SkeletalMeshContext->SkeletalMesh->SetSkeleton(SkeletonsCache[SkeletalMeshContext->SkinIndex]);
+			SkeletalMeshContext->SkeletalMesh->SetSkeleton(CachedSkeleton);
 #else
-			SkeletalMeshContext->SkeletalMesh->Skeleton = SkeletonsCache[SkeletalMeshContext->SkinIndex];
+			SkeletalMeshContext->SkeletalMesh->Skeleton = CachedSkeleton;
 #endif
 		}
 		else
@@ -1239,7 +1264,7 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 
 			if (CanWriteToCache(SkeletalMeshContext->SkeletalMeshConfig.SkeletonConfig.CacheMode) && SkeletalMeshContext->SkinIndex > -1)
 			{
-				SkeletonsCache.Add(SkeletalMeshContext->SkinIndex, SkeletalMeshContext->GetSkeleton());
+				AddToObjectsCache(SkeletonsCache, SkeletalMeshContext->SkinIndex, SkeletalMeshContext->GetSkeleton());
 			}
 
 			SkeletalMeshContext->GetSkeleton()->SetPreviewMesh(SkeletalMeshContext->SkeletalMesh);
@@ -1734,9 +1759,12 @@ void FglTFRuntimeParser::GeneratePhysicsAsset_Internal(FglTFRuntimeSkeletalMeshC
 USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMesh(const int32 MeshIndex, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig)
 {
 	// first check cache
-	if (CanReadFromCache(SkeletalMeshConfig.CacheMode) && SkeletalMeshesCache.Contains(MeshIndex))
+	if (CanReadFromCache(SkeletalMeshConfig.CacheMode))
 	{
-		return SkeletalMeshesCache[MeshIndex];
+		if (USkeletalMesh* CachedSkeletalMesh = FindInObjectsCache<USkeletalMesh>(SkeletalMeshesCache, MeshIndex))
+		{
+			return CachedSkeletalMesh;
+		}
 	}
 
 	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
@@ -1746,7 +1774,7 @@ USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMesh(const int32 MeshIndex, const
 		return nullptr;
 	}
 
-	FglTFRuntimeMeshLOD* LOD = nullptr;
+	TSharedPtr<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe> LOD;
 	if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, SkeletalMeshConfig.MaterialsConfig))
 	{
 		return nullptr;
@@ -1754,7 +1782,7 @@ USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMesh(const int32 MeshIndex, const
 
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), MeshIndex, SkeletalMeshConfig);
 	SkeletalMeshContext->SkinIndex = SkinIndex;
-	SkeletalMeshContext->LODs.Add(LOD);
+	SkeletalMeshContext->AddCachedLOD(LOD.ToSharedRef());
 
 	if (!CreateSkeletalMeshFromLODs(SkeletalMeshContext))
 	{
@@ -1771,20 +1799,36 @@ USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMesh(const int32 MeshIndex, const
 
 	if (CanWriteToCache(SkeletalMeshConfig.CacheMode))
 	{
-		SkeletalMeshesCache.Add(MeshIndex, SkeletalMesh);
+		AddToObjectsCache(SkeletalMeshesCache, MeshIndex, SkeletalMesh);
 	}
 
 	return SkeletalMesh;
 }
 
-void FglTFRuntimeParser::LoadSkeletalMeshAsync(const int32 MeshIndex, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshAsync& AsyncCallback, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig)
+FglTFRuntimeLoadHandleRef FglTFRuntimeParser::LoadSkeletalMeshAsync(const int32 MeshIndex, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshAsync& AsyncCallback, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig)
+{
+	return LoadSkeletalMeshAsync(MeshIndex, SkinIndex, FglTFRuntimeNativeSkeletalMeshAsync::CreateLambda([AsyncCallback](USkeletalMesh* SkeletalMesh)
+		{
+			AsyncCallback.ExecuteIfBound(SkeletalMesh);
+		}), SkeletalMeshConfig);
+}
+
+FglTFRuntimeLoadHandleRef FglTFRuntimeParser::LoadSkeletalMeshAsync(const int32 MeshIndex, const int32 SkinIndex, const FglTFRuntimeNativeSkeletalMeshAsync& AsyncCallback, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig)
 {
+	FglTFRuntimeLoadHandleRef LoadHandle = MakeShared<FglTFRuntimeLoadHandle, ESPMode::ThreadSafe>(SkeletalMeshConfig.GameThreadPriority);
+
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), MeshIndex, SkeletalMeshConfig);
 	SkeletalMeshContext->SkinIndex = SkinIndex;
+	SkeletalMeshContext->LoadHandle = LoadHandle;
 
-	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, MeshIndex, AsyncCallback]()
+	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, MeshIndex, AsyncCallback, LoadHandle]()
 		{
-			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
+			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback, LoadHandle);
+
+			if (LoadHandle->IsCancelled())
+			{
+				return;
+			}
 
 			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
 			if (!JsonMeshObject)
@@ -1793,16 +1837,26 @@ void FglTFRuntimeParser::LoadSkeletalMeshAsync(const int32 MeshIndex, const int3
 				return;
 			}
 
-			FglTFRuntimeMeshLOD* LOD = nullptr;
-			if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, SkeletalMeshContext->SkeletalMeshConfig.MaterialsConfig))
+			TSharedPtr<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe> LOD;
+			if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, SkeletalMeshContext->SkeletalMeshConfig.MaterialsConfig, LoadHandle))
 			{
 				return;
 			}
 
-			SkeletalMeshContext->LODs.Add(LOD);
+			LoadHandle->SetProgress(0.5f);
+
+			SkeletalMeshContext->AddCachedLOD(LOD.ToSharedRef());
+
+			if (LoadHandle->IsCancelled())
+			{
+				return;
+			}
 
 			SkeletalMeshContext->SkeletalMesh = CreateSkeletalMeshFromLODs(SkeletalMeshContext);
+			LoadHandle->SetProgress(0.9f);
 		});
+
+	return LoadHandle;
 }
 
 USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMeshLODs(const TArray<int32>& MeshIndices, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig)
@@ -1819,13 +1873,13 @@ USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMeshLODs(const TArray<int32>& Mes
 			return nullptr;
 		}
 
-		FglTFRuntimeMeshLOD* LOD = nullptr;
+		TSharedPtr<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe> LOD;
 		if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, SkeletalMeshConfig.MaterialsConfig))
 		{
 			return nullptr;
 		}
 
-		SkeletalMeshContext->LODs.Add(LOD);
+		SkeletalMeshContext->AddCachedLOD(LOD.ToSharedRef());
 	}
 
 	if (CreateSkeletalMeshFromLODs(SkeletalMeshContext))
@@ -1858,13 +1912,27 @@ USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMeshRecursive(const FString& Node
 	return nullptr;
 }
 
-void FglTFRuntimeParser::LoadSkeletalMeshRecursiveAsync(const FString& NodeName, const int32 SkinIndex, const TArray<FString>& ExcludeNodes, const FglTFRuntimeSkeletalMeshAsync& AsyncCallback, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode)
+FglTFRuntimeLoadHandleRef FglTFRuntimeParser::LoadSkeletalMeshRecursiveAsync(const FString& NodeName, const int32 SkinIndex, const TArray<FString>& ExcludeNodes, const FglTFRuntimeSkeletalMeshAsync& AsyncCallback, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode)
 {
+	FglTFRuntimeLoadHandleRef LoadHandle = MakeShared<FglTFRuntimeLoadHandle, ESPMode::ThreadSafe>(SkeletalMeshConfig.GameThreadPriority);
+
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), -1, SkeletalMeshConfig);
+	SkeletalMeshContext->LoadHandle = LoadHandle;
 
-	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, ExcludeNodes, NodeName, SkinIndex, AsyncCallback, TransformApplyRecursiveMode]()
+	FglTFRuntimeNativeSkeletalMeshAsync NativeCallback = FglTFRuntimeNativeSkeletalMeshAsync::CreateLambda([AsyncCallback](USkeletalMesh* SkeletalMesh)
 		{
-			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
+			AsyncCallback.ExecuteIfBound(SkeletalMesh);
+		});
+
+	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, ExcludeNodes, NodeName, SkinIndex, NativeCallback, TransformApplyRecursiveMode, LoadHandle]()
+		{
+			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, NativeCallback, LoadHandle);
+
+			if (LoadHandle->IsCancelled())
+			{
+				return;
+			}
+
 			// ensure to cache it as the finalizer requires LOD access
 			FglTFRuntimeMeshLOD& CombinedLOD = SkeletalMeshContext->CachedRuntimeMeshLODs.AddDefaulted_GetRef();
 			int32 NewSkinIndex = SkinIndex;
@@ -1873,11 +1941,21 @@ void FglTFRuntimeParser::LoadSkeletalMeshRecursiveAsync(const FString& NodeName,
 				return;
 			}
 
+			LoadHandle->SetProgress(0.5f);
+
+			if (LoadHandle->IsCancelled())
+			{
+				return;
+			}
+
 			SkeletalMeshContext->SkinIndex = NewSkinIndex;
 			SkeletalMeshContext->LODs.Add(&CombinedLOD);
 
 			SkeletalMeshContext->SkeletalMesh = CreateSkeletalMeshFromLODs(SkeletalMeshContext);
+			LoadHandle->SetProgress(0.9f);
 		});
+
+	return LoadHandle;
 }
 
 UAnimSequence* FglTFRuntimeParser::LoadSkeletalAnimationByName(USkeletalMesh* SkeletalMesh, const FString& AnimationName, const FglTFRuntimeSkeletalAnimationConfig& SkeletalAnimationConfig, const bool bCaseSensitive)
@@ -3905,20 +3983,13 @@ bool FglTFRuntimeParser::LoadSkeletalAnimation_Internal(TSharedRef<FJsonObject>
 	return LoadAnimation_Internal(JsonAnimationObject, Duration, IgnoredName, Callback, Filter, SkeletalAnimationConfig.OverrideTrackNameFromExtension);
 }
 
-void FglTFRuntimeParser::LoadSkinnedMeshRecursiveAsRuntimeLODAsync(const FString& NodeName, int32& SkinIndex, const TArray<FString>& ExcludeNodes, const FglTFRuntimeMeshLODAsync& AsyncCallback, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const FglTFRuntimeSkeletonConfig& SkeletonConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode)
+FglTFRuntimeLoadHandleRef FglTFRuntimeParser::LoadSkinnedMeshRecursiveAsRuntimeLODAsync(const FString& NodeName, int32& SkinIndex, const TArray<FString>& ExcludeNodes, const FglTFRuntimeMeshLODAsync& AsyncCallback, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const FglTFRuntimeSkeletonConfig& SkeletonConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode)
 {
-	Async(EAsyncExecution::Thread, [this, ExcludeNodes, NodeName, SkinIndex, AsyncCallback, MaterialsConfig, SkeletonConfig, TransformApplyRecursiveMode]()
+	return LoadAsRuntimeLODAsync([this, ExcludeNodes, NodeName, SkinIndex, MaterialsConfig, SkeletonConfig, TransformApplyRecursiveMode](FglTFRuntimeMeshLOD& RuntimeLOD, FglTFRuntimeLoadHandleRef LoadHandle)
 		{
-			FglTFRuntimeMeshLOD LOD;
 			int32 NewSkinIndex = SkinIndex;
-			const bool bSuccess = LoadSkinnedMeshRecursiveAsRuntimeLOD(NodeName, NewSkinIndex, ExcludeNodes, LOD, MaterialsConfig, SkeletonConfig, TransformApplyRecursiveMode);
-
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&]()
-				{
-					AsyncCallback.ExecuteIfBound(bSuccess, MoveTemp(LOD));
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		});
+			return LoadSkinnedMeshRecursiveAsRuntimeLOD(NodeName, NewSkinIndex, ExcludeNodes, RuntimeLOD, MaterialsConfig, SkeletonConfig, TransformApplyRecursiveMode);
+		}, AsyncCallback);
 }
 
 bool FglTFRuntimeParser::LoadSkinnedMeshRecursiveAsRuntimeLOD(const FString& NodeName, int32& SkinIndex, const TArray<FString>& ExcludeNodes, FglTFRuntimeMeshLOD& RuntimeLOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const FglTFRuntimeSkeletonConfig& SkeletonConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode)
@@ -4013,7 +4084,7 @@ bool FglTFRuntimeParser::LoadSkinnedMeshRecursiveAsRuntimeLOD(const FString& Nod
 			// keep track of primitives
 			int32 PrimitiveFirstIndex = RuntimeLOD.Primitives.Num();
 
-			FglTFRuntimeMeshLOD* LOD = nullptr;
+			TSharedPtr<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe> LOD;
 			if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, MaterialsConfig))
 			{
 				return false;
@@ -4062,6 +4133,7 @@ bool FglTFRuntimeParser::LoadSkinnedMeshRecursiveAsRuntimeLOD(const FString& Nod
 					for (int32 PrimitiveIndex = PrimitiveFirstIndex; PrimitiveIndex < RuntimeLOD.Primitives.Num(); PrimitiveIndex++)
 					{
 						FglTFRuntimePrimitive& Primitive = RuntimeLOD.Primitives[PrimitiveIndex];
+						Primitive.ExpandCompactVertexData();
 						for (FVector& Vector : Primitive.Positions)
 						{
 							Vector = AdditionalTransform.TransformPosition(Vector);
@@ -4106,6 +4178,7 @@ bool FglTFRuntimeParser::LoadSkinnedMeshRecursiveAsRuntimeLOD(const FString& Nod
 				for (int32 PrimitiveIndex = PrimitiveFirstIndex; PrimitiveIndex < RuntimeLOD.Primitives.Num(); PrimitiveIndex++)
 				{
 					FglTFRuntimePrimitive& Primitive = RuntimeLOD.Primitives[PrimitiveIndex];
+					Primitive.ExpandCompactVertexData();
 					for (FVector& Vector : Primitive.Positions)
 					{
 						Vector = AdditionalTransform.TransformPosition(Vector);
@@ -4222,6 +4295,14 @@ bool FglTFRuntimeParser::LoadSkinnedMeshRecursiveAsRuntimeLOD(const FString& Nod
 		}
 
 		RuntimeLOD.Primitives = MergedPrimitives;
+
+		if (MaterialsConfig.bWeldVertices)
+		{
+			ParallelFor(RuntimeLOD.Primitives.Num(), [&](const int32 PrimitiveIndex)
+				{
+					glTFRuntime::WeldPrimitiveVertices(RuntimeLOD.Primitives[PrimitiveIndex], MaterialsConfig.WeldVerticesTolerance, MaterialsConfig.WeldVerticesAttributesTolerance);
+				});
+		}
 	}
 
 	return true;
@@ -1,6 +1,7 @@
 // Copyright 2020-2022, Roberto De Ioris.
 
 #include "glTFRuntimeParser.h"
+#include "glTFRuntimeGameThreadQueue.h"
 #include "MeshDescription.h"
 #include "StaticMeshAttributes.h"
 #include "StaticMeshOperations.h"
@@ -61,37 +62,61 @@ FglTFRuntimeStaticMeshContext::FglTFRuntimeStaticMeshContext(TSharedRef<FglTFRun
 }
 
 
-void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, const FglTFRuntimeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig)
+FglTFRuntimeLoadHandleRef FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, const FglTFRuntimeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig)
 {
+	return LoadStaticMeshAsync(MeshIndex, FglTFRuntimeNativeStaticMeshAsync::CreateLambda([AsyncCallback](UStaticMesh* StaticMesh)
+		{
+			AsyncCallback.ExecuteIfBound(StaticMesh);
+		}), StaticMeshConfig);
+}
+
+FglTFRuntimeLoadHandleRef FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, const FglTFRuntimeNativeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig)
+{
+	FglTFRuntimeLoadHandleRef LoadHandle = MakeShared<FglTFRuntimeLoadHandle, ESPMode::ThreadSafe>(StaticMeshConfig.GameThreadPriority);
+
 	// first check cache
-	if (CanReadFromCache(StaticMeshConfig.CacheMode) && StaticMeshesCache.Contains(MeshIndex))
+	UStaticMesh* CachedStaticMesh = CanReadFromCache(StaticMeshConfig.CacheMode) ? FindInObjectsCache<UStaticMesh>(StaticMeshesCache, MeshIndex) : nullptr;
+	if (CachedStaticMesh)
 	{
-		UStaticMesh* StaticMesh = StaticMeshesCache[MeshIndex];
-		FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMesh, AsyncCallback]()
+		UStaticMesh* StaticMesh = CachedStaticMesh;
+		FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMesh, AsyncCallback, LoadHandle]()
 			{
-				AsyncCallback.ExecuteIfBound(StaticMesh);
+				LoadHandle->Complete();
+				AsyncCallback.ExecuteIfBound(LoadHandle->IsCancelled() ? nullptr : StaticMesh);
 			}, TStatId(), nullptr, ENamedThreads::GameThread);
-		return;
+		return LoadHandle;
 	}
 
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), MeshIndex, StaticMeshConfig);
+	StaticMeshContext->LoadHandle = LoadHandle;
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, MeshIndex, AsyncCallback]()
+	Async(EAsyncExecution::Thread, [this, StaticMeshContext, MeshIndex, AsyncCallback, LoadHandle]()
 		{
-			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+			TSharedPtr<FJsonObject> JsonMeshObject = LoadHandle->IsCancelled() ? nullptr : GetJsonObjectFromRootIndex("meshes", MeshIndex);
 			if (JsonMeshObject)
 			{
-				FglTFRuntimeMeshLOD* LOD = nullptr;
-				if (LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshContext->StaticMeshConfig.MaterialsConfig))
+				TSharedPtr<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe> LOD;
+				if (LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshContext->StaticMeshConfig.MaterialsConfig, LoadHandle))
 				{
-					StaticMeshContext->LODs.Add(LOD);
+					LoadHandle->SetProgress(0.5f);
+
+					StaticMeshContext->AddCachedLOD(LOD.ToSharedRef());
 
-					StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
+					if (!LoadHandle->IsCancelled())
+					{
+						StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
+						LoadHandle->SetProgress(0.9f);
+					}
 				}
 			}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([MeshIndex, StaticMeshContext, AsyncCallback]()
+			FGraphEventRef Task = FglTFRuntimeGameThreadQueue::Get().Enqueue([MeshIndex, StaticMeshContext, AsyncCallback, LoadHandle]()
 				{
+					if (LoadHandle->IsCancelled())
+					{
+						StaticMeshContext->StaticMesh = nullptr;
+					}
+
 					if (StaticMeshContext->StaticMesh)
 					{
 						StaticMeshContext->StaticMesh = StaticMeshContext->Parser->FinalizeStaticMesh(StaticMeshContext);
@@ -101,18 +126,21 @@ void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, const FglTFR
 					{
 						if (StaticMeshContext->Parser->CanWriteToCache(StaticMeshContext->StaticMeshConfig.CacheMode))
 						{
-							StaticMeshContext->Parser->StaticMeshesCache.Add(MeshIndex, StaticMeshContext->StaticMesh);
+							StaticMeshContext->Parser->AddToObjectsCache(StaticMeshContext->Parser->StaticMeshesCache, MeshIndex, StaticMeshContext->StaticMesh);
 						}
 					}
 
+					LoadHandle->Complete();
 					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
 #if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2) || ENGINE_MAJOR_VERSION > 5
 					// this is ugly, but we need to avoid at all costs to have the FGCObject dtor to be run out of the game thread
 					StaticMeshContext->UnregisterGCObject();
 #endif
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
+				}, LoadHandle);
 			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 		});
+
+	return LoadHandle;
 }
 
 UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext)
@@ -121,6 +149,17 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 	OnPreCreatedStaticMesh.Broadcast(StaticMeshContext);
 
+	// after the hooks, so LOD generators bound there take precedence
+	if (StaticMeshContext->StaticMeshConfig.AutoLODsTrianglesRatios.Num() > 0 && StaticMeshContext->LODs.Num() == 1)
+	{
+		TArray<FglTFRuntimeMeshLOD> AutoLODs;
+		glTFRuntime::GenerateSimplifiedLODs(*StaticMeshContext->LODs[0], StaticMeshContext->StaticMeshConfig.AutoLODsTrianglesRatios, AutoLODs);
+		for (FglTFRuntimeMeshLOD& AutoLOD : AutoLODs)
+		{
+			StaticMeshContext->AddContextLOD() = MoveTemp(AutoLOD);
+		}
+	}
+
 	UStaticMesh* StaticMesh = StaticMeshContext->StaticMesh;
 	FStaticMeshRenderData* RenderData = StaticMeshContext->RenderData;
 	const FglTFRuntimeStaticMeshConfig& StaticMeshConfig = StaticMeshContext->StaticMeshConfig;
@@ -139,6 +178,13 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 	// this is used for inheriting materials while in multi LOD mode
 	TMap<int32, int32> SectionMaterialMap;
 
+	int32 NumSectionsToBuild = 0;
+	int32 NumSectionsBuilt = 0;
+	for (const FglTFRuntimeMeshLOD* LOD : LODs)
+	{
+		NumSectionsToBuild += LOD->Primitives.Num();
+	}
+
 	for (const FglTFRuntimeMeshLOD* LOD : LODs)
 	{
 		const int32 CurrentLODIndex = LODIndex++;
@@ -157,17 +203,17 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 		for (const FglTFRuntimePrimitive& Primitive : LOD->Primitives)
 		{
-			if (Primitive.UVs.Num() > NumUVs)
+			if (Primitive.NumUVs() > NumUVs)
 			{
-				NumUVs = Primitive.UVs.Num();
+				NumUVs = Primitive.NumUVs();
 			}
 
-			if (Primitive.Colors.Num() > 0)
+			if (Primitive.NumColors() > 0)
 			{
 				bHasVertexColors = true;
 			}
 
-			NumVerticesToBuildPerLOD += Primitive.bHasIndices ? Primitive.Positions.Num() : Primitive.Indices.Num();
+			NumVerticesToBuildPerLOD += Primitive.bHasIndices ? Primitive.NumVertices() : Primitive.Indices.Num();
 		}
 
 		TArray<FStaticMeshBuildVertex> StaticMeshBuildVertices;
@@ -185,8 +231,20 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 		int32 AdditionalTransformsPrimitiveIndex = 0; // used only when applying additional transforms
 
+		// VertexBaseIndex, NumVertices, VertexInstanceBaseIndex, NumVertexInstances of the sections to optimize
+		TArray<TTuple<int32, int32, int32, int32>> SectionsToOptimize;
+
 		for (const FglTFRuntimePrimitive& Primitive : LOD->Primitives)
 		{
+			if (StaticMeshContext->LoadHandle)
+			{
+				if (StaticMeshContext->LoadHandle->IsCancelled())
+				{
+					return nullptr;
+				}
+				StaticMeshContext->LoadHandle->SetStageProgress(0.5f, 0.9f, NumSectionsBuilt++, NumSectionsToBuild);
+			}
+
 			FName MaterialName = FName(FString::Printf(TEXT("LOD_%d_Section_%d_%s"), CurrentLODIndex, StaticMeshContext->StaticMaterials.Num(), *Primitive.MaterialName));
 			if (StaticMeshContext->StaticMeshConfig.MaterialsConfig.MaterialSlotRemapper.Remapper.IsBound())
 			{
@@ -255,35 +313,35 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 			// Geometry generation
 			if (Primitive.bHasIndices)
 			{
-				ParallelFor(Primitive.Positions.Num(), [&](const int32 VertexIndex)
+				ParallelFor(Primitive.NumVertices(), [&](const int32 VertexIndex)
 					{
 						FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[VertexBaseIndex + VertexIndex];
 
 #if ENGINE_MAJOR_VERSION > 4
-						StaticMeshVertex.Position = FVector3f(GetSafeValue(Primitive.Positions, VertexIndex, FVector::ZeroVector, bMissingIgnore));
+						StaticMeshVertex.Position = FVector3f(Primitive.GetPosition(VertexIndex, bMissingIgnore));
 #else
-						StaticMeshVertex.Position = GetSafeValue(Primitive.Positions, VertexIndex, FVector::ZeroVector, bMissingIgnore);
+						StaticMeshVertex.Position = Primitive.GetPosition(VertexIndex, bMissingIgnore);
 #endif
 
-						FVector4 TangentX = GetSafeValue(Primitive.Tangents, VertexIndex, FVector4(0, 0, 0, 1), bMissingTangents);
+						FVector4 TangentX = Primitive.GetTangent(VertexIndex, bMissingTangents);
 #if ENGINE_MAJOR_VERSION > 4
 						StaticMeshVertex.TangentX = FVector4f(TangentX);
-						StaticMeshVertex.TangentZ = FVector3f(GetSafeValue(Primitive.Normals, VertexIndex, FVector::ZeroVector, bMissingNormals));
+						StaticMeshVertex.TangentZ = FVector3f(Primitive.GetNormal(VertexIndex, bMissingNormals));
 						StaticMeshVertex.TangentY = FVector3f(glTFRuntime::ComputeTangentYWithW(FVector(StaticMeshVertex.TangentZ), FVector(StaticMeshVertex.TangentX), TangentX.W * TangentsDirection));
 #else
 						StaticMeshVertex.TangentX = TangentX;
-						StaticMeshVertex.TangentZ = GetSafeValue(Primitive.Normals, VertexIndex, FVector::ZeroVector, bMissingNormals);
+						StaticMeshVertex.TangentZ = Primitive.GetNormal(VertexIndex, bMissingNormals);
 						StaticMeshVertex.TangentY = glTFRuntime::ComputeTangentYWithW(StaticMeshVertex.TangentZ, StaticMeshVertex.TangentX, TangentX.W * TangentsDirection);
 #endif
 
 						for (int32 UVIndex = 0; UVIndex < NumUVs; UVIndex++)
 						{
-							if (UVIndex < Primitive.UVs.Num())
+							if (UVIndex < Primitive.NumUVs())
 							{
 #if ENGINE_MAJOR_VERSION > 4
-								StaticMeshVertex.UVs[UVIndex] = FVector2f(GetSafeValue(Primitive.UVs[UVIndex], VertexIndex, FVector2D::ZeroVector, bMissingIgnore));
+								StaticMeshVertex.UVs[UVIndex] = FVector2f(Primitive.GetUV(UVIndex, VertexIndex, bMissingIgnore));
 #else
-								StaticMeshVertex.UVs[UVIndex] = GetSafeValue(Primitive.UVs[UVIndex], VertexIndex, FVector2D::ZeroVector, bMissingIgnore);
+								StaticMeshVertex.UVs[UVIndex] = Primitive.GetUV(UVIndex, VertexIndex, bMissingIgnore);
 #endif
 							}
 							// no UVs specified, let's set them to 0
@@ -299,7 +357,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 						if (bHasVertexColors)
 						{
-							StaticMeshVertex.Color = FLinearColor(GetSafeValue(Primitive.Colors, VertexIndex, WhiteColor, bMissingIgnore)).ToFColor(true);
+							StaticMeshVertex.Color = FLinearColor(Primitive.GetColor(VertexIndex, WhiteColor, bMissingIgnore)).ToFColor(true);
 						}
 
 						if (bApplyAdditionalTransforms)
@@ -334,30 +392,30 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 						FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[VertexBaseIndex + VertexInstanceSectionIndex];
 
 #if ENGINE_MAJOR_VERSION > 4
-						StaticMeshVertex.Position = FVector3f(GetSafeValue(Primitive.Positions, VertexIndex, FVector::ZeroVector, bMissingIgnore));
+						StaticMeshVertex.Position = FVector3f(Primitive.GetPosition(VertexIndex, bMissingIgnore));
 #else
-						StaticMeshVertex.Position = GetSafeValue(Primitive.Positions, VertexIndex, FVector::ZeroVector, bMissingIgnore);
+						StaticMeshVertex.Position = Primitive.GetPosition(VertexIndex, bMissingIgnore);
 #endif
 
-						FVector4 TangentX = GetSafeValue(Primitive.Tangents, VertexIndex, FVector4(0, 0, 0, 1), bMissingTangents);
+						FVector4 TangentX = Primitive.GetTangent(VertexIndex, bMissingTangents);
 #if ENGINE_MAJOR_VERSION > 4
 						StaticMeshVertex.TangentX = FVector4f(TangentX);
-						StaticMeshVertex.TangentZ = FVector3f(GetSafeValue(Primitive.Normals, VertexIndex, FVector::ZeroVector, bMissingNormals));
+						StaticMeshVertex.TangentZ = FVector3f(Primitive.GetNormal(VertexIndex, bMissingNormals));
 						StaticMeshVertex.TangentY = FVector3f(glTFRuntime::ComputeTangentYWithW(FVector(StaticMeshVertex.TangentZ), FVector(StaticMeshVertex.TangentX), TangentX.W * TangentsDirection));
 #else
 						StaticMeshVertex.TangentX = TangentX;
-						StaticMeshVertex.TangentZ = GetSafeValue(Primitive.Normals, VertexIndex, FVector::ZeroVector, bMissingNormals);
+						StaticMeshVertex.TangentZ = Primitive.GetNormal(VertexIndex, bMissingNormals);
 						StaticMeshVertex.TangentY = glTFRuntime::ComputeTangentYWithW(StaticMeshVertex.TangentZ, StaticMeshVertex.TangentX, TangentX.W * TangentsDirection);
 #endif
 
 						for (int32 UVIndex = 0; UVIndex < NumUVs; UVIndex++)
 						{
-							if (UVIndex < Primitive.UVs.Num())
+							if (UVIndex < Primitive.NumUVs())
 							{
 #if ENGINE_MAJOR_VERSION > 4
-								StaticMeshVertex.UVs[UVIndex] = FVector2f(GetSafeValue(Primitive.UVs[UVIndex], VertexIndex, FVector2D::ZeroVector, bMissingIgnore));
+								StaticMeshVertex.UVs[UVIndex] = FVector2f(Primitive.GetUV(UVIndex, VertexIndex, bMissingIgnore));
 #else
-								StaticMeshVertex.UVs[UVIndex] = GetSafeValue(Primitive.UVs[UVIndex], VertexIndex, FVector2D::ZeroVector, bMissingIgnore);
+								StaticMeshVertex.UVs[UVIndex] = Primitive.GetUV(UVIndex, VertexIndex, bMissingIgnore);
 #endif
 							}
 							// no UVs specified, let's set them to 0
@@ -373,7 +431,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 						if (bHasVertexColors)
 						{
-							StaticMeshVertex.Color = FLinearColor(GetSafeValue(Primitive.Colors, VertexIndex, WhiteColor, bMissingIgnore)).ToFColor(true);
+							StaticMeshVertex.Color = FLinearColor(Primitive.GetColor(VertexIndex, WhiteColor, bMissingIgnore)).ToFColor(true);
 						}
 
 						if (bApplyAdditionalTransforms)
@@ -405,96 +463,45 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 				}
 			}
 
-			const bool bCanGenerateNormals = (bMissingNormals && StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::IfMissing) ||
-				StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Always;
-			if (bCanGenerateNormals && (NumVertexInstancesPerSection % 3) == 0)
-			{
-				TSet<uint32> ProcessedVertices;
-				ProcessedVertices.Reserve(NumVertexInstancesPerSection);
-
-				FCriticalSection NormalsGenerationLock;
-
-				ParallelFor(NumVertexInstancesPerSection / 3, [&](const int32 VertexInstanceSectionTriangleIndex)
+			// section local geometry shared by normals and tangents generation
+			const int32 NumVerticesInSection = Primitive.bHasIndices ? Primitive.NumVertices() : NumVertexInstancesPerSection;
+			TArray<FVector> SectionPositions;
+			TArray<uint32> SectionIndices;
+			auto BuildSectionGeometry = [&]()
+				{
+					if (SectionPositions.Num() > 0)
 					{
-						const int32 VertexInstanceSectionIndex = VertexInstanceBaseIndex + VertexInstanceSectionTriangleIndex * 3;
-						bool bSetVertex0 = false;
-						bool bSetVertex1 = false;
-						bool bSetVertex2 = false;
-
-						const uint32 VertexIndex0 = LODIndices[VertexInstanceSectionIndex];
-						const uint32 VertexIndex1 = LODIndices[VertexInstanceSectionIndex + 1];
-						const uint32 VertexIndex2 = LODIndices[VertexInstanceSectionIndex + 2];
+						return;
+					}
 
-						if (Primitive.bHasIndices)
+					SectionPositions.AddUninitialized(NumVerticesInSection);
+					ParallelFor(NumVerticesInSection, [&](const int32 VertexIndex)
 						{
-							FScopeLock Lock(&NormalsGenerationLock);
+							SectionPositions[VertexIndex] = FVector(StaticMeshBuildVertices[VertexBaseIndex + VertexIndex].Position);
+						});
 
-							if (!ProcessedVertices.Contains(VertexIndex0))
-							{
-								ProcessedVertices.Add(VertexIndex0);
-								bSetVertex0 = true;
-							}
-
-							if (!ProcessedVertices.Contains(VertexIndex1))
-							{
-								ProcessedVertices.Add(VertexIndex1);
-								bSetVertex1 = true;
-							}
-
-							if (!ProcessedVertices.Contains(VertexIndex2))
-							{
-								ProcessedVertices.Add(VertexIndex2);
-								bSetVertex2 = true;
-							}
-
-							if (!bSetVertex0 && !bSetVertex1 && !bSetVertex2)
-							{
-								return;
-							}
-						}
-						else
+					SectionIndices.AddUninitialized(NumVertexInstancesPerSection);
+					ParallelFor(NumVertexInstancesPerSection, [&](const int32 VertexInstanceSectionIndex)
 						{
-							bSetVertex0 = true;
-							bSetVertex1 = true;
-							bSetVertex2 = true;
-						}
+							SectionIndices[VertexInstanceSectionIndex] = LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex] - VertexBaseIndex;
+						});
+				};
 
-						if (!StaticMeshBuildVertices.IsValidIndex(VertexIndex0) || !StaticMeshBuildVertices.IsValidIndex(VertexIndex1) || !StaticMeshBuildVertices.IsValidIndex(VertexIndex2))
-						{
-							return;
-						}
+			const bool bCanGenerateNormals = (bMissingNormals && StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::IfMissing) ||
+				StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Always;
+			if (bCanGenerateNormals && (NumVertexInstancesPerSection % 3) == 0)
+			{
+				BuildSectionGeometry();
 
-						FStaticMeshBuildVertex& StaticMeshVertex0 = StaticMeshBuildVertices[VertexIndex0];
-						FStaticMeshBuildVertex& StaticMeshVertex1 = StaticMeshBuildVertices[VertexIndex1];
-						FStaticMeshBuildVertex& StaticMeshVertex2 = StaticMeshBuildVertices[VertexIndex2];
+				TArray<FVector> SectionNormals;
+				glTFRuntime::ComputeSmoothNormals(SectionPositions, SectionIndices, SectionNormals, StaticMeshConfig.bWeldVerticesForNormals, StaticMeshConfig.NormalsWeldTolerance, StaticMeshConfig.NormalsCreaseAngle);
 
+				ParallelFor(NumVerticesInSection, [&](const int32 VertexIndex)
+					{
 #if ENGINE_MAJOR_VERSION > 4
-						FVector SideA = FVector(StaticMeshVertex1.Position - StaticMeshVertex0.Position);
-						FVector SideB = FVector(StaticMeshVertex2.Position - StaticMeshVertex0.Position);
-						FVector NormalFromCross = FVector::CrossProduct(SideB, SideA).GetSafeNormal();
-
-						StaticMeshVertex0.TangentZ = FVector3f(NormalFromCross);
-						StaticMeshVertex1.TangentZ = FVector3f(NormalFromCross);
-						StaticMeshVertex2.TangentZ = FVector3f(NormalFromCross);
+						StaticMeshBuildVertices[VertexBaseIndex + VertexIndex].TangentZ = FVector3f(SectionNormals[VertexIndex]);
 #else
-						FVector SideA = StaticMeshVertex1.Position - StaticMeshVertex0.Position;
-						FVector SideB = StaticMeshVertex2.Position - StaticMeshVertex0.Position;
-						FVector NormalFromCross = FVector::CrossProduct(SideB, SideA).GetSafeNormal();
-
-						if (bSetVertex0)
-						{
-							StaticMeshVertex0.TangentZ = NormalFromCross;
-						}
-
-						if (bSetVertex1)
-						{
-							StaticMeshVertex1.TangentZ = NormalFromCross;
-						}
-
-						if (bSetVertex2)
-						{
-							StaticMeshVertex2.TangentZ = NormalFromCross;
-						}
+						StaticMeshBuildVertices[VertexBaseIndex + VertexIndex].TangentZ = SectionNormals[VertexIndex];
 #endif
 					});
 				bMissingNormals = false;
@@ -503,152 +510,101 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 			const bool bCanGenerateTangents = (bMissingTangents && StaticMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::IfMissing) ||
 				StaticMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::Always;
 			// recompute tangents if required (need normals and uvs)
-			if (bCanGenerateTangents && !bMissingNormals && Primitive.UVs.Num() > 0 && (NumVertexInstancesPerSection % 3) == 0)
+			if (bCanGenerateTangents && !bMissingNormals && Primitive.NumUVs() > 0 && (NumVertexInstancesPerSection % 3) == 0)
 			{
-				TSet<uint32> ProcessedVertices;
-				ProcessedVertices.Reserve(NumVertexInstancesPerSection);
-
-				FCriticalSection TangentsGenerationLock;
+				BuildSectionGeometry();
 
-				ParallelFor(NumVertexInstancesPerSection / 3, [&](const int32 VertexInstanceSectionTriangleIndex)
+				TArray<FVector> SectionNormals;
+				SectionNormals.AddUninitialized(NumVerticesInSection);
+				TArray<FVector2D> SectionUVs;
+				SectionUVs.AddUninitialized(NumVerticesInSection);
+				ParallelFor(NumVerticesInSection, [&](const int32 VertexIndex)
 					{
-						const int32 VertexInstanceSectionIndex = VertexInstanceBaseIndex + VertexInstanceSectionTriangleIndex * 3;
-						bool bSetVertex0 = false;
-						bool bSetVertex1 = false;
-						bool bSetVertex2 = false;
-
-						const uint32 VertexIndex0 = LODIndices[VertexInstanceSectionIndex];
-						const uint32 VertexIndex1 = LODIndices[VertexInstanceSectionIndex + 1];
-						const uint32 VertexIndex2 = LODIndices[VertexInstanceSectionIndex + 2];
-
-						if (Primitive.bHasIndices)
-						{
-							FScopeLock Lock(&TangentsGenerationLock);
-
-							if (!ProcessedVertices.Contains(VertexIndex0))
-							{
-								ProcessedVertices.Add(VertexIndex0);
-								bSetVertex0 = true;
-							}
-
-							if (!ProcessedVertices.Contains(VertexIndex1))
-							{
-								ProcessedVertices.Add(VertexIndex1);
-								bSetVertex1 = true;
-							}
-
-							if (!ProcessedVertices.Contains(VertexIndex2))
-							{
-								ProcessedVertices.Add(VertexIndex2);
-								bSetVertex2 = true;
-							}
-
-							if (!bSetVertex0 && !bSetVertex1 && !bSetVertex2)
-							{
-								return;
-							}
-						}
-						else
-						{
-							bSetVertex0 = true;
-							bSetVertex1 = true;
-							bSetVertex2 = true;
-						}
-
-						if (!StaticMeshBuildVertices.IsValidIndex(VertexIndex0) || !StaticMeshBuildVertices.IsValidIndex(VertexIndex1) || !StaticMeshBuildVertices.IsValidIndex(VertexIndex2))
-						{
-							return;
-						}
-
-						FStaticMeshBuildVertex& StaticMeshVertex0 = StaticMeshBuildVertices[VertexIndex0];
-						FStaticMeshBuildVertex& StaticMeshVertex1 = StaticMeshBuildVertices[VertexIndex1];
-						FStaticMeshBuildVertex& StaticMeshVertex2 = StaticMeshBuildVertices[VertexIndex2];
-
-#if ENGINE_MAJOR_VERSION > 4
-						const FVector Position0 = FVector(StaticMeshVertex0.Position);
-						const FVector4 TangentZ0 = FVector(StaticMeshVertex0.TangentZ);
-						const FVector2D UV0 = FVector2D(StaticMeshVertex0.UVs[0]);
-#else
-						const FVector Position0 = StaticMeshVertex0.Position;
-						const FVector4 TangentZ0 = StaticMeshVertex0.TangentZ;
-						const FVector2D UV0 = StaticMeshVertex0.UVs[0];
-#endif
+						const FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[VertexBaseIndex + VertexIndex];
+						SectionNormals[VertexIndex] = FVector(StaticMeshVertex.TangentZ);
+						SectionUVs[VertexIndex] = FVector2D(StaticMeshVertex.UVs[0]);
+					});
 
-#if ENGINE_MAJOR_VERSION > 4
-						const FVector Position1 = FVector(StaticMeshVertex1.Position);
-						const FVector4 TangentZ1 = FVector(StaticMeshVertex1.TangentZ);
-						const FVector2D UV1 = FVector2D(StaticMeshVertex1.UVs[0]);
-#else
-						const FVector Position1 = StaticMeshVertex1.Position;
-						const FVector4 TangentZ1 = StaticMeshVertex1.TangentZ;
-						const FVector2D UV1 = StaticMeshVertex1.UVs[0];
-#endif
+				TArray<FVector4> SectionTangents;
+				glTFRuntime::ComputeMikkTSpaceTangents(SectionPositions, SectionNormals, SectionUVs, SectionIndices, SectionTangents);
 
+				ParallelFor(NumVerticesInSection, [&](const int32 VertexIndex)
+					{
+						FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[VertexBaseIndex + VertexIndex];
+						const FVector4& TangentX = SectionTangents[VertexIndex];
 #if ENGINE_MAJOR_VERSION > 4
-						const FVector Position2 = FVector(StaticMeshVertex2.Position);
-						const FVector4 TangentZ2 = FVector(StaticMeshVertex2.TangentZ);
-						const FVector2D UV2 = FVector2D(StaticMeshVertex2.UVs[0]);
+						StaticMeshVertex.TangentX = FVector3f(FVector(TangentX));
+						StaticMeshVertex.TangentY = FVector3f(glTFRuntime::ComputeTangentYWithW(FVector(StaticMeshVertex.TangentZ), FVector(StaticMeshVertex.TangentX), TangentX.W * TangentsDirection));
 #else
-						const FVector Position2 = StaticMeshVertex2.Position;
-						const FVector4 TangentZ2 = StaticMeshVertex2.TangentZ;
-						const FVector2D UV2 = StaticMeshVertex2.UVs[0];
+						StaticMeshVertex.TangentX = FVector(TangentX);
+						StaticMeshVertex.TangentY = glTFRuntime::ComputeTangentYWithW(StaticMeshVertex.TangentZ, StaticMeshVertex.TangentX, TangentX.W * TangentsDirection);
 #endif
+					});
+			}
 
-						const FVector DeltaPosition0 = Position1 - Position0;
-						const FVector DeltaPosition1 = Position2 - Position0;
+			if (StaticMeshConfig.bOptimizeVertexCache && (NumVertexInstancesPerSection % 3) == 0)
+			{
+				SectionsToOptimize.Add(MakeTuple(VertexBaseIndex, NumVerticesInSection, VertexInstanceBaseIndex, NumVertexInstancesPerSection));
+			}
 
-						const FVector2D DeltaUV0 = UV1 - UV0;
-						const FVector2D DeltaUV1 = UV2 - UV0;
+			VertexInstanceBaseIndex += NumVertexInstancesPerSection;
+			VertexBaseIndex += Primitive.bHasIndices ? Primitive.NumVertices() : Primitive.Indices.Num();
+		}
 
-						const float Factor = 1.0f / (DeltaUV0.X * DeltaUV1.Y - DeltaUV0.Y * DeltaUV1.X);
+		// sections are independent, reorder their triangles and vertices in parallel
+		if (SectionsToOptimize.Num() > 0)
+		{
+			TArray<FglTFRuntimeMeshOptimizationStats> SectionsStats;
+			SectionsStats.AddDefaulted(SectionsToOptimize.Num());
 
-						const FVector TriangleTangentX = ((DeltaPosition0 * DeltaUV1.Y) - (DeltaPosition1 * DeltaUV0.Y)) * Factor;
-						//const FVector TriangleTangentY = ((DeltaPosition0 * DeltaUV1.X) - (DeltaPosition1 * DeltaUV0.X)) * Factor;
+			ParallelFor(SectionsToOptimize.Num(), [&](const int32 SectionToOptimizeIndex)
+				{
+					const int32 SectionVertexBaseIndex = SectionsToOptimize[SectionToOptimizeIndex].Get<0>();
+					const int32 NumVerticesInSection = SectionsToOptimize[SectionToOptimizeIndex].Get<1>();
+					const int32 SectionVertexInstanceBaseIndex = SectionsToOptimize[SectionToOptimizeIndex].Get<2>();
+					const int32 NumVertexInstancesInSection = SectionsToOptimize[SectionToOptimizeIndex].Get<3>();
+
+					TArray<uint32> SectionIndices;
+					SectionIndices.AddUninitialized(NumVertexInstancesInSection);
+					for (int32 VertexInstanceSectionIndex = 0; VertexInstanceSectionIndex < NumVertexInstancesInSection; VertexInstanceSectionIndex++)
+					{
+						SectionIndices[VertexInstanceSectionIndex] = LODIndices[SectionVertexInstanceBaseIndex + VertexInstanceSectionIndex] - SectionVertexBaseIndex;
+					}
 
-						if (bSetVertex0)
+					TArray<FVector> SectionPositions;
+					if (StaticMeshConfig.OverdrawThreshold >= 1)
+					{
+						SectionPositions.AddUninitialized(NumVerticesInSection);
+						for (int32 VertexIndex = 0; VertexIndex < NumVerticesInSection; VertexIndex++)
 						{
-							FVector TangentX0 = TriangleTangentX - (TangentZ0 * FVector::DotProduct(TangentZ0, TriangleTangentX));
-							TangentX0.Normalize();
-#if ENGINE_MAJOR_VERSION > 4
-							StaticMeshVertex0.TangentX = FVector3f(TangentX0);
-							StaticMeshVertex0.TangentY = FVector3f(glTFRuntime::ComputeTangentY(FVector(StaticMeshVertex0.TangentZ), FVector(StaticMeshVertex0.TangentX)) * TangentsDirection);
-#else
-							StaticMeshVertex0.TangentX = TangentX0;
-							StaticMeshVertex0.TangentY = glTFRuntime::ComputeTangentY(StaticMeshVertex0.TangentZ, StaticMeshVertex0.TangentX) * TangentsDirection;
-#endif
+							SectionPositions[VertexIndex] = FVector(StaticMeshBuildVertices[SectionVertexBaseIndex + VertexIndex].Position);
 						}
+					}
 
-						if (bSetVertex1)
-						{
-							FVector TangentX1 = TriangleTangentX - (TangentZ1 * FVector::DotProduct(TangentZ1, TriangleTangentX));
-							TangentX1.Normalize();
+					TArray<int32> NewToOld;
+					if (!glTFRuntime::OptimizeSection(SectionIndices, NumVerticesInSection, StaticMeshConfig.VertexCacheSize, NewToOld, SectionsStats[SectionToOptimizeIndex], SectionPositions, StaticMeshConfig.OverdrawThreshold))
+					{
+						return;
+					}
 
-#if ENGINE_MAJOR_VERSION > 4
-							StaticMeshVertex1.TangentX = FVector3f(TangentX1);
-							StaticMeshVertex1.TangentY = FVector3f(glTFRuntime::ComputeTangentY(FVector(StaticMeshVertex1.TangentZ), FVector(StaticMeshVertex1.TangentX)) * TangentsDirection);
-#else
-							StaticMeshVertex1.TangentX = TangentX1;
-							StaticMeshVertex1.TangentY = glTFRuntime::ComputeTangentY(StaticMeshVertex1.TangentZ, StaticMeshVertex1.TangentX) * TangentsDirection;
-#endif
-						}
+					const TArray<FStaticMeshBuildVertex> SectionVertices(StaticMeshBuildVertices.GetData() + SectionVertexBaseIndex, NumVerticesInSection);
+					for (int32 VertexIndex = 0; VertexIndex < NumVerticesInSection; VertexIndex++)
+					{
+						StaticMeshBuildVertices[SectionVertexBaseIndex + VertexIndex] = SectionVertices[NewToOld[VertexIndex]];
+					}
 
-						if (bSetVertex2)
-						{
-							FVector TangentX2 = TriangleTangentX - (TangentZ2 * FVector::DotProduct(TangentZ2, TriangleTangentX));
-							TangentX2.Normalize();
-#if ENGINE_MAJOR_VERSION > 4
-							StaticMeshVertex2.TangentX = FVector3f(TangentX2);
-							StaticMeshVertex2.TangentY = FVector3f(glTFRuntime::ComputeTangentY(FVector(StaticMeshVertex2.TangentZ), FVector(StaticMeshVertex2.TangentX)) * TangentsDirection);
-#else
-							StaticMeshVertex2.TangentX = TangentX2;
-							StaticMeshVertex2.TangentY = glTFRuntime::ComputeTangentY(StaticMeshVertex2.TangentZ, StaticMeshVertex2.TangentX) * TangentsDirection;
-#endif
-						}
-					});
-			}
+					for (int32 VertexInstanceSectionIndex = 0; VertexInstanceSectionIndex < NumVertexInstancesInSection; VertexInstanceSectionIndex++)
+					{
+						LODIndices[SectionVertexInstanceBaseIndex + VertexInstanceSectionIndex] = SectionVertexBaseIndex + SectionIndices[VertexInstanceSectionIndex];
+					}
+				});
 
-			VertexInstanceBaseIndex += NumVertexInstancesPerSection;
-			VertexBaseIndex += Primitive.bHasIndices ? Primitive.Positions.Num() : Primitive.Indices.Num();
+			FglTFRuntimeMeshOptimizationStats LODStats;
+			for (const FglTFRuntimeMeshOptimizationStats& SectionStats : SectionsStats)
+			{
+				LODStats.Append(SectionStats);
+			}
+			AddMeshOptimizationStats(LODStats);
 		}
 
 		// this is way more fast than doing it in the ParalellFor with a lock
@@ -963,12 +919,9 @@ UStaticMesh* FglTFRuntimeParser::FinalizeStaticMesh(TSharedRef<FglTFRuntimeStati
 	StaticMesh->InitResources();
 
 	// set default LODs screen sizes
-	float DeltaScreenSize = (1.0f / RenderData->LODResources.Num()) / StaticMeshConfig.LODScreenSizeMultiplier;
-	float ScreenSize = 1;
 	for (int32 LODIndex = 0; LODIndex < RenderData->LODResources.Num(); LODIndex++)
 	{
-		RenderData->ScreenSize[LODIndex].Default = ScreenSize;
-		ScreenSize -= DeltaScreenSize;
+		RenderData->ScreenSize[LODIndex].Default = glTFRuntime::GetDefaultLODScreenSize(LODIndex, RenderData->LODResources.Num(), StaticMeshConfig.LODScreenSizeMultiplier);
 	}
 
 	// Override LODs ScreenSize
@@ -1119,25 +1072,45 @@ bool FglTFRuntimeParser::LoadStaticMeshes(TArray<UStaticMesh*>& StaticMeshes, co
 	return true;
 }
 
-bool FglTFRuntimeParser::LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObject, FglTFRuntimeMeshLOD*& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
+bool FglTFRuntimeParser::LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObject, TSharedPtr<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe>& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig, FglTFRuntimeLoadHandlePtr LoadHandle)
 {
-	if (LODsCache.Contains(JsonMeshObject))
 	{
-		LOD = &LODsCache[JsonMeshObject];
-		return true;
+		FScopeLock Lock(&CachesLock);
+		if (TSharedRef<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe>* CachedLOD = LODsCache.Find(JsonMeshObject))
+		{
+			LOD = *CachedLOD;
+			TouchCacheEntry(LODsCacheEntries, JsonMeshObject);
+			return true;
+		}
 	}
 
 	TArray<FglTFRuntimePrimitive> Primitives;
-	if (!LoadPrimitives(JsonMeshObject, Primitives, MaterialsConfig, true))
+	if (!LoadPrimitives(JsonMeshObject, Primitives, MaterialsConfig, true, LoadHandle))
 	{
 		return false;
 	}
 
-	FglTFRuntimeMeshLOD NewLOD;
-	NewLOD.Primitives = MoveTemp(Primitives);
+	TSharedRef<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe> NewLOD = MakeShared<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe>();
+	NewLOD->Primitives = MoveTemp(Primitives);
 
-	FglTFRuntimeMeshLOD& CachedLOD = LODsCache.Add(JsonMeshObject, MoveTemp(NewLOD));
-	LOD = &CachedLOD;
+	FScopeLock Lock(&CachesLock);
+	// another thread could have loaded the same mesh in the meantime
+	if (TSharedRef<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe>* CachedLOD = LODsCache.Find(JsonMeshObject))
+	{
+		NewLOD = *CachedLOD;
+	}
+	else
+	{
+		LODsCache.Add(JsonMeshObject, NewLOD);
+		int64 Bytes = 0;
+		for (const FglTFRuntimePrimitive& Primitive : NewLOD->Primitives)
+		{
+			Bytes += Primitive.GetAllocatedSize();
+		}
+		AddCacheEntry(LODsCacheEntries, JsonMeshObject, EglTFRuntimeCacheKind::LODs, Bytes);
+	}
+	TouchCacheEntry(LODsCacheEntries, JsonMeshObject);
+	LOD = NewLOD;
 	return true;
 }
 
@@ -1150,18 +1123,21 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh(const int32 MeshIndex, const Fgl
 		return nullptr;
 	}
 
-	if (CanReadFromCache(StaticMeshConfig.CacheMode) && StaticMeshesCache.Contains(MeshIndex))
+	if (CanReadFromCache(StaticMeshConfig.CacheMode))
 	{
-		return StaticMeshesCache[MeshIndex];
+		if (UStaticMesh* CachedStaticMesh = FindInObjectsCache<UStaticMesh>(StaticMeshesCache, MeshIndex))
+		{
+			return CachedStaticMesh;
+		}
 	}
 
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), MeshIndex, StaticMeshConfig);
-	FglTFRuntimeMeshLOD* LOD = nullptr;
+	TSharedPtr<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe> LOD;
 	if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig))
 	{
 		return nullptr;
 	}
-	StaticMeshContext->LODs.Add(LOD);
+	StaticMeshContext->AddCachedLOD(LOD.ToSharedRef());
 
 	UStaticMesh* StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
 	if (!StaticMesh)
@@ -1177,7 +1153,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh(const int32 MeshIndex, const Fgl
 
 	if (CanWriteToCache(StaticMeshConfig.CacheMode))
 	{
-		StaticMeshesCache.Add(MeshIndex, StaticMesh);
+		AddToObjectsCache(StaticMeshesCache, MeshIndex, StaticMesh);
 	}
 
 	return StaticMesh;
@@ -1193,7 +1169,7 @@ TArray<UStaticMesh*> FglTFRuntimeParser::LoadStaticMeshesFromPrimitives(const in
 		return StaticMeshes;
 	}
 
-	FglTFRuntimeMeshLOD* LOD = nullptr;
+	TSharedPtr<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe> LOD;
 	if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig))
 	{
 		return StaticMeshes;
@@ -1239,14 +1215,14 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMeshLODs(const TArray<int32>& MeshInd
 			return nullptr;
 		}
 
-		FglTFRuntimeMeshLOD* LOD = nullptr;
+		TSharedPtr<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe> LOD;
 
 		if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig))
 		{
 			return nullptr;
 		}
 
-		StaticMeshContext->LODs.Add(LOD);
+		StaticMeshContext->AddCachedLOD(LOD.ToSharedRef());
 	}
 
 	UStaticMesh* StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
@@ -1273,7 +1249,7 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndice
 					break;
 				}
 
-				FglTFRuntimeMeshLOD* LOD = nullptr;
+				TSharedPtr<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe> LOD;
 
 				if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshContext->StaticMeshConfig.MaterialsConfig))
 				{
@@ -1281,7 +1257,7 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndice
 					break;
 				}
 
-				StaticMeshContext->LODs.Add(LOD);
+				StaticMeshContext->AddCachedLOD(LOD.ToSharedRef());
 			}
 
 			if (bSuccess)
@@ -1289,7 +1265,7 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndice
 				StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
 			}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
+			FGraphEventRef Task = FglTFRuntimeGameThreadQueue::Get().Enqueue([StaticMeshContext, AsyncCallback]()
 				{
 					if (StaticMeshContext->StaticMesh)
 					{
@@ -1301,7 +1277,7 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndice
 					// this is ugly, but we need to avoid at all costs to have the FGCObject dtor to be run out of the game thread
 					StaticMeshContext->UnregisterGCObject();
 #endif
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
+				}, StaticMeshContext->StaticMeshConfig.GameThreadPriority);
 			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 		});
 }
@@ -1330,6 +1306,9 @@ bool FglTFRuntimeParser::LoadStaticMeshIntoProceduralMeshComponent(const int32 M
 	int32 SectionIndex = ProceduralMeshComponent->GetNumSections();
 	for (FglTFRuntimePrimitive& Primitive : Primitives)
 	{
+		// procedural mesh sections take double precision arrays
+		Primitive.ExpandCompactVertexData();
+
 		TArray<FVector2D> UV;
 		if (Primitive.UVs.Num() > 0)
 		{
@@ -1447,7 +1426,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMeshRecursive(const FString& NodeName
 				return nullptr;
 			}
 
-			FglTFRuntimeMeshLOD* LOD = nullptr;
+			TSharedPtr<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe> LOD;
 			if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig))
 			{
 				return nullptr;
@@ -1488,14 +1467,62 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMeshRecursive(const FString& NodeName
 	return FinalizeStaticMesh(StaticMeshContext);
 }
 
-void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, const TArray<FString>& ExcludeNodes, const FglTFRuntimeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig)
+// runs the game thread part of an async static mesh load when leaving the worker thread scope (even on errors)
+struct FglTFRuntimeStaticMeshContextFinalizer
 {
+	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext;
+	FglTFRuntimeStaticMeshAsync AsyncCallback;
+	FglTFRuntimeLoadHandleRef LoadHandle;
+	// set once the worker thread part has run, the context mesh is otherwise discarded
+	bool bBuilt = false;
+
+	FglTFRuntimeStaticMeshContextFinalizer(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> InStaticMeshContext, FglTFRuntimeStaticMeshAsync InAsyncCallback, FglTFRuntimeLoadHandleRef InLoadHandle) :
+		StaticMeshContext(InStaticMeshContext),
+		AsyncCallback(InAsyncCallback),
+		LoadHandle(InLoadHandle)
+	{
+	}
 
-	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), -1, StaticMeshConfig);
+	~FglTFRuntimeStaticMeshContextFinalizer()
+	{
+		FGraphEventRef Task = FglTFRuntimeGameThreadQueue::Get().Enqueue([this]()
+			{
+				if (!bBuilt || LoadHandle->IsCancelled())
+				{
+					StaticMeshContext->StaticMesh = nullptr;
+				}
+				if (StaticMeshContext->StaticMesh)
+				{
+					StaticMeshContext->StaticMesh = StaticMeshContext->Parser->FinalizeStaticMesh(StaticMeshContext);
+				}
+				LoadHandle->Complete();
+				AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2) || ENGINE_MAJOR_VERSION > 5
+				// this is ugly, but we need to avoid at all costs to have the FGCObject dtor to be run out of the game thread
+				StaticMeshContext->UnregisterGCObject();
+#endif
+			}, LoadHandle);
+		FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+	}
+};
 
+FglTFRuntimeLoadHandleRef FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, const TArray<FString>& ExcludeNodes, const FglTFRuntimeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig)
+{
+	FglTFRuntimeLoadHandleRef LoadHandle = MakeShared<FglTFRuntimeLoadHandle, ESPMode::ThreadSafe>(StaticMeshConfig.GameThreadPriority);
+
+	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), -1, StaticMeshConfig);
+	StaticMeshContext->LoadHandle = LoadHandle;
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, StaticMeshConfig, ExcludeNodes, NodeName, AsyncCallback]()
+	Async(EAsyncExecution::Thread, [this, StaticMeshContext, StaticMeshConfig, ExcludeNodes, NodeName, AsyncCallback, LoadHandle]()
 		{
+			// the combined LOD is owned by the context, as the finalizer requires LOD access
+			TSharedRef<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe> CombinedLOD = MakeShared<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe>();
+			FglTFRuntimeStaticMeshContextFinalizer AsyncFinalizer(StaticMeshContext, AsyncCallback, LoadHandle);
+
+			if (LoadHandle->IsCancelled())
+			{
+				return;
+			}
 
 			FglTFRuntimeNode Node;
 			TArray<FglTFRuntimeNode> Nodes;
@@ -1533,10 +1560,15 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 				}
 			}
 
-			FglTFRuntimeMeshLOD CombinedLOD;
-
-			for (FglTFRuntimeNode& ChildNode : Nodes)
+			for (int32 ChildNodeIndex = 0; ChildNodeIndex < Nodes.Num(); ChildNodeIndex++)
 			{
+				FglTFRuntimeNode& ChildNode = Nodes[ChildNodeIndex];
+				LoadHandle->SetStageProgress(0, 0.5f, ChildNodeIndex, Nodes.Num());
+				if (LoadHandle->IsCancelled())
+				{
+					return;
+				}
+
 				if (ExcludeNodes.Contains(ChildNode.Name))
 				{
 					continue;
@@ -1550,8 +1582,8 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 						return;
 					}
 
-					FglTFRuntimeMeshLOD* LOD = nullptr;
-					if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig))
+					TSharedPtr<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe> LOD;
+					if (!LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, StaticMeshConfig.MaterialsConfig, LoadHandle))
 					{
 						return;
 					}
@@ -1570,8 +1602,8 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 
 					for (const FglTFRuntimePrimitive& Primitive : LOD->Primitives)
 					{
-						CombinedLOD.Primitives.Add(Primitive);
-						CombinedLOD.AdditionalTransforms.Add(AdditionalTransform);
+						CombinedLOD->Primitives.Add(Primitive);
+						CombinedLOD->AdditionalTransforms.Add(AdditionalTransform);
 						if (!ChildNode.Name.IsEmpty())
 						{
 							StaticMeshContext->AdditionalSockets.Add(ChildNode.Name, AdditionalTransform);
@@ -1580,25 +1612,21 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 				}
 			}
 
-			StaticMeshContext->LODs.Add(&CombinedLOD);
+			LoadHandle->SetProgress(0.5f);
 
-			StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
+			if (LoadHandle->IsCancelled())
+			{
+				return;
+			}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
-				{
-					if (StaticMeshContext->StaticMesh)
-					{
-						StaticMeshContext->StaticMesh = StaticMeshContext->Parser->FinalizeStaticMesh(StaticMeshContext);
-					}
+			StaticMeshContext->AddCachedLOD(CombinedLOD);
 
-					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
-#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2) || ENGINE_MAJOR_VERSION > 5
-					// this is ugly, but we need to avoid at all costs to have the FGCObject dtor to be run out of the game thread
-					StaticMeshContext->UnregisterGCObject();
-#endif
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+			StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
+			AsyncFinalizer.bBuilt = true;
+			LoadHandle->SetProgress(0.9f);
 		});
+
+	return LoadHandle;
 }
 
 bool FglTFRuntimeParser::LoadMeshAsRuntimeLOD(const int32 MeshIndex, FglTFRuntimeMeshLOD& RuntimeLOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
@@ -1609,10 +1637,11 @@ bool FglTFRuntimeParser::LoadMeshAsRuntimeLOD(const int32 MeshIndex, FglTFRuntim
 		return false;
 	}
 
-	FglTFRuntimeMeshLOD* LOD;
+	TSharedPtr<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe> LOD;
 	if (LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, MaterialsConfig))
 	{
-		RuntimeLOD = MoveTemp(*LOD);
+		// the cached LOD can be shared with other loads
+		RuntimeLOD = *LOD;
 		return true;
 	}
 
@@ -1650,7 +1679,7 @@ void FglTFRuntimeParser::LoadStaticMeshFromRuntimeLODsAsync(const TArray<FglTFRu
 
 			StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
+			FGraphEventRef Task = FglTFRuntimeGameThreadQueue::Get().Enqueue([StaticMeshContext, AsyncCallback]()
 				{
 					if (StaticMeshContext->StaticMesh)
 					{
@@ -1662,7 +1691,7 @@ void FglTFRuntimeParser::LoadStaticMeshFromRuntimeLODsAsync(const TArray<FglTFRu
 					// this is ugly, but we need to avoid at all costs to have the FGCObject dtor to be run out of the game thread
 					StaticMeshContext->UnregisterGCObject();
 #endif
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
+				}, StaticMeshContext->StaticMeshConfig.GameThreadPriority);
 			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 		}
 	);
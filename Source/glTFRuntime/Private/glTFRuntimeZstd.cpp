@@ -0,0 +1,1372 @@
+// Copyright 2026 - Roberto De Ioris
+
+#include "glTFRuntimeParser.h"
+
+/*
+* Zstandard (RFC 8878) frames decoder.
+* Like the LZ4 one, it is implemented here to avoid messing with engine third party modules.
+* Dictionaries are not supported and content checksums are skipped.
+*/
+namespace glTFRuntime
+{
+	namespace Zstd
+	{
+		constexpr uint32 FrameMagic = 0xFD2FB528;
+		constexpr uint32 SkippableMagic = 0x184D2A50;
+		constexpr uint32 SkippableMagicMask = 0xFFFFFFF0;
+		constexpr uint32 SeekTableMagic = 0x184D2A5E;
+		constexpr uint32 SeekableMagic = 0x8F92EAB1;
+		constexpr int64 MaxBlockSize = 128 * 1024;
+
+		constexpr int32 MaxLiteralsLengthCode = 35;
+		constexpr int32 MaxMatchLengthCode = 52;
+		constexpr int32 MaxOffsetCode = 31;
+
+		static const uint32 LiteralsLengthBase[MaxLiteralsLengthCode + 1] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 18, 20, 22, 24, 28, 32, 40, 48, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768, 65536 };
+		static const uint8 LiteralsLengthBits[MaxLiteralsLengthCode + 1] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 3, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+		static const uint32 MatchLengthBase[MaxMatchLengthCode + 1] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 37, 39, 41, 43, 47, 51, 59, 67, 83, 99, 131, 259, 515, 1027, 2051, 4099, 8195, 16387, 32771, 65539 };
+		static const uint8 MatchLengthBits[MaxMatchLengthCode + 1] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 3, 4, 4, 5, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+		static const int16 DefaultLiteralsLengthDistribution[36] = { 4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 1, 1, 1, 1, 1, -1, -1, -1, -1 };
+		static const int16 DefaultMatchLengthDistribution[53] = { 1, 4, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1, -1 };
+		static const int16 DefaultOffsetDistribution[29] = { 1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1 };
+
+		template<typename T>
+		T ReadLE(const uint8* DataPtr)
+		{
+			T Value;
+			FMemory::Memcpy(&Value, DataPtr, sizeof(T));
+			return Value;
+		}
+
+		int32 HighestBit(const uint64 Value)
+		{
+			return Value ? static_cast<int32>(FMath::FloorLog2_64(Value)) : -1;
+		}
+
+		FORCEINLINE uint64 LowBitsMask(const int64 Bits)
+		{
+			return (static_cast<uint64>(1) << Bits) - 1;
+		}
+
+		// little endian 64 bit word starting at ByteIndex, bytes past Num read as zeros
+		FORCEINLINE uint64 LoadWord(const uint8* Data, const int64 Num, const int64 ByteIndex)
+		{
+			if (ByteIndex + 8 <= Num)
+			{
+				return ReadLE<uint64>(Data + ByteIndex);
+			}
+
+			uint64 Word = 0;
+			FMemory::Memcpy(&Word, Data + ByteIndex, Num - ByteIndex);
+			return Word;
+		}
+
+		// FSE table descriptions are read from the start of the stream
+		struct FForwardBitReader
+		{
+			const uint8* Data;
+			int64 Num;
+			int64 BitOffset;
+
+			FForwardBitReader(const uint8* InData, const int64 InNum) : Data(InData), Num(InNum), BitOffset(0)
+			{
+			}
+
+			// Bits is at most 32 (a byte aligned word always covers it)
+			bool Read(const int32 Bits, uint32& Value)
+			{
+				if (BitOffset + Bits > Num * 8)
+				{
+					return false;
+				}
+
+				Value = static_cast<uint32>((LoadWord(Data, Num, BitOffset >> 3) >> (BitOffset & 7)) & LowBitsMask(Bits));
+				BitOffset += Bits;
+				return true;
+			}
+
+			int64 GetAlignedBytes() const
+			{
+				return (BitOffset + 7) / 8;
+			}
+		};
+
+		// entropy coded streams are read from the end, the highest bit of the last byte is a marker
+		struct FBackwardBitReader
+		{
+			const uint8* Data;
+			int64 Num;
+			int64 BitOffset;
+
+			FBackwardBitReader() : Data(nullptr), Num(0), BitOffset(0)
+			{
+			}
+
+			bool Init(const uint8* InData, const int64 InNum)
+			{
+				if (InNum <= 0 || InData[InNum - 1] == 0)
+				{
+					return false;
+				}
+
+				Data = InData;
+				Num = InNum;
+				BitOffset = (InNum - 1) * 8 + HighestBit(InData[InNum - 1]);
+				return true;
+			}
+
+			// Bits is at most 56, every read is a single word load.
+			// reading before the start of the stream returns zeros (BitOffset goes negative)
+			uint64 Read(const int32 Bits)
+			{
+				BitOffset -= Bits;
+
+				if (BitOffset >= 0)
+				{
+					return (LoadWord(Data, Num, BitOffset >> 3) >> (BitOffset & 7)) & LowBitsMask(Bits);
+				}
+
+				const int64 Available = BitOffset + Bits;
+				if (Available <= 0)
+				{
+					return 0;
+				}
+
+				return (LoadWord(Data, Num, 0) & LowBitsMask(Available)) << -BitOffset;
+			}
+
+			bool IsOverflow() const
+			{
+				return BitOffset < 0;
+			}
+		};
+
+		struct FFseTable
+		{
+			int32 AccuracyLog;
+			TArray<uint8> Symbols;
+			TArray<uint8> NumBits;
+			TArray<uint16> NewStateBase;
+
+			FFseTable() : AccuracyLog(-1)
+			{
+			}
+
+			bool IsValid() const
+			{
+				return AccuracyLog >= 0;
+			}
+
+			bool Build(const int16* Frequencies, const int32 NumSymbols, const int32 InAccuracyLog)
+			{
+				const int32 Size = 1 << InAccuracyLog;
+				AccuracyLog = -1;
+				Symbols.SetNumZeroed(Size);
+				NumBits.SetNumZeroed(Size);
+				NewStateBase.SetNumZeroed(Size);
+
+				TArray<uint16> StatesDesc;
+				StatesDesc.SetNumZeroed(NumSymbols);
+
+				// "less than 1" probabilities are placed at the end of the table
+				int32 HighThreshold = Size;
+				for (int32 Symbol = 0; Symbol < NumSymbols; Symbol++)
+				{
+					if (Frequencies[Symbol] == -1)
+					{
+						if (HighThreshold <= 0)
+						{
+							return false;
+						}
+						Symbols[--HighThreshold] = static_cast<uint8>(Symbol);
+						StatesDesc[Symbol] = 1;
+					}
+				}
+
+				const int32 Step = (Size >> 1) + (Size >> 3) + 3;
+				const int32 Mask = Size - 1;
+				int32 Position = 0;
+				for (int32 Symbol = 0; Symbol < NumSymbols; Symbol++)
+				{
+					if (Frequencies[Symbol] <= 0)
+					{
+						continue;
+					}
+
+					StatesDesc[Symbol] = Frequencies[Symbol];
+					for (int32 Index = 0; Index < Frequencies[Symbol]; Index++)
+					{
+						Symbols[Position] = static_cast<uint8>(Symbol);
+						do
+						{
+							Position = (Position + Step) & Mask;
+						} while (Position >= HighThreshold);
+					}
+				}
+
+				if (Position != 0)
+				{
+					return false;
+				}
+
+				for (int32 State = 0; State < Size; State++)
+				{
+					const uint16 NextStateDesc = StatesDesc[Symbols[State]]++;
+					NumBits[State] = static_cast<uint8>(InAccuracyLog - HighestBit(NextStateDesc));
+					NewStateBase[State] = static_cast<uint16>((NextStateDesc << NumBits[State]) - Size);
+				}
+
+				AccuracyLog = InAccuracyLog;
+				return true;
+			}
+
+			void BuildRle(const uint8 Symbol)
+			{
+				AccuracyLog = 0;
+				Symbols = { Symbol };
+				NumBits = { 0 };
+				NewStateBase = { 0 };
+			}
+		};
+
+		struct FFseState
+		{
+			const FFseTable& Table;
+			uint32 State;
+
+			FFseState(const FFseTable& InTable) : Table(InTable), State(0)
+			{
+			}
+
+			void Init(FBackwardBitReader& BitReader)
+			{
+				State = static_cast<uint32>(BitReader.Read(Table.AccuracyLog));
+			}
+
+			uint8 Peek() const
+			{
+				return Table.Symbols[State];
+			}
+
+			void Update(FBackwardBitReader& BitReader)
+			{
+				State = Table.NewStateBase[State] + static_cast<uint32>(BitReader.Read(Table.NumBits[State]));
+			}
+		};
+
+		bool ReadFseTable(const uint8* Data, const int64 Num, const int32 MaxAccuracyLog, const int32 MaxSymbols, FFseTable& Table, int64& BytesRead)
+		{
+			FForwardBitReader BitReader(Data, Num);
+
+			uint32 Value = 0;
+			if (!BitReader.Read(4, Value))
+			{
+				return false;
+			}
+
+			const int32 AccuracyLog = static_cast<int32>(Value) + 5;
+			if (AccuracyLog > MaxAccuracyLog)
+			{
+				return false;
+			}
+
+			TArray<int16> Frequencies;
+			Frequencies.SetNumZeroed(MaxSymbols);
+
+			int32 Remaining = 1 << AccuracyLog;
+			int32 Symbol = 0;
+			while (Remaining > 0 && Symbol < MaxSymbols)
+			{
+				const int32 Bits = HighestBit(Remaining + 1) + 1;
+				if (!BitReader.Read(Bits, Value))
+				{
+					return false;
+				}
+
+				const uint32 LowerMask = (1u << (Bits - 1)) - 1;
+				const uint32 Threshold = (1u << Bits) - 1 - (Remaining + 1);
+				if ((Value & LowerMask) < Threshold)
+				{
+					BitReader.BitOffset--;
+					Value &= LowerMask;
+				}
+				else if (Value > LowerMask)
+				{
+					Value -= Threshold;
+				}
+
+				const int32 Probability = static_cast<int32>(Value) - 1;
+				Remaining -= Probability < 0 ? -Probability : Probability;
+				Frequencies[Symbol++] = static_cast<int16>(Probability);
+
+				// zero probabilities are followed by 2 bits repeat flags
+				if (Probability == 0)
+				{
+					uint32 Repeat = 0;
+					do
+					{
+						if (!BitReader.Read(2, Repeat))
+						{
+							return false;
+						}
+						for (uint32 RepeatIndex = 0; RepeatIndex < Repeat && Symbol < MaxSymbols; RepeatIndex++)
+						{
+							Frequencies[Symbol++] = 0;
+						}
+					} while (Repeat == 3);
+				}
+			}
+
+			if (Remaining != 0)
+			{
+				return false;
+			}
+
+			BytesRead = BitReader.GetAlignedBytes();
+			return Table.Build(Frequencies.GetData(), Symbol, AccuracyLog);
+		}
+
+		struct FHuffmanTable
+		{
+			int32 MaxBits;
+			TArray<uint8> Symbols;
+			TArray<uint8> NumBits;
+
+			FHuffmanTable() : MaxBits(0)
+			{
+			}
+
+			bool IsValid() const
+			{
+				return MaxBits > 0;
+			}
+
+			bool Build(uint8* Weights, int32 NumWeights)
+			{
+				MaxBits = 0;
+
+				uint32 Total = 0;
+				for (int32 WeightIndex = 0; WeightIndex < NumWeights; WeightIndex++)
+				{
+					if (Weights[WeightIndex] > 11)
+					{
+						return false;
+					}
+					if (Weights[WeightIndex] > 0)
+					{
+						Total += 1u << (Weights[WeightIndex] - 1);
+					}
+				}
+
+				if (Total == 0)
+				{
+					return false;
+				}
+
+				// the weight of the last symbol is implied by the others
+				const int32 TableBits = HighestBit(Total) + 1;
+				const uint32 Left = (1u << TableBits) - Total;
+				if (TableBits > 11 || (Left & (Left - 1)) != 0)
+				{
+					return false;
+				}
+				Weights[NumWeights++] = static_cast<uint8>(HighestBit(Left) + 1);
+
+				int32 RankCount[13] = {};
+				uint8 SymbolsBits[256] = {};
+				for (int32 Symbol = 0; Symbol < NumWeights; Symbol++)
+				{
+					SymbolsBits[Symbol] = Weights[Symbol] > 0 ? static_cast<uint8>(TableBits + 1 - Weights[Symbol]) : 0;
+					RankCount[SymbolsBits[Symbol]]++;
+				}
+
+				// longest codes come first
+				int32 RankIndex[13] = {};
+				for (int32 Bits = TableBits; Bits >= 1; Bits--)
+				{
+					RankIndex[Bits - 1] = RankIndex[Bits] + RankCount[Bits] * (1 << (TableBits - Bits));
+				}
+
+				Symbols.SetNumZeroed(1 << TableBits);
+				NumBits.SetNumZeroed(1 << TableBits);
+
+				for (int32 Symbol = 0; Symbol < NumWeights; Symbol++)
+				{
+					const uint8 Bits = SymbolsBits[Symbol];
+					if (Bits == 0)
+					{
+						continue;
+					}
+
+					const int32 Code = RankIndex[Bits];
+					const int32 Length = 1 << (TableBits - Bits);
+					for (int32 Index = Code; Index < Code + Length; Index++)
+					{
+						Symbols[Index] = static_cast<uint8>(Symbol);
+						NumBits[Index] = Bits;
+					}
+					RankIndex[Bits] += Length;
+				}
+
+				MaxBits = TableBits;
+				return true;
+			}
+
+			bool DecodeStream(const uint8* Data, const int64 Num, uint8* Output, const int64 OutputNum) const
+			{
+				FBackwardBitReader BitReader;
+				if (!BitReader.Init(Data, Num))
+				{
+					return false;
+				}
+
+				const uint32 Mask = (1u << MaxBits) - 1;
+				uint32 State = static_cast<uint32>(BitReader.Read(MaxBits));
+				for (int64 Index = 0; Index < OutputNum; Index++)
+				{
+					Output[Index] = Symbols[State];
+					const uint8 Bits = NumBits[State];
+					State = ((State << Bits) + static_cast<uint32>(BitReader.Read(Bits))) & Mask;
+				}
+
+				// the stream must be consumed exactly
+				return BitReader.BitOffset == -MaxBits;
+			}
+		};
+
+		bool ReadHuffmanTable(const uint8* Data, const int64 Num, FHuffmanTable& Table, int64& BytesRead)
+		{
+			if (Num < 1)
+			{
+				return false;
+			}
+
+			// one more slot for the implied last weight
+			uint8 Weights[257] = {};
+			int32 NumWeights = 0;
+
+			const uint8 Header = Data[0];
+			// direct representation, 4 bits per weight
+			if (Header >= 128)
+			{
+				NumWeights = Header - 127;
+				const int64 WeightsBytes = (NumWeights + 1) / 2;
+				if (1 + WeightsBytes > Num)
+				{
+					return false;
+				}
+
+				for (int32 WeightIndex = 0; WeightIndex < NumWeights; WeightIndex++)
+				{
+					const uint8 Byte = Data[1 + WeightIndex / 2];
+					Weights[WeightIndex] = (WeightIndex % 2) == 0 ? (Byte >> 4) : (Byte & 0x0F);
+				}
+
+				BytesRead = 1 + WeightsBytes;
+			}
+			// fse compressed weights
+			else
+			{
+				const int64 CompressedSize = Header;
+				if (CompressedSize == 0 || 1 + CompressedSize > Num)
+				{
+					return false;
+				}
+
+				FFseTable WeightsTable;
+				int64 TableBytes = 0;
+				if (!ReadFseTable(Data + 1, CompressedSize, 6, 256, WeightsTable, TableBytes))
+				{
+					return false;
+				}
+
+				FBackwardBitReader BitReader;
+				if (!BitReader.Init(Data + 1 + TableBytes, CompressedSize - TableBytes))
+				{
+					return false;
+				}
+
+				// two interleaved states
+				FFseState State1(WeightsTable);
+				FFseState State2(WeightsTable);
+				State1.Init(BitReader);
+				State2.Init(BitReader);
+
+				while (true)
+				{
+					if (NumWeights >= 254)
+					{
+						return false;
+					}
+
+					Weights[NumWeights++] = State1.Peek();
+					State1.Update(BitReader);
+					if (BitReader.IsOverflow())
+					{
+						Weights[NumWeights++] = State2.Peek();
+						break;
+					}
+
+					Weights[NumWeights++] = State2.Peek();
+					State2.Update(BitReader);
+					if (BitReader.IsOverflow())
+					{
+						Weights[NumWeights++] = State1.Peek();
+						break;
+					}
+				}
+
+				BytesRead = 1 + CompressedSize;
+			}
+
+			return Table.Build(Weights, NumWeights);
+		}
+
+		struct FOutput
+		{
+			uint8* Data;
+			int64 Num;
+			int64 Capacity;
+			// growable outputs (sequential decoding) are bound by MaxNum
+			TArray64<uint8>* Array;
+			int64 MaxNum;
+			bool bMaxNumReached;
+
+			bool Reserve(const int64 Size, uint8*& Destination)
+			{
+				if (Num + Size > Capacity)
+				{
+					if (!Array || Num + Size > MaxNum)
+					{
+						bMaxNumReached = Array != nullptr;
+						return false;
+					}
+
+					Array->SetNumUninitialized(FMath::Min(FMath::Max(Num + Size, Capacity * 2), MaxNum));
+					Data = Array->GetData();
+					Capacity = Array->Num();
+				}
+
+				Destination = Data + Num;
+				return true;
+			}
+		};
+
+		struct FSequence
+		{
+			uint32 LiteralsLength;
+			uint32 MatchLength;
+			uint32 OffsetValue;
+		};
+
+		struct FFrameState
+		{
+			FHuffmanTable HuffmanTable;
+			FFseTable LiteralsLengthTable;
+			FFseTable OffsetTable;
+			FFseTable MatchLengthTable;
+			uint32 RepeatOffsets[3];
+			// where the frame starts in the output (matches cannot go before it)
+			int64 OutputStart;
+
+			TArray64<uint8> Literals;
+			TArray<FSequence> Sequences;
+
+			FFrameState(const int64 InOutputStart) : OutputStart(InOutputStart)
+			{
+				RepeatOffsets[0] = 1;
+				RepeatOffsets[1] = 4;
+				RepeatOffsets[2] = 8;
+			}
+		};
+
+		bool DecodeLiterals(const uint8* Data, const int64 Num, FFrameState& FrameState, int64& BytesRead)
+		{
+			if (Num < 1)
+			{
+				return false;
+			}
+
+			const uint8 BlockType = Data[0] & 0x03;
+			const uint8 SizeFormat = (Data[0] >> 2) & 0x03;
+
+			// raw or rle
+			if (BlockType < 2)
+			{
+				int64 HeaderSize = 1;
+				int64 RegeneratedSize = Data[0] >> 3;
+				if (SizeFormat == 1)
+				{
+					HeaderSize = 2;
+				}
+				else if (SizeFormat == 3)
+				{
+					HeaderSize = 3;
+				}
+
+				if (HeaderSize > Num)
+				{
+					return false;
+				}
+
+				if (SizeFormat == 1)
+				{
+					RegeneratedSize = (Data[0] >> 4) + (Data[1] << 4);
+				}
+				else if (SizeFormat == 3)
+				{
+					RegeneratedSize = (Data[0] >> 4) + (Data[1] << 4) + (Data[2] << 12);
+				}
+
+				if (RegeneratedSize > MaxBlockSize)
+				{
+					return false;
+				}
+
+				FrameState.Literals.SetNumUninitialized(RegeneratedSize);
+
+				if (BlockType == 0)
+				{
+					if (HeaderSize + RegeneratedSize > Num)
+					{
+						return false;
+					}
+					FMemory::Memcpy(FrameState.Literals.GetData(), Data + HeaderSize, RegeneratedSize);
+					BytesRead = HeaderSize + RegeneratedSize;
+				}
+				else
+				{
+					if (HeaderSize + 1 > Num)
+					{
+						return false;
+					}
+					FMemory::Memset(FrameState.Literals.GetData(), Data[HeaderSize], RegeneratedSize);
+					BytesRead = HeaderSize + 1;
+				}
+
+				return true;
+			}
+
+			// huffman compressed (with a new or the previous table)
+			const int32 NumStreams = SizeFormat == 0 ? 1 : 4;
+			const int64 HeaderSize = SizeFormat < 2 ? 3 : SizeFormat + 2;
+			const int32 SizeBits = SizeFormat < 2 ? 10 : (SizeFormat == 2 ? 14 : 18);
+			if (HeaderSize > Num)
+			{
+				return false;
+			}
+
+			uint64 Header = 0;
+			for (int64 HeaderIndex = 0; HeaderIndex < HeaderSize; HeaderIndex++)
+			{
+				Header |= static_cast<uint64>(Data[HeaderIndex]) << (HeaderIndex * 8);
+			}
+
+			const uint64 SizeMask = (static_cast<uint64>(1) << SizeBits) - 1;
+			const int64 RegeneratedSize = static_cast<int64>((Header >> 4) & SizeMask);
+			const int64 CompressedSize = static_cast<int64>((Header >> (4 + SizeBits)) & SizeMask);
+
+			if (RegeneratedSize > MaxBlockSize || HeaderSize + CompressedSize > Num)
+			{
+				return false;
+			}
+
+			const uint8* StreamsData = Data + HeaderSize;
+			int64 StreamsSize = CompressedSize;
+
+			if (BlockType == 2)
+			{
+				int64 TreeBytes = 0;
+				if (!ReadHuffmanTable(StreamsData, StreamsSize, FrameState.HuffmanTable, TreeBytes))
+				{
+					return false;
+				}
+				StreamsData += TreeBytes;
+				StreamsSize -= TreeBytes;
+			}
+			else if (!FrameState.HuffmanTable.IsValid())
+			{
+				return false;
+			}
+
+			FrameState.Literals.SetNumUninitialized(RegeneratedSize);
+
+			if (NumStreams == 1)
+			{
+				if (!FrameState.HuffmanTable.DecodeStream(StreamsData, StreamsSize, FrameState.Literals.GetData(), RegeneratedSize))
+				{
+					return false;
+				}
+			}
+			else
+			{
+				if (StreamsSize < 6)
+				{
+					return false;
+				}
+
+				int64 StreamsSizes[4];
+				StreamsSizes[0] = ReadLE<uint16>(StreamsData);
+				StreamsSizes[1] = ReadLE<uint16>(StreamsData + 2);
+				StreamsSizes[2] = ReadLE<uint16>(StreamsData + 4);
+				StreamsSizes[3] = StreamsSize - 6 - StreamsSizes[0] - StreamsSizes[1] - StreamsSizes[2];
+
+				const int64 SegmentSize = (RegeneratedSize + 3) / 4;
+				if (StreamsSizes[3] < 1 || RegeneratedSize - SegmentSize * 3 < 0)
+				{
+					return false;
+				}
+
+				const uint8* StreamData = StreamsData + 6;
+				for (int32 StreamIndex = 0; StreamIndex < 4; StreamIndex++)
+				{
+					const int64 OutputOffset = SegmentSize * StreamIndex;
+					const int64 OutputSize = StreamIndex < 3 ? SegmentSize : RegeneratedSize - SegmentSize * 3;
+					if (!FrameState.HuffmanTable.DecodeStream(StreamData, StreamsSizes[StreamIndex], FrameState.Literals.GetData() + OutputOffset, OutputSize))
+					{
+						return false;
+					}
+					StreamData += StreamsSizes[StreamIndex];
+				}
+			}
+
+			BytesRead = HeaderSize + CompressedSize;
+			return true;
+		}
+
+		bool ReadSequencesTable(const uint8* Data, const int64 Num, int64& Position, const uint8 Mode, const int16* DefaultDistribution, const int32 DefaultNumSymbols, const int32 DefaultAccuracyLog, const int32 MaxAccuracyLog, const int32 MaxCode, FFseTable& Table)
+		{
+			// predefined
+			if (Mode == 0)
+			{
+				return Table.Build(DefaultDistribution, DefaultNumSymbols, DefaultAccuracyLog);
+			}
+			// rle
+			else if (Mode == 1)
+			{
+				if (Position >= Num || Data[Position] > MaxCode)
+				{
+					return false;
+				}
+				Table.BuildRle(Data[Position++]);
+				return true;
+			}
+			// fse compressed
+			else if (Mode == 2)
+			{
+				int64 TableBytes = 0;
+				if (!ReadFseTable(Data + Position, Num - Position, MaxAccuracyLog, MaxCode + 1, Table, TableBytes))
+				{
+					return false;
+				}
+				Position += TableBytes;
+				return true;
+			}
+
+			// repeat the previous one
+			return Table.IsValid();
+		}
+
+		bool DecodeSequences(const uint8* Data, const int64 Num, FFrameState& FrameState)
+		{
+			FrameState.Sequences.Reset();
+
+			if (Num < 1)
+			{
+				return false;
+			}
+
+			int64 NumSequences = 0;
+			int64 Position = 0;
+			if (Data[0] < 128)
+			{
+				NumSequences = Data[0];
+				Position = 1;
+			}
+			else if (Data[0] < 255)
+			{
+				if (Num < 2)
+				{
+					return false;
+				}
+				NumSequences = ((Data[0] - 128) << 8) + Data[1];
+				Position = 2;
+			}
+			else
+			{
+				if (Num < 3)
+				{
+					return false;
+				}
+				NumSequences = Data[1] + (Data[2] << 8) + 0x7F00;
+				Position = 3;
+			}
+
+			if (NumSequences == 0)
+			{
+				return Position == Num;
+			}
+
+			if (Position >= Num)
+			{
+				return false;
+			}
+
+			const uint8 Modes = Data[Position++];
+			if ((Modes & 0x03) != 0)
+			{
+				return false;
+			}
+
+			if (!ReadSequencesTable(Data, Num, Position, Modes >> 6, DefaultLiteralsLengthDistribution, 36, 6, 9, MaxLiteralsLengthCode, FrameState.LiteralsLengthTable) ||
+				!ReadSequencesTable(Data, Num, Position, (Modes >> 4) & 0x03, DefaultOffsetDistribution, 29, 5, 8, MaxOffsetCode, FrameState.OffsetTable) ||
+				!ReadSequencesTable(Data, Num, Position, (Modes >> 2) & 0x03, DefaultMatchLengthDistribution, 53, 6, 9, MaxMatchLengthCode, FrameState.MatchLengthTable))
+			{
+				return false;
+			}
+
+			FBackwardBitReader BitReader;
+			if (!BitReader.Init(Data + Position, Num - Position))
+			{
+				return false;
+			}
+
+			FFseState LiteralsLengthState(FrameState.LiteralsLengthTable);
+			FFseState OffsetState(FrameState.OffsetTable);
+			FFseState MatchLengthState(FrameState.MatchLengthTable);
+
+			LiteralsLengthState.Init(BitReader);
+			OffsetState.Init(BitReader);
+			MatchLengthState.Init(BitReader);
+
+			FrameState.Sequences.Reserve(NumSequences);
+
+			for (int64 SequenceIndex = 0; SequenceIndex < NumSequences; SequenceIndex++)
+			{
+				const uint8 OffsetCode = OffsetState.Peek();
+				const uint8 LiteralsLengthCode = LiteralsLengthState.Peek();
+				const uint8 MatchLengthCode = MatchLengthState.Peek();
+
+				if (OffsetCode > MaxOffsetCode || LiteralsLengthCode > MaxLiteralsLengthCode || MatchLengthCode > MaxMatchLengthCode)
+				{
+					return false;
+				}
+
+				FSequence Sequence;
+				Sequence.OffsetValue = (1u << OffsetCode) + static_cast<uint32>(BitReader.Read(OffsetCode));
+				Sequence.MatchLength = MatchLengthBase[MatchLengthCode] + static_cast<uint32>(BitReader.Read(MatchLengthBits[MatchLengthCode]));
+				Sequence.LiteralsLength = LiteralsLengthBase[LiteralsLengthCode] + static_cast<uint32>(BitReader.Read(LiteralsLengthBits[LiteralsLengthCode]));
+				FrameState.Sequences.Add(Sequence);
+
+				if (SequenceIndex < NumSequences - 1)
+				{
+					LiteralsLengthState.Update(BitReader);
+					MatchLengthState.Update(BitReader);
+					OffsetState.Update(BitReader);
+				}
+
+				if (BitReader.IsOverflow())
+				{
+					return false;
+				}
+			}
+
+			// the stream must be consumed exactly
+			return BitReader.BitOffset == 0;
+		}
+
+		bool ExecuteSequences(FFrameState& FrameState, FOutput& Output)
+		{
+			const uint8* Literals = FrameState.Literals.GetData();
+			const int64 LiteralsNum = FrameState.Literals.Num();
+			int64 LiteralsOffset = 0;
+			int64 BlockOutput = 0;
+
+			for (const FSequence& Sequence : FrameState.Sequences)
+			{
+				if (LiteralsOffset + Sequence.LiteralsLength > LiteralsNum)
+				{
+					return false;
+				}
+
+				BlockOutput += Sequence.LiteralsLength + Sequence.MatchLength;
+				if (BlockOutput > MaxBlockSize)
+				{
+					return false;
+				}
+
+				uint8* Destination = nullptr;
+				if (!Output.Reserve(Sequence.LiteralsLength + Sequence.MatchLength, Destination))
+				{
+					return false;
+				}
+
+				FMemory::Memcpy(Destination, Literals + LiteralsOffset, Sequence.LiteralsLength);
+				LiteralsOffset += Sequence.LiteralsLength;
+				Output.Num += Sequence.LiteralsLength;
+				Destination += Sequence.LiteralsLength;
+
+				uint32 Offset = 0;
+				if (Sequence.OffsetValue > 3)
+				{
+					Offset = Sequence.OffsetValue - 3;
+					FrameState.RepeatOffsets[2] = FrameState.RepeatOffsets[1];
+					FrameState.RepeatOffsets[1] = FrameState.RepeatOffsets[0];
+					FrameState.RepeatOffsets[0] = Offset;
+				}
+				else
+				{
+					// with no literals the repeat offsets are shifted by one
+					const uint32 RepeatIndex = Sequence.OffsetValue - 1 + (Sequence.LiteralsLength == 0 ? 1 : 0);
+					if (RepeatIndex == 0)
+					{
+						Offset = FrameState.RepeatOffsets[0];
+					}
+					else
+					{
+						Offset = RepeatIndex < 3 ? FrameState.RepeatOffsets[RepeatIndex] : FrameState.RepeatOffsets[0] - 1;
+						if (RepeatIndex > 1)
+						{
+							FrameState.RepeatOffsets[2] = FrameState.RepeatOffsets[1];
+						}
+						FrameState.RepeatOffsets[1] = FrameState.RepeatOffsets[0];
+						FrameState.RepeatOffsets[0] = Offset;
+					}
+				}
+
+				if (Offset == 0 || Offset > Output.Num - FrameState.OutputStart)
+				{
+					return false;
+				}
+
+				const uint8* Source = Destination - Offset;
+				if (Offset >= Sequence.MatchLength)
+				{
+					FMemory::Memcpy(Destination, Source, Sequence.MatchLength);
+				}
+				else
+				{
+					// overlapping match
+					for (uint32 Index = 0; Index < Sequence.MatchLength; Index++)
+					{
+						Destination[Index] = Source[Index];
+					}
+				}
+				Output.Num += Sequence.MatchLength;
+			}
+
+			const int64 LastLiterals = LiteralsNum - LiteralsOffset;
+			if (BlockOutput + LastLiterals > MaxBlockSize)
+			{
+				return false;
+			}
+
+			uint8* Destination = nullptr;
+			if (!Output.Reserve(LastLiterals, Destination))
+			{
+				return false;
+			}
+			FMemory::Memcpy(Destination, Literals + LiteralsOffset, LastLiterals);
+			Output.Num += LastLiterals;
+
+			return true;
+		}
+
+		bool ParseFrameHeader(const uint8* Data, const int64 Num, int64& HeaderSize, int64& ContentSize, bool& bHasChecksum)
+		{
+			if (Num < 6 || ReadLE<uint32>(Data) != FrameMagic)
+			{
+				return false;
+			}
+
+			const uint8 Descriptor = Data[4];
+			const uint8 ContentSizeFlag = Descriptor >> 6;
+			const bool bSingleSegment = (Descriptor >> 5) & 0x01;
+			const uint8 DictionaryIdFlag = Descriptor & 0x03;
+			bHasChecksum = (Descriptor >> 2) & 0x01;
+
+			// reserved bit
+			if ((Descriptor >> 3) & 0x01)
+			{
+				return false;
+			}
+
+			const int64 DictionaryIdSizes[4] = { 0, 1, 2, 4 };
+			const int64 ContentSizeSizes[4] = { bSingleSegment ? 1 : 0, 2, 4, 8 };
+
+			int64 Position = 5 + (bSingleSegment ? 0 : 1);
+			const int64 DictionaryIdSize = DictionaryIdSizes[DictionaryIdFlag];
+			const int64 ContentSizeSize = ContentSizeSizes[ContentSizeFlag];
+
+			if (Position + DictionaryIdSize + ContentSizeSize > Num)
+			{
+				return false;
+			}
+
+			uint32 DictionaryId = 0;
+			for (int64 Index = 0; Index < DictionaryIdSize; Index++)
+			{
+				DictionaryId |= static_cast<uint32>(Data[Position + Index]) << (Index * 8);
+			}
+			Position += DictionaryIdSize;
+
+			if (DictionaryId != 0)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Zstd dictionaries are not supported."));
+				return false;
+			}
+
+			ContentSize = -1;
+			if (ContentSizeSize == 1)
+			{
+				ContentSize = Data[Position];
+			}
+			else if (ContentSizeSize == 2)
+			{
+				ContentSize = ReadLE<uint16>(Data + Position) + 256;
+			}
+			else if (ContentSizeSize == 4)
+			{
+				ContentSize = ReadLE<uint32>(Data + Position);
+			}
+			else if (ContentSizeSize == 8)
+			{
+				const uint64 ContentSize64 = ReadLE<uint64>(Data + Position);
+				if (ContentSize64 > static_cast<uint64>(MAX_int64))
+				{
+					return false;
+				}
+				ContentSize = static_cast<int64>(ContentSize64);
+			}
+			Position += ContentSizeSize;
+
+			HeaderSize = Position;
+			return true;
+		}
+
+		bool DecodeFrame(const uint8* Data, const int64 Num, FOutput& Output)
+		{
+			int64 HeaderSize = 0;
+			int64 ContentSize = -1;
+			bool bHasChecksum = false;
+			if (!ParseFrameHeader(Data, Num, HeaderSize, ContentSize, bHasChecksum))
+			{
+				return false;
+			}
+
+			FFrameState FrameState(Output.Num);
+			int64 Position = HeaderSize;
+
+			while (true)
+			{
+				if (Position + 3 > Num)
+				{
+					return false;
+				}
+
+				const uint32 BlockHeader = Data[Position] | (Data[Position + 1] << 8) | (Data[Position + 2] << 16);
+				Position += 3;
+
+				const bool bLastBlock = BlockHeader & 0x01;
+				const uint32 BlockType = (BlockHeader >> 1) & 0x03;
+				const int64 BlockSize = BlockHeader >> 3;
+
+				if (BlockSize > MaxBlockSize)
+				{
+					return false;
+				}
+
+				// raw
+				if (BlockType == 0)
+				{
+					if (Position + BlockSize > Num)
+					{
+						return false;
+					}
+					uint8* Destination = nullptr;
+					if (!Output.Reserve(BlockSize, Destination))
+					{
+						return false;
+					}
+					FMemory::Memcpy(Destination, Data + Position, BlockSize);
+					Output.Num += BlockSize;
+					Position += BlockSize;
+				}
+				// rle
+				else if (BlockType == 1)
+				{
+					if (Position + 1 > Num)
+					{
+						return false;
+					}
+					uint8* Destination = nullptr;
+					if (!Output.Reserve(BlockSize, Destination))
+					{
+						return false;
+					}
+					FMemory::Memset(Destination, Data[Position], BlockSize);
+					Output.Num += BlockSize;
+					Position += 1;
+				}
+				// compressed
+				else if (BlockType == 2)
+				{
+					if (Position + BlockSize > Num)
+					{
+						return false;
+					}
+
+					int64 LiteralsBytes = 0;
+					if (!DecodeLiterals(Data + Position, BlockSize, FrameState, LiteralsBytes))
+					{
+						return false;
+					}
+
+					if (!DecodeSequences(Data + Position + LiteralsBytes, BlockSize - LiteralsBytes, FrameState))
+					{
+						return false;
+					}
+
+					if (!ExecuteSequences(FrameState, Output))
+					{
+						return false;
+					}
+
+					Position += BlockSize;
+				}
+				else
+				{
+					return false;
+				}
+
+				if (bLastBlock)
+				{
+					break;
+				}
+			}
+
+			if (ContentSize >= 0 && Output.Num - FrameState.OutputStart != ContentSize)
+			{
+				return false;
+			}
+
+			return !bHasChecksum || Position + 4 <= Num;
+		}
+
+		struct FFrameInfo
+		{
+			int64 Offset;
+			int64 Size;
+			int64 ContentSize;
+		};
+
+		// finds the frames boundaries walking the blocks headers (no decoding involved)
+		bool ScanFrames(const uint8* DataPtr, const int64 DataNum, TArray<FFrameInfo>& Frames)
+		{
+			TArray<int64> SeekTableSizes;
+
+			int64 Offset = 0;
+			while (Offset < DataNum)
+			{
+				if (Offset + 8 > DataNum)
+				{
+					return false;
+				}
+
+				const uint32 Magic = ReadLE<uint32>(DataPtr + Offset);
+				if ((Magic & SkippableMagicMask) == SkippableMagic)
+				{
+					const int64 SkippableSize = ReadLE<uint32>(DataPtr + Offset + 4);
+					if (Offset + 8 + SkippableSize > DataNum)
+					{
+						return false;
+					}
+
+					// seekable format, the decompressed sizes of the frames are in the footer
+					if (Magic == SeekTableMagic && SkippableSize >= 9 && ReadLE<uint32>(DataPtr + Offset + 8 + SkippableSize - 4) == SeekableMagic)
+					{
+						const uint8* Footer = DataPtr + Offset + 8 + SkippableSize - 9;
+						const int64 NumEntries = ReadLE<uint32>(Footer);
+						const int64 EntrySize = (Footer[4] & 0x80) ? 12 : 8;
+						if (NumEntries * EntrySize + 9 == SkippableSize)
+						{
+							for (int64 EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
+							{
+								SeekTableSizes.Add(ReadLE<uint32>(DataPtr + Offset + 8 + EntryIndex * EntrySize + 4));
+							}
+						}
+					}
+
+					Offset += 8 + SkippableSize;
+					continue;
+				}
+
+				FFrameInfo Frame;
+				Frame.Offset = Offset;
+
+				int64 HeaderSize = 0;
+				bool bHasChecksum = false;
+				if (!ParseFrameHeader(DataPtr + Offset, DataNum - Offset, HeaderSize, Frame.ContentSize, bHasChecksum))
+				{
+					return false;
+				}
+
+				int64 Position = Offset + HeaderSize;
+				while (true)
+				{
+					if (Position + 3 > DataNum)
+					{
+						return false;
+					}
+
+					const uint32 BlockHeader = DataPtr[Position] | (DataPtr[Position + 1] << 8) | (DataPtr[Position + 2] << 16);
+					const uint32 BlockType = (BlockHeader >> 1) & 0x03;
+					if (BlockType == 3)
+					{
+						return false;
+					}
+
+					Position += 3 + (BlockType == 1 ? 1 : (BlockHeader >> 3));
+					if (BlockHeader & 0x01)
+					{
+						break;
+					}
+				}
+
+				Position += bHasChecksum ? 4 : 0;
+				if (Position > DataNum)
+				{
+					return false;
+				}
+
+				Frame.Size = Position - Offset;
+				Frames.Add(Frame);
+				Offset = Position;
+			}
+
+			if (SeekTableSizes.Num() == Frames.Num())
+			{
+				for (int32 FrameIndex = 0; FrameIndex < Frames.Num(); FrameIndex++)
+				{
+					if (Frames[FrameIndex].ContentSize < 0)
+					{
+						Frames[FrameIndex].ContentSize = SeekTableSizes[FrameIndex];
+					}
+				}
+			}
+
+			return true;
+		}
+	}
+
+	bool ZstdDecompress(const uint8* DataPtr, const int64 DataNum, TArray64<uint8>& UncompressedData, FglTFRuntimeLoaderStats& LoaderStats)
+	{
+		TArray<Zstd::FFrameInfo> Frames;
+		if (!Zstd::ScanFrames(DataPtr, DataNum, Frames) || Frames.Num() < 1)
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Zstd data."));
+			return false;
+		}
+
+		LoaderStats.Chunks = Frames.Num();
+
+		// Decompression-bomb guard (untrusted input): a block regenerates at most 128KB and takes
+		// at least 4 bytes (3 bytes header + 1 byte), so nothing valid expands more than 32768:1.
+		// That bound is only used to reject impossible declared sizes: output is preallocated up
+		// to a realistic ratio, anything above it is decoded incrementally and grows only as the
+		// blocks really produce data.
+		constexpr int64 MaxZstdExpansion = Zstd::MaxBlockSize / 4;
+		constexpr int64 MaxZstdPreallocatedExpansion = 1032;
+		const int64 MaxPlausibleOutput = DataNum * MaxZstdExpansion;
+
+		bool bContentSizesKnown = true;
+		int64 TotalContentSize = 0;
+		for (const Zstd::FFrameInfo& Frame : Frames)
+		{
+			if (Frame.ContentSize < 0)
+			{
+				bContentSizesKnown = false;
+				break;
+			}
+			TotalContentSize += Frame.ContentSize;
+			if (TotalContentSize > MaxPlausibleOutput)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Refusing Zstd data: declared content size is implausible for %lld compressed bytes (possible decompression bomb)."), static_cast<long long>(DataNum));
+				return false;
+			}
+		}
+
+		// every frame is decoded in parallel in its own slice of the output
+		if (bContentSizesKnown && TotalContentSize <= DataNum * MaxZstdPreallocatedExpansion)
+		{
+			LoaderStats.bParallel = Frames.Num() > 1;
+			UncompressedData.SetNumUninitialized(TotalContentSize);
+
+			TArray<int64> FramesOutputOffsets;
+			FramesOutputOffsets.AddUninitialized(Frames.Num());
+			int64 OutputOffset = 0;
+			for (int32 FrameIndex = 0; FrameIndex < Frames.Num(); FrameIndex++)
+			{
+				FramesOutputOffsets[FrameIndex] = OutputOffset;
+				OutputOffset += Frames[FrameIndex].ContentSize;
+			}
+
+			TArray<bool> FramesStates;
+			FramesStates.AddZeroed(Frames.Num());
+
+			ParallelFor(Frames.Num(), [&](const int32 FrameIndex)
+				{
+					const Zstd::FFrameInfo& Frame = Frames[FrameIndex];
+					Zstd::FOutput Output;
+					Output.Data = UncompressedData.GetData() + FramesOutputOffsets[FrameIndex];
+					Output.Num = 0;
+					Output.Capacity = Frame.ContentSize;
+					Output.Array = nullptr;
+					Output.MaxNum = Frame.ContentSize;
+					Output.bMaxNumReached = false;
+					FramesStates[FrameIndex] = Zstd::DecodeFrame(DataPtr + Frame.Offset, Frame.Size, Output) && Output.Num == Frame.ContentSize;
+				});
+
+			for (int32 FrameIndex = 0; FrameIndex < Frames.Num(); FrameIndex++)
+			{
+				if (!FramesStates[FrameIndex])
+				{
+					UE_LOG(LogGLTFRuntime, Error, TEXT("Zstd parallel decompression error @Frame %d"), FrameIndex);
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		// declared sizes (when known) are the hard limit of the incremental decoding
+		const int64 MaxOutput = bContentSizesKnown ? TotalContentSize : MaxPlausibleOutput;
+		UncompressedData.SetNumUninitialized(FMath::Min<int64>(FMath::Max<int64>(DataNum * 4, Zstd::MaxBlockSize), MaxOutput));
+
+		Zstd::FOutput Output;
+		Output.Data = UncompressedData.GetData();
+		Output.Num = 0;
+		Output.Capacity = UncompressedData.Num();
+		Output.Array = &UncompressedData;
+		Output.MaxNum = MaxOutput;
+		Output.bMaxNumReached = false;
+
+		for (int32 FrameIndex = 0; FrameIndex < Frames.Num(); FrameIndex++)
+		{
+			if (!Zstd::DecodeFrame(DataPtr + Frames[FrameIndex].Offset, Frames[FrameIndex].Size, Output))
+			{
+				if (Output.bMaxNumReached)
+				{
+					UE_LOG(LogGLTFRuntime, Error, TEXT("Refusing Zstd data: decompressed output exceeded the %lld-byte plausibility bound (possible decompression bomb)."), static_cast<long long>(MaxOutput));
+					return false;
+				}
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Zstd decompression error @Frame %d"), FrameIndex);
+				return false;
+			}
+		}
+
+		UncompressedData.SetNum(Output.Num);
+		return true;
+	}
+}
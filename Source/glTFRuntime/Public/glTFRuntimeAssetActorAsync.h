@@ -66,6 +66,8 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime")
 	bool bStaticMeshesAsSkeletal;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void Destroyed() override;
 	virtual void PostUnregisterAllComponents() override;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime")
@@ -74,22 +76,72 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime")
 	FglTFRuntimeLightConfig LightConfig;
 
+	// max number of meshes built at the same time
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true, ClampMin = 1), Category = "glTFRuntime")
+	int32 MaxConcurrentMeshes;
+
+	// build each mesh (or mesh/skin pair) only once and share it between components.
+	// Static meshes are shared only by nodes getting the same OverrideStaticMeshConfig.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime")
+	bool bShareMeshes;
+
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FglTFRuntimeAssetActorAsyncMeshAssigned, UPrimitiveComponent*, UObject*);
+	FglTFRuntimeAssetActorAsyncMeshAssigned OnMeshAssigned;
+
+	DECLARE_MULTICAST_DELEGATE(FglTFRuntimeAssetActorAsyncScenesLoaded);
+	FglTFRuntimeAssetActorAsyncScenesLoaded OnScenesLoaded;
+
+	// unique mesh builds
+	int32 GetMeshLoadsNum() const { return MeshLoads.Num(); }
+	int32 GetMeshLoadsInFlight() const { return MeshLoadsInFlight; }
+
 private:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"), Category="glTFRuntime")
 	USceneComponent* AssetRoot;
 
-	TMap<UPrimitiveComponent*, FglTFRuntimeNode> MeshesToLoad;
+	struct FglTFRuntimeMeshToLoad
+	{
+		UPrimitiveComponent* PrimitiveComponent;
+		FglTFRuntimeNode Node;
+		int32 LoadIndex;
+	};
+
+	struct FglTFRuntimeMeshLoad
+	{
+		int32 MeshToLoadIndex;
+		bool bLoaded;
+	};
+
+	// components in scene order, assigned in the same order
+	TArray<FglTFRuntimeMeshToLoad> MeshesToLoad;
+	// unique mesh builds, started in scene order
+	TArray<FglTFRuntimeMeshLoad> MeshLoads;
+	TMap<TTuple<int32, int32>, int32> MeshLoadsMap;
+	// OverrideStaticMeshConfig results, one per mesh load (default for skeletal meshes)
+	UPROPERTY()
+	TArray<FglTFRuntimeStaticMeshConfig> MeshLoadsStaticMeshConfigs;
+
+	UPROPERTY()
+	TArray<UObject*> LoadedMeshes;
+
+	// cancelled when the actor ends play or is destroyed
+	TArray<FglTFRuntimeLoadHandlePtr> LoadHandles;
+	void CancelLoads();
+
+	int32 NextMeshLoad;
+	int32 NextMeshToAssign;
+	int32 MeshLoadsInFlight;
+	bool bScenesLoaded;
+
+	void AddMeshToLoad(UPrimitiveComponent* PrimitiveComponent, const FglTFRuntimeNode& Node);
 
-	void LoadNextMeshAsync();
+	void LoadNextMeshesAsync();
 
-	UFUNCTION()
-	void LoadStaticMeshAsync(UStaticMesh* StaticMesh);
+	void OnMeshLoaded(UObject* Mesh, const int32 LoadIndex);
 
-	UFUNCTION()
-	void LoadSkeletalMeshAsync(USkeletalMesh* SkeletalMesh);
+	void AssignStaticMesh(UStaticMeshComponent* StaticMeshComponent, UStaticMesh* StaticMesh);
 
-	// this is safe to share between game and async threads because everything is sequential
-	UPrimitiveComponent* CurrentPrimitiveComponent;
+	void AssignSkeletalMesh(USkeletalMeshComponent* SkeletalMeshComponent, USkeletalMesh* SkeletalMesh);
 
 	double LoadingStartTime;
 
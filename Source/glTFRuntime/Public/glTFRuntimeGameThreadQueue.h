@@ -0,0 +1,78 @@
+// Copyright 2026 - Roberto De Ioris
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Containers/Ticker.h"
+#include "glTFRuntimeLoadHandle.h"
+
+/*
+ * Game thread work generated by async loads (mesh finalization, UObject creation, render resources init).
+ * When a budget is set, the queue is drained in a core ticker spending at most Budget milliseconds per frame
+ * (at least one item always runs, items are never split). Higher priorities run first, FIFO otherwise;
+ * items enqueued with a load handle use its current priority, so they can be promoted while waiting.
+ * With a budget of 0 (the default) every item is dispatched immediately to the game thread as before.
+ */
+class GLTFRUNTIME_API FglTFRuntimeGameThreadQueue
+{
+public:
+	static FglTFRuntimeGameThreadQueue& Get();
+
+	// can be called from any thread, the returned event completes when Work has run on the game thread
+	FGraphEventRef Enqueue(TFunction<void()> Work, const int32 Priority = 0);
+	FGraphEventRef Enqueue(TFunction<void()> Work, FglTFRuntimeLoadHandleRef LoadHandle);
+
+	void SetBudget(const float Milliseconds);
+	float GetBudget() const;
+
+	int32 Num() const;
+
+	void Startup();
+	void Shutdown();
+
+	// runs the queued items within the budget, called by the core ticker
+	bool Tick(float DeltaTime);
+
+private:
+	struct FglTFRuntimeGameThreadWork
+	{
+		TFunction<void()> Work;
+		FGraphEventRef Event;
+		int32 Priority;
+		FglTFRuntimeLoadHandlePtr LoadHandle;
+		uint64 Serial;
+		// priority snapshot used for the heap ordering
+		int32 HeapPriority;
+
+		int32 GetPriority() const
+		{
+			return LoadHandle ? LoadHandle->GetPriority() : Priority;
+		}
+
+		// higher priorities on top of the heap, then FIFO
+		bool operator<(const FglTFRuntimeGameThreadWork& Other) const
+		{
+			return HeapPriority > Other.HeapPriority || (HeapPriority == Other.HeapPriority && Serial < Other.Serial);
+		}
+	};
+
+	FGraphEventRef Enqueue(TFunction<void()> Work, const int32 Priority, FglTFRuntimeLoadHandlePtr LoadHandle);
+	bool Pop(FglTFRuntimeGameThreadWork& Item);
+
+	void Run(FglTFRuntimeGameThreadWork& Item);
+	void Flush();
+
+	mutable FCriticalSection QueueLock;
+	// binary heap, rebuilt when a load handle priority changed since the last pop
+	TArray<FglTFRuntimeGameThreadWork> Queue;
+	uint32 QueuePriorityGeneration = 0;
+	uint64 NextSerial = 0;
+	float BudgetMilliseconds = 0;
+
+#if ENGINE_MAJOR_VERSION > 4
+	FTSTicker::FDelegateHandle TickerHandle;
+#else
+	FDelegateHandle TickerHandle;
+#endif
+};
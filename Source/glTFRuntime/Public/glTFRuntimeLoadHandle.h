@@ -0,0 +1,87 @@
+// Copyright 2026 - Roberto De Ioris
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/*
+ * Shared state of an async load: the loader checks for cancellation between its stages
+ * (a cancelled load completes with a null result), the priority is read when game thread work is picked
+ * from FglTFRuntimeGameThreadQueue and progress goes from 0 to 1.
+ */
+class GLTFRUNTIME_API FglTFRuntimeLoadHandle
+{
+public:
+	FglTFRuntimeLoadHandle(const int32 InPriority = 0) : Priority(InPriority)
+	{
+	}
+
+	void Cancel()
+	{
+		bCancelled = true;
+	}
+
+	bool IsCancelled() const
+	{
+		return bCancelled;
+	}
+
+	void SetPriority(const int32 NewPriority)
+	{
+		if (Priority.exchange(NewPriority) != NewPriority)
+		{
+			// queued game thread work must be reordered
+			PriorityGeneration++;
+		}
+	}
+
+	int32 GetPriority() const
+	{
+		return Priority;
+	}
+
+	void SetProgress(const float NewProgress)
+	{
+		Progress = FMath::Clamp(NewProgress, 0.0f, 1.0f);
+	}
+
+	// progress of a stage covering [StageStart, StageEnd] of the whole load
+	void SetStageProgress(const float StageStart, const float StageEnd, const int32 Done, const int32 Total)
+	{
+		SetProgress(Total > 0 ? FMath::Lerp(StageStart, StageEnd, static_cast<float>(Done) / Total) : StageStart);
+	}
+
+	float GetProgress() const
+	{
+		return Progress;
+	}
+
+	void Complete()
+	{
+		Progress = 1;
+		bCompleted = true;
+	}
+
+	bool IsCompleted() const
+	{
+		return bCompleted;
+	}
+
+	// bumped every time the priority of any handle changes
+	static uint32 GetPriorityGeneration()
+	{
+		return PriorityGeneration;
+	}
+
+private:
+	static std::atomic<uint32> PriorityGeneration;
+
+	std::atomic<bool> bCancelled{ false };
+	std::atomic<bool> bCompleted{ false };
+	std::atomic<int32> Priority;
+	std::atomic<float> Progress{ 0 };
+};
+
+using FglTFRuntimeLoadHandleRef = TSharedRef<FglTFRuntimeLoadHandle, ESPMode::ThreadSafe>;
+using FglTFRuntimeLoadHandlePtr = TSharedPtr<FglTFRuntimeLoadHandle, ESPMode::ThreadSafe>;
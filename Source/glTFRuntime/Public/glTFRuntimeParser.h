@@ -8,6 +8,7 @@
 #include "Animation/PoseAsset.h"
 #include "Animation/Skeleton.h"
 #include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
 #include "Async/ParallelFor.h"
 #include "Dom/JsonValue.h"
 #include "Dom/JsonObject.h"
@@ -25,6 +26,8 @@
 #include "Components/AudioComponent.h"
 #include "Components/LightComponent.h"
 #include "glTFRuntimeAnimationCurve.h"
+#include "glTFRuntimeGameThreadQueue.h"
+#include "glTFRuntimeLoadHandle.h"
 #include "ProceduralMeshComponent.h"
 #if WITH_EDITOR
 #include "Rendering/SkeletalMeshLODImporterData.h"
@@ -44,6 +47,70 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FglTFRuntimeOnSkeletalMeshCreated, U
 #define GLTFRUNTIME_IMAGE_API_1
 #define GLTFRUNTIME_HAS_BONE_REMAPPER_LOD
 
+/*
+* Immutable bytes shared between the parser, its caches and the archives.
+* Whoever needs the data to stay alive keeps a reference instead of making a copy.
+*/
+class GLTFRUNTIME_API FglTFRuntimeBytesStorage
+{
+public:
+	virtual ~FglTFRuntimeBytesStorage() {}
+
+	virtual const uint8* GetData() const = 0;
+	virtual int64 Num() const = 0;
+
+	static TSharedRef<const FglTFRuntimeBytesStorage, ESPMode::ThreadSafe> FromArray(TArray64<uint8>&& InData);
+	static TSharedRef<const FglTFRuntimeBytesStorage, ESPMode::ThreadSafe> FromCopy(const uint8* InData, const int64 InNum);
+	static TSharedRef<const FglTFRuntimeBytesStorage, ESPMode::ThreadSafe> FromView(TSharedRef<const FglTFRuntimeBytesStorage, ESPMode::ThreadSafe> InOwner, const uint8* InData, const int64 InNum);
+};
+
+using FglTFRuntimeBytesStorageRef = TSharedRef<const FglTFRuntimeBytesStorage, ESPMode::ThreadSafe>;
+using FglTFRuntimeBytesStoragePtr = TSharedPtr<const FglTFRuntimeBytesStorage, ESPMode::ThreadSafe>;
+
+class FglTFRuntimeBytesStorageArray : public FglTFRuntimeBytesStorage
+{
+public:
+	FglTFRuntimeBytesStorageArray(TArray64<uint8>&& InData) : Data(MoveTemp(InData)) {}
+
+	const uint8* GetData() const override { return Data.GetData(); }
+	int64 Num() const override { return Data.Num(); }
+
+protected:
+	TArray64<uint8> Data;
+};
+
+// a slice of another storage (e.g. the BIN chunk of a GLB or a stored zip entry)
+class FglTFRuntimeBytesStorageView : public FglTFRuntimeBytesStorage
+{
+public:
+	FglTFRuntimeBytesStorageView(FglTFRuntimeBytesStorageRef InOwner, const uint8* InData, const int64 InNum) : Owner(InOwner), Data(InData), DataNum(InNum) {}
+
+	const uint8* GetData() const override { return Data; }
+	int64 Num() const override { return DataNum; }
+
+protected:
+	FglTFRuntimeBytesStorageRef Owner;
+	const uint8* Data;
+	int64 DataNum;
+};
+
+/*
+* Read-only memory mapping of a whole file.
+*/
+class GLTFRUNTIME_API FglTFRuntimeMappedFile : public FglTFRuntimeBytesStorage
+{
+public:
+	static TSharedPtr<FglTFRuntimeMappedFile, ESPMode::ThreadSafe> Open(const FString& Filename);
+
+	const uint8* GetData() const override { return MappedRegion->GetMappedPtr(); }
+	int64 Num() const override { return MappedRegion->GetMappedSize(); }
+
+protected:
+	// the region must be released before the handle
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+};
+
 /*
 * Credits for giving me the idea for the blob structure
 * definitely go to Benjamin MICHEL (SBRK)
@@ -54,11 +121,22 @@ struct FglTFRuntimeBlob
 	uint8* Data;
 	int64 Num;
 
+	// optional, keeps Data alive when it comes from a shared storage
+	FglTFRuntimeBytesStoragePtr Storage;
+
 	FglTFRuntimeBlob()
 	{
 		Data = nullptr;
 		Num = 0;
 	}
+
+	void SetStorage(FglTFRuntimeBytesStorageRef InStorage)
+	{
+		// storages are immutable, blobs are never written
+		Data = const_cast<uint8*>(InStorage->GetData());
+		Num = InStorage->Num();
+		Storage = InStorage;
+	}
 };
 
 UENUM(BlueprintType, meta = (DisplayName = "glTFRuntime TransformBaseType"))
@@ -292,6 +370,38 @@ struct FglTFRuntimeConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bBaseDirectoryFromArchiveEntryPoint;
 
+	// map the file (and external buffers) in memory instead of loading them, GLB binary chunks are accessed in place
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bMemoryMapFiles;
+
+	// when not empty, decoded primitives and texture mips are cached in this directory (keyed by content and config hashes)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	FString DerivedDataCacheDirectory;
+
+	// reuse (instead of parsing again) an asset already loaded from the same file with the same config
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bShareAsset;
+
+	// max bytes held by the parser binary caches (buffers, decompressed/sparse views, mesh LODs), least recently used entries are evicted first (0 = unlimited)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int64 CacheBytesBudget;
+
+	// decompress all the archive entries referenced by buffers and images in parallel just after parsing
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bPrefetchArchiveEntries;
+
+	// gzip compressed tar archives loaded from file are inflated (chunk by chunk) to a temporary file instead of memory
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bInflateArchivesToDisk;
+
+	// optional bgzip style (.gzi) index of the members of a gzip compressed file, allowing to inflate them in parallel (BGZF files do not need it)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	FString GzipIndexFilename;
+
+	// parse the json in a single pass directly from the UTF-8 bytes (instead of converting it to a string for the engine json reader)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bUseFastJsonParser;
+
 	FglTFRuntimeConfig()
 	{
 		TransformBaseType = EglTFRuntimeTransformBaseType::Default;
@@ -307,6 +417,12 @@ struct FglTFRuntimeConfig
 		PrefixForUnnamedNodes = "node";
 		bNoArchive = false;
 		bBaseDirectoryFromArchiveEntryPoint = false;
+		bMemoryMapFiles = false;
+		bShareAsset = false;
+		CacheBytesBudget = 0;
+		bPrefetchArchiveEntries = false;
+		bInflateArchivesToDisk = false;
+		bUseFastJsonParser = false;
 	}
 
 	FMatrix GetMatrix() const
@@ -498,6 +614,131 @@ struct FglTFRuntimeBone
 	}
 };
 
+USTRUCT(BlueprintType)
+struct FglTFRuntimeCacheStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int64 BuffersBytes = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int64 CompressedBufferViewsBytes = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int64 SparseAccessorsBytes = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int64 ZeroBufferBytes = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int64 LODsBytes = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int64 ImagesBytes = 0;
+
+	// bytes of the entries that cannot be evicted yet (already included in the values above)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int64 PinnedBytes = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 StaticMeshes = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 SkeletalMeshes = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 Skeletons = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 Materials = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 Textures = 0;
+
+	// primitives and mips served from (or missing in) the DerivedDataCacheDirectory
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 DerivedDataHits = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 DerivedDataMisses = 0;
+
+	int64 GetTotalBytes() const
+	{
+		return BuffersBytes + CompressedBufferViewsBytes + SparseAccessorsBytes + ZeroBufferBytes + LODsBytes + ImagesBytes;
+	}
+};
+
+USTRUCT(BlueprintType)
+struct FglTFRuntimeLoaderStats
+{
+	GENERATED_BODY()
+
+	// Gzip, LZ4 or Zstd (empty for uncompressed data)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	FString Compression;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int64 CompressedBytes = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int64 UncompressedBytes = 0;
+
+	// Gzip members, LZ4 blocks or Zstd frames
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 Chunks = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bParallel = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float DecompressionTime = 0;
+
+	// source file and external buffers accessed through a memory mapping (bMemoryMapFiles)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int64 MemoryMappedBytes = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FglTFRuntimeMeshOptimizationStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 Sections = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int64 Triangles = 0;
+
+	// simulated FIFO post-transform cache misses
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int64 CacheMissesBefore = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int64 CacheMissesAfter = 0;
+
+	// average cache miss ratio (vertex shader invocations per triangle, 0.5 is the ideal for large regular meshes, 3 the worst)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float ACMRBefore = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float ACMRAfter = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float OptimizationTime = 0;
+
+	void Append(const FglTFRuntimeMeshOptimizationStats& Other)
+	{
+		Sections += Other.Sections;
+		Triangles += Other.Triangles;
+		CacheMissesBefore += Other.CacheMissesBefore;
+		CacheMissesAfter += Other.CacheMissesAfter;
+		OptimizationTime += Other.OptimizationTime;
+		ACMRBefore = Triangles > 0 ? static_cast<float>(static_cast<double>(CacheMissesBefore) / Triangles) : 0;
+		ACMRAfter = Triangles > 0 ? static_cast<float>(static_cast<double>(CacheMissesAfter) / Triangles) : 0;
+	}
+};
+
 USTRUCT(BlueprintType)
 struct FglTFRuntimeMorphTarget
 {
@@ -793,6 +1034,23 @@ struct FglTFRuntimeMaterialsConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	TMap<EglTFRuntimeSubstrateMaterialType, UMaterialInterface*> SubstrateMaterials;
 
+	// keep positions, normals, tangents, uvs and colors as single precision streams from the accessor to the render buffers (halves transient memory on UE5)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bCompactVertexData;
+
+	// merge the vertices with the same position and attributes (non indexed primitives, strips, fans and merged sections), producing a shared index buffer.
+	// Primitives without normals are not welded, as the generated ones would be smooth
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bWeldVertices;
+
+	// positions (and morph target deltas) tolerance in scene units, 0 for exact matches
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float WeldVerticesTolerance;
+
+	// normals, tangents, uvs, colors, weights and weight maps tolerance, 0 for exact matches
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float WeldVerticesAttributesTolerance;
+
 	FglTFRuntimeMaterialsConfig()
 	{
 		CacheMode = EglTFRuntimeCacheMode::ReadWrite;
@@ -816,6 +1074,10 @@ struct FglTFRuntimeMaterialsConfig
 		bAddEpicInterchangeParams = false;
 		bForceEmptyMaterialNameToMaterialIndex = false;
 		bUseSubstrateMaterials = false;
+		bCompactVertexData = false;
+		bWeldVertices = false;
+		WeldVerticesTolerance = 0;
+		WeldVerticesAttributesTolerance = 0;
 	}
 };
 
@@ -915,6 +1177,37 @@ struct FglTFRuntimeStaticMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bUseHighPrecisionTangentBasis;
 
+	// initial priority of the async load handle, higher ones are finalized first when a game thread budget is set
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 GameThreadPriority;
+
+	// generated normals are smoothed across vertices sharing the same position (like UV seams)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bWeldVerticesForNormals;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float NormalsWeldTolerance;
+
+	// max angle (in degrees) between faces smoothed across welded vertices
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float NormalsCreaseAngle;
+
+	// reorder triangles (Tipsify) and vertices (first use) of each section for the post-transform cache and vertex fetch
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bOptimizeVertexCache;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 VertexCacheSize;
+
+	// then reorder clusters of triangles for less overdraw, allowing the cache miss ratio to grow by this factor (0 disables it)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float OverdrawThreshold;
+
+	// when the mesh has a single LOD, generate one simplified LOD per ratio (of LOD0 triangles to keep, e.g. 0.5, 0.25).
+	// Vertices on attribute seams are locked, so flat shaded or hard edged meshes (every corner split by normals) barely simplify.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	TArray<float> AutoLODsTrianglesRatios;
+
 	FglTFRuntimeStaticMeshConfig()
 	{
 		CacheMode = EglTFRuntimeCacheMode::ReadWrite;
@@ -934,6 +1227,13 @@ struct FglTFRuntimeStaticMeshConfig
 		LODScreenSizeMultiplier = 2;
 		bBuildLumenCards = false;
 		bUseHighPrecisionTangentBasis = false;
+		GameThreadPriority = 0;
+		bWeldVerticesForNormals = false;
+		NormalsWeldTolerance = 0;
+		NormalsCreaseAngle = 180;
+		bOptimizeVertexCache = false;
+		VertexCacheSize = 16;
+		OverdrawThreshold = 1.05f;
 	}
 };
 
@@ -1397,6 +1697,30 @@ struct FglTFRuntimeSkeletalMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	FglTFRuntimeMorphTargetRemapperHook MorphTargetRemapper;
 
+	// initial priority of the async load handle, higher ones are finalized first when a game thread budget is set
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 GameThreadPriority;
+
+	// reorder triangles (Tipsify) and vertices (first use) of each section for the post-transform cache and vertex fetch
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bOptimizeVertexCache;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 VertexCacheSize;
+
+	// then reorder clusters of triangles for less overdraw, allowing the cache miss ratio to grow by this factor (0 disables it)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float OverdrawThreshold;
+
+	// when the mesh has a single LOD, generate one simplified LOD per ratio (of LOD0 triangles to keep, e.g. 0.5, 0.25).
+	// Vertices on attribute seams are locked, so flat shaded or hard edged meshes (every corner split by normals) barely simplify.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	TArray<float> AutoLODsTrianglesRatios;
+
+	// used for the screen sizes of generated LODs (LODScreenSize overrides them)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float LODScreenSizeMultiplier;
+
 	FglTFRuntimeSkeletalMeshConfig()
 	{
 		CacheMode = EglTFRuntimeCacheMode::ReadWrite;
@@ -1424,6 +1748,11 @@ struct FglTFRuntimeSkeletalMeshConfig
 		bAutoGeneratePhysicsAssetConstraints = false;
 		bAllowCPUAccess = false;
 		bUseHighPrecisionTangentBasis = false;
+		GameThreadPriority = 0;
+		bOptimizeVertexCache = false;
+		VertexCacheSize = 16;
+		OverdrawThreshold = 1.05f;
+		LODScreenSizeMultiplier = 2;
 	}
 };
 
@@ -1640,8 +1969,24 @@ struct FglTFRuntimeUInt16Vector4
 			return W;
 		}
 	}
+
+	friend FArchive& operator<<(FArchive& Ar, FglTFRuntimeUInt16Vector4& Vector)
+	{
+		return Ar << Vector.X << Vector.Y << Vector.Z << Vector.W;
+	}
 };
 
+#if ENGINE_MAJOR_VERSION > 4
+typedef FVector3f FglTFRuntimeCompactVector;
+typedef FVector4f FglTFRuntimeCompactVector4;
+typedef FVector2f FglTFRuntimeCompactVector2D;
+#else
+// UE4 vectors are already single precision
+typedef FVector FglTFRuntimeCompactVector;
+typedef FVector4 FglTFRuntimeCompactVector4;
+typedef FVector2D FglTFRuntimeCompactVector2D;
+#endif
+
 struct FglTFRuntimePrimitive
 {
 	TArray<FVector> Positions;
@@ -1668,6 +2013,14 @@ struct FglTFRuntimePrimitive
 
 	TMap<FString, TArray<float>> WeightMaps;
 
+	// when bCompactVertexData is true, vertex attributes live in these streams instead of Positions/Normals/Tangents/UVs/Colors
+	bool bCompactVertexData;
+	TArray<FglTFRuntimeCompactVector> CompactPositions;
+	TArray<FglTFRuntimeCompactVector> CompactNormals;
+	TArray<FglTFRuntimeCompactVector4> CompactTangents;
+	TArray<TArray<FglTFRuntimeCompactVector2D>> CompactUVs;
+	TArray<FglTFRuntimeCompactVector4> CompactColors;
+
 	FglTFRuntimePrimitive()
 	{
 		AdditionalBufferView = INDEX_NONE;
@@ -1678,17 +2031,145 @@ struct FglTFRuntimePrimitive
 		Mode = 4;
 		bDisableShadows = false;
 		bHasIndices = false;
+		bCompactVertexData = false;
+	}
+
+	int32 NumVertices() const { return bCompactVertexData ? CompactPositions.Num() : Positions.Num(); }
+	int32 NumNormals() const { return bCompactVertexData ? CompactNormals.Num() : Normals.Num(); }
+	int32 NumTangents() const { return bCompactVertexData ? CompactTangents.Num() : Tangents.Num(); }
+	int32 NumUVs() const { return bCompactVertexData ? CompactUVs.Num() : UVs.Num(); }
+	int32 NumUVs(const int32 UVIndex) const { return bCompactVertexData ? CompactUVs[UVIndex].Num() : UVs[UVIndex].Num(); }
+	int32 NumColors() const { return bCompactVertexData ? CompactColors.Num() : Colors.Num(); }
+
+	FVector GetPosition(const int32 Index, bool& bMissing) const
+	{
+		return bCompactVertexData ? FVector(GetSafeVertexValue(CompactPositions, Index, FglTFRuntimeCompactVector::ZeroVector, bMissing)) : GetSafeVertexValue(Positions, Index, FVector::ZeroVector, bMissing);
+	}
+
+	FVector GetNormal(const int32 Index, bool& bMissing) const
+	{
+		return bCompactVertexData ? FVector(GetSafeVertexValue(CompactNormals, Index, FglTFRuntimeCompactVector::ZeroVector, bMissing)) : GetSafeVertexValue(Normals, Index, FVector::ZeroVector, bMissing);
+	}
+
+	FVector4 GetTangent(const int32 Index, bool& bMissing) const
+	{
+		return bCompactVertexData ? FVector4(GetSafeVertexValue(CompactTangents, Index, FglTFRuntimeCompactVector4(0, 0, 0, 1), bMissing)) : GetSafeVertexValue(Tangents, Index, FVector4(0, 0, 0, 1), bMissing);
+	}
+
+	FVector2D GetUV(const int32 UVIndex, const int32 Index, bool& bMissing) const
+	{
+		return bCompactVertexData ? FVector2D(GetSafeVertexValue(CompactUVs[UVIndex], Index, FglTFRuntimeCompactVector2D::ZeroVector, bMissing)) : GetSafeVertexValue(UVs[UVIndex], Index, FVector2D::ZeroVector, bMissing);
+	}
+
+	FVector4 GetColor(const int32 Index, const FVector4& DefaultValue, bool& bMissing) const
+	{
+		return bCompactVertexData ? FVector4(GetSafeVertexValue(CompactColors, Index, FglTFRuntimeCompactVector4(DefaultValue), bMissing)) : GetSafeVertexValue(Colors, Index, DefaultValue, bMissing);
+	}
+
+	SIZE_T GetAllocatedSize() const
+	{
+		SIZE_T AllocatedSize = Positions.GetAllocatedSize() + Normals.GetAllocatedSize() + Tangents.GetAllocatedSize() + Colors.GetAllocatedSize() + Indices.GetAllocatedSize();
+		AllocatedSize += CompactPositions.GetAllocatedSize() + CompactNormals.GetAllocatedSize() + CompactTangents.GetAllocatedSize() + CompactColors.GetAllocatedSize();
+		for (const TArray<FVector2D>& UV : UVs)
+		{
+			AllocatedSize += UV.GetAllocatedSize();
+		}
+		for (const TArray<FglTFRuntimeCompactVector2D>& UV : CompactUVs)
+		{
+			AllocatedSize += UV.GetAllocatedSize();
+		}
+		for (const TArray<FglTFRuntimeUInt16Vector4>& JointsSet : Joints)
+		{
+			AllocatedSize += JointsSet.GetAllocatedSize();
+		}
+		for (const TArray<FVector4>& WeightsSet : Weights)
+		{
+			AllocatedSize += WeightsSet.GetAllocatedSize();
+		}
+		for (const FglTFRuntimeMorphTarget& MorphTarget : MorphTargets)
+		{
+			AllocatedSize += MorphTarget.Positions.GetAllocatedSize() + MorphTarget.Normals.GetAllocatedSize();
+		}
+		return AllocatedSize;
+	}
+
+	// move compact streams back to the double precision arrays (for code paths still working on them)
+	void ExpandCompactVertexData()
+	{
+		if (!bCompactVertexData)
+		{
+			return;
+		}
+
+		ExpandCompactStream(CompactPositions, Positions);
+		ExpandCompactStream(CompactNormals, Normals);
+		ExpandCompactStream(CompactTangents, Tangents);
+		UVs.SetNum(CompactUVs.Num());
+		for (int32 UVIndex = 0; UVIndex < CompactUVs.Num(); UVIndex++)
+		{
+			ExpandCompactStream(CompactUVs[UVIndex], UVs[UVIndex]);
+		}
+		CompactUVs.Empty();
+		ExpandCompactStream(CompactColors, Colors);
+
+		bCompactVertexData = false;
+	}
+
+private:
+	template<typename T>
+	static T GetSafeVertexValue(const TArray<T>& Values, const int32 Index, const T DefaultValue, bool& bMissing)
+	{
+		if (Index >= Values.Num() || Index < 0)
+		{
+			bMissing = true;
+			return DefaultValue;
+		}
+		return Values[Index];
+	}
+
+	template<typename CompactT, typename T>
+	static void ExpandCompactStream(TArray<CompactT>& CompactValues, TArray<T>& Values)
+	{
+		Values.SetNumUninitialized(CompactValues.Num());
+		for (int32 Index = 0; Index < CompactValues.Num(); Index++)
+		{
+			Values[Index] = T(CompactValues[Index]);
+		}
+		CompactValues.Empty();
 	}
 };
 
+// attributes found in a LOD by a skeletal mesh build, kept out of the LOD as it can be shared by concurrent builds
+struct FglTFRuntimeMeshLODFlags
+{
+	bool bHasNormals = false;
+	bool bHasTangents = false;
+	bool bHasUV = false;
+	bool bHasVertexColors = false;
+};
+
 struct FglTFRuntimeSkeletalMeshContext : public FGCObject
 {
 	TSharedRef<class FglTFRuntimeParser> Parser;
 
 	TArray<FglTFRuntimeMeshLOD*> LODs;
+	// parser cached LODs referenced by LODs, kept alive even if the parser cache evicts them
+	TArray<TSharedRef<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe>> CachedLODs;
+
+	void AddCachedLOD(TSharedRef<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe> LOD)
+	{
+		LODs.Add(&LOD.Get());
+		CachedLODs.Add(LOD);
+	}
+
+	// one per LOD, filled while building the render data
+	TArray<FglTFRuntimeMeshLODFlags> LODsFlags;
 
 	const FglTFRuntimeSkeletalMeshConfig SkeletalMeshConfig;
 
+	// set by the async loads, checked for cancellation while building the sections
+	FglTFRuntimeLoadHandlePtr LoadHandle;
+
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4
 	TObjectPtr<USkeletalMesh> SkeletalMesh;
 #else
@@ -1708,6 +2189,12 @@ struct FglTFRuntimeSkeletalMeshContext : public FGCObject
 	TArray<FglTFRuntimeMeshLOD> ContextLODs;
 	TMap<int32, int32> ContextLODsMap;
 
+	// vertex cache optimized copies of LODs (they can point to the parser cache)
+	TArray<FglTFRuntimeMeshLOD> OptimizedLODs;
+
+	// LODs were generated from AutoLODsTrianglesRatios
+	bool bHasAutoLODs;
+
 	const int32 MeshIndex;
 
 	FglTFRuntimeSkeletalMeshContext(TSharedRef<FglTFRuntimeParser> InParser, const int32 InMeshIndex, const FglTFRuntimeSkeletalMeshConfig& InSkeletalMeshConfig) : Parser(InParser), SkeletalMeshConfig(InSkeletalMeshConfig), MeshIndex(InMeshIndex)
@@ -1747,6 +2234,7 @@ struct FglTFRuntimeSkeletalMeshContext : public FGCObject
 		SkeletalMesh->NeverStream = true;
 		BoundingBox = FBox(EForceInit::ForceInitToZero);
 		SkinIndex = -1;
+		bHasAutoLODs = false;
 	}
 
 	FString GetReferencerName() const override
@@ -1909,9 +2397,20 @@ struct FglTFRuntimeStaticMeshContext : public FGCObject
 	TSharedRef<class FglTFRuntimeParser> Parser;
 
 	TArray<const FglTFRuntimeMeshLOD*> LODs;
+	// parser cached LODs referenced by LODs, kept alive even if the parser cache evicts them
+	TArray<TSharedRef<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe>> CachedLODs;
+
+	void AddCachedLOD(TSharedRef<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe> LOD)
+	{
+		LODs.Add(&LOD.Get());
+		CachedLODs.Add(LOD);
+	}
 
 	const FglTFRuntimeStaticMeshConfig StaticMeshConfig;
 
+	// set by the async loads, checked for cancellation while building the sections
+	FglTFRuntimeLoadHandlePtr LoadHandle;
+
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4
 	TObjectPtr<UStaticMesh> StaticMesh;
 #else
@@ -2260,6 +2759,16 @@ struct FglTFRuntimeMaterial
 	}
 };
 
+// local directory based cache for data derived from glTF assets (files are replaced atomically)
+class GLTFRUNTIME_API FglTFRuntimeDerivedDataCache
+{
+public:
+	static FString GetFilename(const FString& Directory, const FString& Key);
+	static bool Get(const FString& Directory, const FString& Key, TArray<uint8>& OutData);
+	static bool Put(const FString& Directory, const FString& Key, const TArray<uint8>& Data);
+	static FString MakeKey(const FString& Bucket, const TArray<uint8>& KeyData);
+};
+
 class GLTFRUNTIME_API FglTFRuntimeArchive
 {
 public:
@@ -2267,6 +2776,9 @@ public:
 
 	virtual bool GetFileContent(const FString& Filename, TArray64<uint8>& OutData) = 0;
 
+	// archives able to expose their items without copying should override it
+	virtual bool GetFileStorage(const FString& Filename, FglTFRuntimeBytesStoragePtr& OutStorage);
+
 	bool FileExists(const FString& Filename) const;
 
 	FString GetFirstFilenameByExtension(const FString& Extension) const;
@@ -2278,39 +2790,120 @@ public:
 
 	void Remap(const FString& From, const FString& To);
 
+	// false when reading entries could run hooks or mutate the archive state
+	virtual bool SupportsParallelReads() const
+	{
+		return true;
+	}
+
 	FString BaseDirectory;
 
 protected:
-	TMap<FString, uint32> OffsetsMap;
-	TMap<FString, TPair<uint32, uint32>> GlobalSizeMap;
+	TMap<FString, int64> OffsetsMap;
+	TMap<FString, TPair<uint64, uint64>> GlobalSizeMap;
 };
 
-class GLTFRUNTIME_API FglTFRuntimeArchiveZip : public FglTFRuntimeArchive
+class IFileHandle;
+
+/*
+* Archive backed by a storage or by an open file, entries are read on demand.
+*/
+class GLTFRUNTIME_API FglTFRuntimeArchiveRandomAccess : public FglTFRuntimeArchive
 {
 public:
-	bool FromData(const uint8* DataPtr, const int64 DataNum);
-
-	bool GetFileContent(const FString& Filename, TArray64<uint8>& OutData) override;
+	FglTFRuntimeArchiveRandomAccess();
+	virtual ~FglTFRuntimeArchiveRandomAccess();
+
+protected:
+	template<typename T>
+	static T ReadValue(const uint8* DataPtr, const int64 Offset)
+	{
+		T Value;
+		FMemory::Memcpy(&Value, DataPtr + Offset, sizeof(T));
+		return Value;
+	}
+
+	void OpenStorage(FglTFRuntimeBytesStorageRef InStorage);
+	bool OpenFile(const FString& Filename);
+
+	int64 GetArchiveSize() const;
+	// overflow safe check of [Offset, Offset + Size) against the archive size
+	bool IsValidRange(const int64 Offset, const int64 Size) const;
+	bool ReadBytes(const int64 Offset, const int64 Size, uint8* OutData) const;
+	// returns a pointer to the archive bytes, file based archives read them in Scratch
+	const uint8* GetBytes(const int64 Offset, const int64 Size, TArray64<uint8>& Scratch) const;
+
+	FglTFRuntimeBytesStoragePtr Storage;
+	TUniquePtr<IFileHandle> FileHandle;
+	int64 FileSize;
+	mutable FCriticalSection FileHandleLock;
+};
+
+class GLTFRUNTIME_API FglTFRuntimeArchiveZip : public FglTFRuntimeArchiveRandomAccess
+{
+public:
+	bool FromData(const uint8* DataPtr, const int64 DataNum);
+	bool FromStorage(FglTFRuntimeBytesStorageRef InStorage);
+	// only the central directory is loaded, entries are read (and decompressed) on demand
+	bool FromFile(const FString& Filename);
+
+	bool GetFileContent(const FString& Filename, TArray64<uint8>& OutData) override;
+	bool GetFileStorage(const FString& Filename, FglTFRuntimeBytesStoragePtr& OutStorage) override;
 
 	void SetPassword(const FString& EncryptionKey);
+	void ApplyConfig(const FglTFRuntimeConfig& LoaderConfig);
+
+	bool SupportsParallelReads() const override
+	{
+		return !PromptHook.IsBound() && !AESDecrypterHook.IsBound();
+	}
 
 	FglTFRuntimePasswordPromptHook PromptHook;
 	FglTFRuntimeAESDecrypterHook AESDecrypterHook;
 
 protected:
-	FArrayReader Data;
+	bool ParseCentralDirectory();
+	bool GetLocalEntry(const FString& Filename, uint16& Flags, uint16& Compression, int64& CompressedDataOffset, uint64& CompressedSize, uint64& UncompressedSize, TArray<uint8>& ExtraField) const;
+
 	TArray<uint8> Password;
 };
 
+/*
+* Only the tar headers are indexed, entries are views of the storage (or read from the file) when requested.
+*/
+class GLTFRUNTIME_API FglTFRuntimeArchiveTar : public FglTFRuntimeArchiveRandomAccess
+{
+public:
+	~FglTFRuntimeArchiveTar();
+
+	bool FromData(const uint8* DataPtr, const int64 DataNum);
+	bool FromStorage(FglTFRuntimeBytesStorageRef InStorage);
+	bool FromFile(const FString& Filename);
+	// inflates a gzip compressed file to TempFilename (deleted with the archive) and indexes it, no more than a chunk of data is in memory at any time
+	bool FromGzipFile(const FString& Filename, const FString& TempFilename);
+
+	bool GetFileContent(const FString& Filename, TArray64<uint8>& OutData) override;
+	bool GetFileStorage(const FString& Filename, FglTFRuntimeBytesStoragePtr& OutStorage) override;
+
+	static bool IsTar(const uint8* DataPtr, const int64 DataNum);
+
+protected:
+	bool ParseHeaders();
+
+	FString OwnedTempFilename;
+};
+
 class FglTFRuntimeArchiveMap : public FglTFRuntimeArchive
 {
 public:
 	void FromMap(const TMap<FString, TArray64<uint8>> InMap);
+	void FromStorageMap(const TMap<FString, FglTFRuntimeBytesStorageRef>& InMap);
 
 	bool GetFileContent(const FString& Filename, TArray64<uint8>& OutData) override;
+	bool GetFileStorage(const FString& Filename, FglTFRuntimeBytesStoragePtr& OutStorage) override;
 
 protected:
-	TArray<TArray64<uint8>> MapItems;
+	TArray<FglTFRuntimeBytesStorageRef> MapItems;
 };
 
 USTRUCT(BlueprintType)
@@ -2384,6 +2977,8 @@ struct FglTFRuntimePluginCacheData
 
 DECLARE_DYNAMIC_DELEGATE_OneParam(FglTFRuntimeStaticMeshAsync, UStaticMesh*, StaticMesh);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FglTFRuntimeSkeletalMeshAsync, USkeletalMesh*, SkeletalMesh);
+DECLARE_DELEGATE_OneParam(FglTFRuntimeNativeStaticMeshAsync, UStaticMesh*);
+DECLARE_DELEGATE_OneParam(FglTFRuntimeNativeSkeletalMeshAsync, USkeletalMesh*);
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FglTFRuntimeMeshLODAsync, const bool, bValid, const FglTFRuntimeMeshLOD&, MeshLOD);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FglTFRuntimeTextureCubeAsync, UTextureCube*, TextureCube);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FglTFRuntimeTexture2DAsync, UTexture2D*, Texture);
@@ -2429,28 +3024,530 @@ DECLARE_MULTICAST_DELEGATE_ThreeParams(FglTFRuntimeOnFinalizedStaticMesh, TShare
 DECLARE_MULTICAST_DELEGATE_OneParam(FglTFRuntimeOnPreInitStaticMeshResources, FglTFRuntimeStaticMeshContextRef);
 #endif
 
+/*
+* Typed views of the most accessed top level json arrays (one entry per array item, INDEX_NONE/0 for missing fields).
+* The fast json parser fills them while parsing, the default path only fills accessors and bufferViews
+* (the descriptors are resolved from them) and reads everything else from the json object.
+*/
+struct FglTFRuntimeJsonAccessor
+{
+	int32 BufferView = INDEX_NONE;
+	int64 ByteOffset = 0;
+	int32 ComponentType = 0;
+	int64 Count = 0;
+	// number of components of the "type" (0 if unknown)
+	int32 Elements = 0;
+	bool bNormalized = false;
+	bool bHasNormalized = false;
+	bool bSparse = false;
+};
+
+struct FglTFRuntimeJsonBufferView
+{
+	int32 Buffer = INDEX_NONE;
+	int64 ByteOffset = 0;
+	int64 ByteLength = 0;
+	int64 ByteStride = 0;
+	int32 Target = 0;
+	bool bHasExtensions = false;
+};
+
+struct FglTFRuntimeJsonNode
+{
+	int32 Mesh = INDEX_NONE;
+	int32 Skin = INDEX_NONE;
+	int32 Camera = INDEX_NONE;
+};
+
+enum class EglTFRuntimeCacheKind : uint8
+{
+	Buffers,
+	Images,
+	CompressedBufferViews,
+	SparseAccessors,
+	LODs,
+	Num
+};
+
+/*
+* LRU bookkeeping of a parser cache entry, lists are ordered from the least recently used (Head) to the most recently used (Tail).
+* Sizes are recorded on insertion so the budget checks never walk the caches.
+*/
+struct FglTFRuntimeCacheEntry
+{
+	FglTFRuntimeCacheEntry* Prev = nullptr;
+	FglTFRuntimeCacheEntry* Next = nullptr;
+	EglTFRuntimeCacheKind Kind = EglTFRuntimeCacheKind::Buffers;
+	int32 Index = INDEX_NONE;
+	TSharedPtr<FJsonObject> JsonMeshObject;
+	int64 Bytes = 0;
+	uint64 LastUse = 0;
+	// pinned entries (prefetched, not used yet) are not linked in the lists, so they cannot be evicted
+	bool bPinned = false;
+};
+
+struct FglTFRuntimeCacheList
+{
+	FglTFRuntimeCacheEntry* Head = nullptr;
+	FglTFRuntimeCacheEntry* Tail = nullptr;
+
+	void Append(FglTFRuntimeCacheEntry* Entry)
+	{
+		Entry->Prev = Tail;
+		Entry->Next = nullptr;
+		if (Tail)
+		{
+			Tail->Next = Entry;
+		}
+		else
+		{
+			Head = Entry;
+		}
+		Tail = Entry;
+	}
+
+	void Unlink(FglTFRuntimeCacheEntry* Entry)
+	{
+		if (Entry->Prev)
+		{
+			Entry->Prev->Next = Entry->Next;
+		}
+		else
+		{
+			Head = Entry->Next;
+		}
+		if (Entry->Next)
+		{
+			Entry->Next->Prev = Entry->Prev;
+		}
+		else
+		{
+			Tail = Entry->Prev;
+		}
+		Entry->Prev = nullptr;
+		Entry->Next = nullptr;
+	}
+};
+
+/*
+* Accessors and bufferViews resolved (and validated) once at parser construction.
+* They are never modified later, so they can be read concurrently by the mesh loaders.
+*/
+struct FglTFRuntimeBufferViewDescriptor
+{
+	int32 Buffer = INDEX_NONE;
+	int64 ByteOffset = 0;
+	int64 ByteLength = 0;
+	int64 ByteStride = 0;
+	// EXT_meshopt_compression (the fields above describe the compressed data)
+	bool bMeshOpt = false;
+	int64 MeshOptCount = 0;
+	bool bValid = false;
+};
+
+struct FglTFRuntimeAccessorDescriptor
+{
+	int32 BufferView = INDEX_NONE;
+	int64 ByteOffset = 0;
+	int64 ComponentType = 0;
+	int64 ElementSize = 0;
+	int64 Elements = 0;
+	int64 Count = 0;
+	bool bNormalized = false;
+	bool bHasNormalized = false;
+	bool bSparse = false;
+	bool bValid = false;
+	// the elements (starting at ByteOffset) fit in the bufferView
+	bool bInBounds = false;
+};
+
+enum class EglTFRuntimeJsonSection : uint8
+{
+	None,
+	Accessors,
+	BufferViews,
+	Nodes
+};
+
+struct FglTFRuntimeJsonItemRange
+{
+	int64 Offset = 0;
+	int64 Size = 0;
+};
+
+/*
+* A top level array skipped by the fast json parser: only its typed table is filled while parsing,
+* the json values of the items are built on demand from the retained source bytes.
+*/
+struct FglTFRuntimeJsonDeferredSection
+{
+	EglTFRuntimeJsonSection Section = EglTFRuntimeJsonSection::None;
+	FString FieldName;
+	// ranges in FglTFRuntimeJsonTables::Source
+	TArray<FglTFRuntimeJsonItemRange> Items;
+
+	// built by the parser (under its lock)
+	mutable TArray<TSharedPtr<FJsonValue>> Values;
+	mutable bool bMaterialized = false;
+};
+
+struct GLTFRUNTIME_API FglTFRuntimeJsonTables
+{
+	TArray<FglTFRuntimeJsonAccessor> Accessors;
+	TArray<FglTFRuntimeJsonBufferView> BufferViews;
+	TArray<FglTFRuntimeJsonNode> Nodes;
+
+	// fast parser only, the root json object has a null placeholder for these fields until they are materialized
+	TArray<FglTFRuntimeJsonDeferredSection> DeferredSections;
+	TArray64<uint8> Source;
+
+	static EglTFRuntimeJsonSection GetSection(const FString& FieldName);
+
+	// adds a default entry for a new item of the section array
+	void AddItem(const EglTFRuntimeJsonSection Section);
+	// sets a field of the last item of the section array
+	void SetItemField(const EglTFRuntimeJsonSection Section, const FString& FieldName, const FJsonValue& JsonValue);
+
+	// accessors and bufferViews only
+	void FillFromJsonObject(TSharedRef<FJsonObject> JsonObject);
+
+	const FglTFRuntimeJsonDeferredSection* FindDeferredSection(const FString& FieldName) const;
+};
+
 namespace glTFRuntime
 {
-	GLTFRUNTIME_API bool FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData, const TArray<FglTFRuntimeMeshLOD*>& LODs, const FReferenceSkeleton& RefSkeleton, const int32 SkinIndex, const TMap<int32, FName>& MainBoneMap, FBox& BoundingBox, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, TFunction<void(const FString& ErrorContext, const FString& ErrorMessage)> ErrorCallback);
+	// single pass UTF-8 json parser, filling the typed tables and deferring the json values of their items
+	GLTFRUNTIME_API bool ParseJson(const uint8* DataPtr, const int64 DataNum, TSharedPtr<FJsonObject>& JsonObject, FglTFRuntimeJsonTables& JsonTables);
+
+	// returns false without errors if LoadHandle (optional) is cancelled while building the sections, the LODs are only read
+	GLTFRUNTIME_API bool FillSkeletalMeshRenderData(FSkeletalMeshRenderData* RenderData, const TArray<FglTFRuntimeMeshLOD*>& LODs, const FReferenceSkeleton& RefSkeleton, const int32 SkinIndex, const TMap<int32, FName>& MainBoneMap, FBox& BoundingBox, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, TFunction<void(const FString& ErrorContext, const FString& ErrorMessage)> ErrorCallback, FglTFRuntimeLoadHandlePtr LoadHandle = nullptr, TArray<FglTFRuntimeMeshLODFlags>* OutLODsFlags = nullptr);
 	GLTFRUNTIME_API FVector ComputeTangentY(const FVector Normal, const FVector TangetX);
 	GLTFRUNTIME_API FVector ComputeTangentYWithW(const FVector Normal, const FVector TangetX, const float W);
+	// LODs are spread linearly from 1 (LOD0), a bigger Multiplier keeps them closer to 1
+	GLTFRUNTIME_API float GetDefaultLODScreenSize(const int32 LODIndex, const int32 NumLODs, const float Multiplier);
+
+	// in place exclusive prefix sum, computed in blocks, returns the total
+	GLTFRUNTIME_API int32 ParallelExclusivePrefixSum(TArray<int32>& Values);
+
+	// vertex -> triangle corners adjacency in compressed sparse row form (corner = TriangleIndex * 3 + CornerIndex)
+	struct GLTFRUNTIME_API FTriangleAdjacency
+	{
+		TArray<int32> Offsets;
+		TArray<int32> Corners;
+
+		// lock free (atomic counters + parallel prefix sum), triangles referencing invalid vertices are skipped
+		void Build(const TArrayView<const uint32> Indices, const int32 NumVertices);
+	};
+
+	// groups vertices within Tolerance of the lowest vertex of their group (exact match when 0), Offsets/Vertices are the groups in CSR form
+	GLTFRUNTIME_API void WeldVertices(const TArrayView<const FVector> Positions, const float Tolerance, TArray<int32>& Offsets, TArray<int32>& Vertices, TArray<int32>& VertexGroups);
+
+	// area and angle weighted vertex normals, with welding the faces of vertices in the same position are included when within CreaseAngle (degrees)
+	GLTFRUNTIME_API void ComputeSmoothNormals(const TArrayView<const FVector> Positions, const TArrayView<const uint32> Indices, TArray<FVector>& Normals, const bool bWeldVertices = false, const float WeldTolerance = 0, const float CreaseAngle = 180);
+
+	// MikkTSpace style tangents (W is the bitangent sign, as stored in glTF tangents), a vertex gets the corners of its dominant uv orientation
+	GLTFRUNTIME_API void ComputeMikkTSpaceTangents(const TArrayView<const FVector> Positions, const TArrayView<const FVector> Normals, const TArrayView<const FVector2D> UVs, const TArrayView<const uint32> Indices, TArray<FVector4>& Tangents);
+
+	// vertex shader invocations of a FIFO post-transform cache of CacheSize entries
+	GLTFRUNTIME_API int64 CountVertexCacheMisses(const TArrayView<const uint32> Indices, const int32 NumVertices, const int32 CacheSize);
+
+	// Tipsify triangle reordering (in place), fails (leaving Indices untouched) on invalid indices
+	GLTFRUNTIME_API bool OptimizeVertexCache(TArrayView<uint32> Indices, const int32 NumVertices, const int32 CacheSize);
+
+	// renumbers vertices in first use order, NewToOld maps the new vertices to the old ones (unreferenced vertices go last)
+	GLTFRUNTIME_API void OptimizeVertexFetch(TArrayView<uint32> Indices, const int32 NumVertices, TArray<int32>& NewToOld);
+
+	// Tipsify overdraw pass on a vertex cache optimized order (in place): splits it in clusters whose ACMR is within Threshold (>= 1) of the original one
+	// and sorts them by a view independent occlusion estimate, fails (leaving Indices untouched) on invalid indices
+	GLTFRUNTIME_API bool OptimizeOverdraw(TArrayView<uint32> Indices, const TArrayView<const FVector> Positions, const int32 CacheSize, const float Threshold);
+
+	// all the passes on a section (the overdraw one only with positions and a threshold >= 1), with before/after stats
+	GLTFRUNTIME_API bool OptimizeSection(TArrayView<uint32> Indices, const int32 NumVertices, const int32 CacheSize, TArray<int32>& NewToOld, FglTFRuntimeMeshOptimizationStats& Stats, const TArrayView<const FVector> Positions = TArrayView<const FVector>(), const float OverdrawThreshold = 0);
+
+	// applies a vertex order to every vertex stream (morph targets and weight maps included), NewToOld can be shorter than the vertices for compacting them
+	GLTFRUNTIME_API void RemapPrimitiveVertices(FglTFRuntimePrimitive& Primitive, const TArray<int32>& NewToOld);
+
+	// quadric error half edge collapses down to TargetNumTriangles (or until no valid collapse is left), locked vertices never move, returns the number of triangles
+	GLTFRUNTIME_API int32 SimplifyMesh(const TArrayView<const FVector> Positions, const TArrayView<const uint32> Indices, const TArrayView<const bool> LockedVertices, const int32 TargetNumTriangles, TArray<uint32>& OutIndices);
+
+	// vertices are only collapsed into existing ones (skin weights and morph targets are kept as is), attribute seams and open borders are locked
+	GLTFRUNTIME_API void SimplifyPrimitive(const FglTFRuntimePrimitive& Primitive, const float TrianglesRatio, FglTFRuntimePrimitive& OutPrimitive);
+
+	// one simplified LOD per ratio (of the triangles to keep), every LOD and primitive is processed in parallel
+	GLTFRUNTIME_API void GenerateSimplifiedLODs(const FglTFRuntimeMeshLOD& LOD, const TArray<float>& TrianglesRatios, TArray<FglTFRuntimeMeshLOD>& OutLODs);
+
+	// merges the vertices with positions within Tolerance and every attribute within AttributesTolerance (joints must match exactly),
+	// vertices are bucketed in a parallel built hash table of Tolerance sized cells and keep their original order, returns the number of removed vertices.
+	// Primitives without normals are left untouched (generating them on the shared vertices would smooth flat shaded faces)
+	GLTFRUNTIME_API int32 WeldPrimitiveVertices(FglTFRuntimePrimitive& Primitive, const float Tolerance, const float AttributesTolerance);
+
+	// decodes every Zstd frame (skippable frames are ignored), frames with a known content size are decoded in parallel
+	GLTFRUNTIME_API bool ZstdDecompress(const uint8* DataPtr, const int64 DataNum, TArray64<uint8>& UncompressedData, FglTFRuntimeLoaderStats& LoaderStats);
+
+	// accessors are decoded in blocks of elements, each block is a single ParallelFor task
+	constexpr int64 AccessorBlockSize = 4096;
+
+	// raw component (normalization follows the glTF 2.0 spec for integer types)
+	template<typename ComponentT, bool bNormalized>
+	struct TAccessorComponentDecoder
+	{
+		static FORCEINLINE ComponentT Decode(const uint8* Ptr)
+		{
+			ComponentT Value;
+			FMemory::Memcpy(&Value, Ptr, sizeof(ComponentT));
+			return Value;
+		}
+	};
+
+	template<>
+	struct TAccessorComponentDecoder<int8, true>
+	{
+		static FORCEINLINE float Decode(const uint8* Ptr) { return FMath::Max(static_cast<float>(*reinterpret_cast<const int8*>(Ptr)) / 127.f, -1.f); }
+	};
+
+	template<>
+	struct TAccessorComponentDecoder<uint8, true>
+	{
+		static FORCEINLINE float Decode(const uint8* Ptr) { return static_cast<float>(*Ptr) / 255.f; }
+	};
+
+	template<>
+	struct TAccessorComponentDecoder<int16, true>
+	{
+		static FORCEINLINE float Decode(const uint8* Ptr) { return FMath::Max(static_cast<float>(TAccessorComponentDecoder<int16, false>::Decode(Ptr)) / 32767.f, -1.f); }
+	};
+
+	template<>
+	struct TAccessorComponentDecoder<uint16, true>
+	{
+		static FORCEINLINE float Decode(const uint8* Ptr) { return static_cast<float>(TAccessorComponentDecoder<uint16, false>::Decode(Ptr)) / 65535.f; }
+	};
+
+	template<bool bScalar>
+	struct TAccessorValueDecoder
+	{
+		template<typename T, typename ComponentT, bool bNormalized>
+		static FORCEINLINE void Decode(const uint8* Ptr, const int64 Elements, T& Value)
+		{
+			for (int64 ComponentIndex = 0; ComponentIndex < Elements; ComponentIndex++)
+			{
+				Value[ComponentIndex] = TAccessorComponentDecoder<ComponentT, bNormalized>::Decode(Ptr + ComponentIndex * sizeof(ComponentT));
+			}
+		}
+	};
+
+	template<>
+	struct TAccessorValueDecoder<true>
+	{
+		template<typename T, typename ComponentT, bool bNormalized>
+		static FORCEINLINE void Decode(const uint8* Ptr, const int64 Elements, T& Value)
+		{
+			Value = TAccessorComponentDecoder<ComponentT, bNormalized>::Decode(Ptr);
+		}
+	};
+
+	/*
+	* Decoding kernel, specialized on component type, number of elements (0 means unknown at compile time), normalization and tight packing.
+	* When everything is known the inner loops are fully unrolled and the compiler is free to vectorize them and to inline the Filter.
+	* The resulting range decoder is handed to the Runner, that either runs it immediately or stores it for a fused pass.
+	*/
+	template<typename T, typename ComponentT, int32 NumElements, bool bNormalized, bool bPacked, bool bScalar, typename Callback, typename Runner>
+	void DecodeAccessor(const uint8* Data, const int64 Stride, const int64 Elements, T* Output, const Callback& Filter, Runner& InRunner)
+	{
+		const int64 LoopElements = NumElements > 0 ? NumElements : Elements;
+		const int64 ElementStride = bPacked ? sizeof(ComponentT) * LoopElements : Stride;
+
+		InRunner([Data, ElementStride, LoopElements, Output, Filter](const int64 FirstElement, const int64 LastElement)
+			{
+				const uint8* Ptr = Data + FirstElement * ElementStride;
+				for (int64 ElementIndex = FirstElement; ElementIndex < LastElement; ElementIndex++)
+				{
+					T Value;
+					TAccessorValueDecoder<bScalar>::template Decode<T, ComponentT, bNormalized>(Ptr, LoopElements, Value);
+					Output[ElementIndex] = Filter(Value);
+					Ptr += ElementStride;
+				}
+			});
+	}
+
+	template<typename T, typename ComponentT, bool bNormalized, bool bScalar, typename Callback, typename Runner>
+	void DecodeAccessorElements(const uint8* Data, const int64 Stride, const int64 Elements, T* Output, const Callback& Filter, Runner& InRunner)
+	{
+		// tightly packed buffer views get a constant stride
+		if (Stride == static_cast<int64>(sizeof(ComponentT)) * Elements)
+		{
+			switch (Elements)
+			{
+			case 1:
+				DecodeAccessor<T, ComponentT, 1, bNormalized, true, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+				return;
+			case 2:
+				DecodeAccessor<T, ComponentT, 2, bNormalized, true, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+				return;
+			case 3:
+				DecodeAccessor<T, ComponentT, 3, bNormalized, true, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+				return;
+			case 4:
+				DecodeAccessor<T, ComponentT, 4, bNormalized, true, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+				return;
+			default:
+				break;
+			}
+		}
+
+		switch (Elements)
+		{
+		case 1:
+			DecodeAccessor<T, ComponentT, 1, bNormalized, false, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+			return;
+		case 2:
+			DecodeAccessor<T, ComponentT, 2, bNormalized, false, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+			return;
+		case 3:
+			DecodeAccessor<T, ComponentT, 3, bNormalized, false, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+			return;
+		case 4:
+			DecodeAccessor<T, ComponentT, 4, bNormalized, false, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+			return;
+		default:
+			DecodeAccessor<T, ComponentT, 0, bNormalized, false, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+			return;
+		}
+	}
+
+	template<typename T, bool bScalar, typename Callback, typename Runner>
+	bool DispatchAccessorDecoder(const int64 ComponentType, const bool bNormalized, const uint8* Data, const int64 Stride, const int64 Elements, T* Output, const Callback& Filter, Runner& InRunner)
+	{
+		switch (ComponentType)
+		{
+		case(5126):// FLOAT
+			DecodeAccessorElements<T, float, false, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+			return true;
+		case(5120):// BYTE
+			if (bNormalized)
+			{
+				DecodeAccessorElements<T, int8, true, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+			}
+			else
+			{
+				DecodeAccessorElements<T, int8, false, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+			}
+			return true;
+		case(5121):// UNSIGNED_BYTE
+			if (bNormalized)
+			{
+				DecodeAccessorElements<T, uint8, true, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+			}
+			else
+			{
+				DecodeAccessorElements<T, uint8, false, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+			}
+			return true;
+		case(5122):// SHORT
+			if (bNormalized)
+			{
+				DecodeAccessorElements<T, int16, true, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+			}
+			else
+			{
+				DecodeAccessorElements<T, int16, false, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+			}
+			return true;
+		case(5123):// UNSIGNED_SHORT
+			if (bNormalized)
+			{
+				DecodeAccessorElements<T, uint16, true, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+			}
+			else
+			{
+				DecodeAccessorElements<T, uint16, false, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+			}
+			return true;
+		case(5125):// UNSIGNED_INT (only for indices, never normalized)
+			DecodeAccessorElements<T, uint32, false, bScalar>(Data, Stride, Elements, Output, Filter, InRunner);
+			return true;
+		default:
+			break;
+		}
+
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
+		return false;
+	}
+
+	// runs the range decoder immediately, one ParallelFor task per block
+	struct FAccessorParallelRunner
+	{
+		int64 Count;
+
+		template<typename RangeDecoder>
+		void operator()(const RangeDecoder& Decoder) const
+		{
+			const int32 NumBlocks = static_cast<int32>((Count + AccessorBlockSize - 1) / AccessorBlockSize);
+			ParallelFor(NumBlocks, [&](const int32 BlockIndex)
+				{
+					const int64 FirstElement = static_cast<int64>(BlockIndex) * AccessorBlockSize;
+					Decoder(FirstElement, FMath::Min(FirstElement + AccessorBlockSize, Count));
+				}, NumBlocks < 2);
+		}
+	};
+
+	template<typename T, bool bScalar, typename Callback>
+	bool DecodeAccessorComponents(const int64 ComponentType, const bool bNormalized, const uint8* Data, const int64 Stride, const int64 Count, const int64 Elements, T* Output, const Callback& Filter)
+	{
+		FAccessorParallelRunner Runner = { Count };
+		return DispatchAccessorDecoder<T, bScalar>(ComponentType, bNormalized, Data, Stride, Elements, Output, Filter, Runner);
+	}
+
+	/*
+	* An accessor bound to its destination, decoded later together with the other streams of the same primitive.
+	* Storage keeps the source bytes alive until the fused pass is done.
+	*/
+	struct FAccessorStream
+	{
+		TFunction<void(const int64 FirstElement, const int64 LastElement)> Decoder;
+		int64 Count = 0;
+		FglTFRuntimeBytesStoragePtr Storage;
+
+		template<typename RangeDecoder>
+		void operator()(const RangeDecoder& InDecoder)
+		{
+			Decoder = InDecoder;
+		}
+	};
+
+	// walks the vertex range once in blocks, every stream decodes the same block before moving to the next one
+	GLTFRUNTIME_API void DecodeAccessorStreams(const TArray<FAccessorStream>& Streams);
 }
 
 /**
- *
+ * Thread safety: once constructed, a parser can be used by multiple worker threads at the same time for building
+ * runtime LODs (and the meshes/skins/textures data depending on them). The lazily filled caches (buffers, bufferViews,
+ * sparse accessors, images, LODs, nodes and the UObject caches) are protected by fine-grained locks held only for lookups
+ * and insertions (never while decoding, the first inserted value wins when two threads decode the same item), accessors and
+ * bufferViews descriptors are immutable. Cached LODs are shared and never written by the mesh builds (their per build
+ * state lives in the mesh contexts). UObjects creation is still delegated to the game thread.
+ * Configuration (SetBaseDirectory, UpdateSceneBasis...) and GetErrors() are not meant to be called while loads are running.
+ * On UE4 shared pointers must be thread safe (FORCE_THREADSAFE_SHAREDPTRS) as json objects are shared between threads.
  */
 class GLTFRUNTIME_API FglTFRuntimeParser : public FGCObject, public TSharedFromThis<FglTFRuntimeParser>
 {
 public:
 	FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const FMatrix& InSceneBasis, float InSceneScale);
+	// InJsonTables must describe JsonObject (see glTFRuntime::ParseJson and FglTFRuntimeJsonTables::FillFromJsonObject)
+	FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, FglTFRuntimeJsonTables&& InJsonTables, const FMatrix& InSceneBasis, float InSceneScale);
 
 	static TSharedPtr<FglTFRuntimeParser> FromFilename(const FString& Filename, const FglTFRuntimeConfig& LoaderConfig);
-	static TSharedPtr<FglTFRuntimeParser> FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr);
+	// when InStorage is valid it must own DataPtr: the parser will reference it instead of copying the binary payload
+	static TSharedPtr<FglTFRuntimeParser> FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr, FglTFRuntimeBytesStoragePtr InStorage = nullptr);
 	static TSharedPtr<FglTFRuntimeParser> FromString(const FString& JsonData, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr);
-	static TSharedPtr<FglTFRuntimeParser> FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig);
+	static TSharedPtr<FglTFRuntimeParser> FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, FglTFRuntimeBytesStoragePtr InStorage = nullptr);
 	static TSharedPtr<FglTFRuntimeParser> FromMap(const TMap<FString, TArray64<uint8>> Map, const FglTFRuntimeConfig& LoaderConfig);
+	static TSharedPtr<FglTFRuntimeParser> FromStorage(FglTFRuntimeBytesStorageRef InStorage, const FglTFRuntimeConfig& LoaderConfig);
 
-	static TSharedPtr<FglTFRuntimeParser> FromRawDataAndArchive(const uint8* DataPtr, int64 DataNum, TSharedPtr<FglTFRuntimeArchive> InArchive, const FglTFRuntimeConfig& LoaderConfig);
+	static TSharedPtr<FglTFRuntimeParser> FromRawDataAndArchive(const uint8* DataPtr, int64 DataNum, TSharedPtr<FglTFRuntimeArchive> InArchive, const FglTFRuntimeConfig& LoaderConfig, FglTFRuntimeBytesStoragePtr InStorage = nullptr);
+	// json text (UTF-8), honors LoaderConfig.bUseFastJsonParser
+	static TSharedPtr<FglTFRuntimeParser> FromUTF8(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr);
+	static TSharedPtr<FglTFRuntimeParser> FromJsonObject(TSharedRef<FJsonObject> JsonObject, FglTFRuntimeJsonTables&& JsonTables, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr);
 
 	static FORCEINLINE TSharedPtr<FglTFRuntimeParser> FromBinary(const TArray<uint8> Data, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr) { return FromBinary(Data.GetData(), Data.Num(), LoaderConfig, InArchive); }
 	static FORCEINLINE TSharedPtr<FglTFRuntimeParser> FromBinary(const TArray64<uint8> Data, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr) { return FromBinary(Data.GetData(), Data.Num(), LoaderConfig, InArchive); }
@@ -2459,7 +3556,7 @@ public:
 
 	bool LoadMeshAsRuntimeLOD(const int32 MeshIndex, FglTFRuntimeMeshLOD& RuntimeLOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
 	bool LoadSkinnedMeshRecursiveAsRuntimeLOD(const FString& NodeName, int32& SkinIndex, const TArray<FString>& ExcludeNodes, FglTFRuntimeMeshLOD& RuntimeLOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const FglTFRuntimeSkeletonConfig& SkeletonConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode);
-	void LoadSkinnedMeshRecursiveAsRuntimeLODAsync(const FString& NodeName, int32& SkinIndex, const TArray<FString>& ExcludeNodes, const FglTFRuntimeMeshLODAsync& AsyncCallback, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const FglTFRuntimeSkeletonConfig& SkeletonConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode);
+	FglTFRuntimeLoadHandleRef LoadSkinnedMeshRecursiveAsRuntimeLODAsync(const FString& NodeName, int32& SkinIndex, const TArray<FString>& ExcludeNodes, const FglTFRuntimeMeshLODAsync& AsyncCallback, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const FglTFRuntimeSkeletonConfig& SkeletonConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode);
 
 	UStaticMesh* LoadStaticMeshFromRuntimeLODs(const TArray<FglTFRuntimeMeshLOD>& RuntimeLODs, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig);
 	void LoadStaticMeshFromRuntimeLODsAsync(const TArray<FglTFRuntimeMeshLOD>& RuntimeLODs, const FglTFRuntimeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig);
@@ -2469,7 +3566,7 @@ public:
 	TArray<UStaticMesh*> LoadStaticMeshesFromPrimitives(const int32 MeshIndex, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig);
 
 	UStaticMesh* LoadStaticMeshRecursive(const FString& NodeName, const TArray<FString>& ExcludeNodes, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig);
-	void LoadStaticMeshRecursiveAsync(const FString& NodeName, const TArray<FString>& ExcludeNodes, const FglTFRuntimeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig);
+	FglTFRuntimeLoadHandleRef LoadStaticMeshRecursiveAsync(const FString& NodeName, const TArray<FString>& ExcludeNodes, const FglTFRuntimeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig);
 
 	UStaticMesh* LoadStaticMeshLODs(const TArray<int32>& MeshIndices, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig);
 
@@ -2520,17 +3617,19 @@ public:
 
 	FglTFRuntimePoseTracksMap FixupAnimationTracks(const FglTFRuntimePoseTracksMap& Tracks, const TMap<FString, FTransform>& RestTransforms, const FglTFRuntimeSkeletalAnimationConfig& SkeletalAnimationConfig);
 
-	void LoadSkeletalMeshAsync(const int32 MeshIndex, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshAsync& AsyncCallback, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig);
-	void LoadStaticMeshAsync(const int32 MeshIndex, const FglTFRuntimeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig);
+	FglTFRuntimeLoadHandleRef LoadSkeletalMeshAsync(const int32 MeshIndex, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshAsync& AsyncCallback, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig);
+	FglTFRuntimeLoadHandleRef LoadSkeletalMeshAsync(const int32 MeshIndex, const int32 SkinIndex, const FglTFRuntimeNativeSkeletalMeshAsync& AsyncCallback, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig);
+	FglTFRuntimeLoadHandleRef LoadStaticMeshAsync(const int32 MeshIndex, const FglTFRuntimeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig);
+	FglTFRuntimeLoadHandleRef LoadStaticMeshAsync(const int32 MeshIndex, const FglTFRuntimeNativeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig);
 
 	void LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndices, const FglTFRuntimeStaticMeshAsync& AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig);
 
-	void LoadMeshAsRuntimeLODAsync(const int32 MeshIndex, const FglTFRuntimeMeshLODAsync& AsyncCallback, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
+	FglTFRuntimeLoadHandleRef LoadMeshAsRuntimeLODAsync(const int32 MeshIndex, const FglTFRuntimeMeshLODAsync& AsyncCallback, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
 
 	USkeletalMesh* LoadSkeletalMeshLODs(const TArray<int32>& MeshIndices, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig);
 
 	USkeletalMesh* LoadSkeletalMeshRecursive(const FString& NodeName, const int32 SkinIndex, const TArray<FString>& ExcludeNodes, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode);
-	void LoadSkeletalMeshRecursiveAsync(const FString& NodeName, const int32 SkinIndex, const TArray<FString>& ExcludeNodes, const FglTFRuntimeSkeletalMeshAsync& AsyncCallback, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode);
+	FglTFRuntimeLoadHandleRef LoadSkeletalMeshRecursiveAsync(const FString& NodeName, const int32 SkinIndex, const TArray<FString>& ExcludeNodes, const FglTFRuntimeSkeletalMeshAsync& AsyncCallback, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode);
 
 	UglTFRuntimeAnimationCurve* LoadNodeAnimationCurve(const int32 NodeIndex);
 	TArray<UglTFRuntimeAnimationCurve*> LoadAllNodeAnimationCurves(const int32 NodeIndex);
@@ -2551,6 +3650,8 @@ public:
 	int64 GetTypeSize(const FString& Type) const;
 
 	bool ParseBase64Uri(const FString& Uri, TArray64<uint8>& Bytes);
+	// false when the object has no string uri
+	bool GetJsonObjectUri(TSharedRef<FJsonObject> JsonObject, FString& OutUri) const;
 
 	FString GetReferencerName() const override
 	{
@@ -2559,8 +3660,9 @@ public:
 
 	void AddReferencedObjects(FReferenceCollector& Collector);
 
-	bool LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject, TArray<FglTFRuntimePrimitive>& Primitives, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines);
+	bool LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject, TArray<FglTFRuntimePrimitive>& Primitives, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines, FglTFRuntimeLoadHandlePtr LoadHandle = nullptr);
 	bool LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bTriangulatePointsAndLines);
+	bool LoadPrimitiveMaterial(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig, UMaterialInterface* ForceBaseMaterial);
 	UMaterialInterface* TriangulatePoints(FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
 	UMaterialInterface* TriangulateLines(FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
 	UMaterialInterface* TriangulatePointsAndLines(FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
@@ -2584,6 +3686,11 @@ public:
 	FglTFRuntimeOnSkeletalMeshCreated OnSkeletalMeshCreated;
 
 	void SetBinaryBuffer(const TArray64<uint8>& InBinaryBuffer)
+	{
+		BinaryBuffer = FglTFRuntimeBytesStorage::FromCopy(InBinaryBuffer.GetData(), InBinaryBuffer.Num());
+	}
+
+	void SetBinaryBuffer(FglTFRuntimeBytesStorageRef InBinaryBuffer)
 	{
 		BinaryBuffer = InBinaryBuffer;
 	}
@@ -2637,7 +3744,8 @@ public:
 
 	TArray<FString> MaterialsVariants;
 
-	TSharedPtr<FJsonObject> GetJsonRoot() const { return Root; }
+	// materializes the deferred sections, so the whole json object can be walked
+	TSharedPtr<FJsonObject> GetJsonRoot() const;
 
 	static FVector4 CubicSpline(const float TC, const float T0, const float T1, const FVector4 Value0, const FVector4 OutTangent, const FVector4 Value1, const FVector4 InTangent);
 
@@ -2682,10 +3790,12 @@ public:
 		TArray64<uint8> NewArray;
 		NewArray.Append(reinterpret_cast<const uint8*>(Data), Num);
 
-		int32 NewIndex = AdditionalBufferViewsData.Add(MoveTemp(NewArray));
-
 		FglTFRuntimeBlob Blob;
-		Blob.Data = AdditionalBufferViewsData[NewIndex].GetData();
+		{
+			FScopeLock Lock(&CachesLock);
+			int32 NewIndex = AdditionalBufferViewsData.Add(MoveTemp(NewArray));
+			Blob.Data = AdditionalBufferViewsData[NewIndex].GetData();
+		}
 		Blob.Num = Num;
 
 		AddAdditionalBufferView(Index, Name, Blob);
@@ -2742,6 +3852,19 @@ public:
 
 	void ClearCache();
 
+	FglTFRuntimeCacheStats GetCacheStats() const;
+	const FglTFRuntimeLoaderStats& GetLoaderStats() const { return LoaderStats; }
+	FglTFRuntimeMeshOptimizationStats GetMeshOptimizationStats() const;
+	void AddMeshOptimizationStats(const FglTFRuntimeMeshOptimizationStats& Stats);
+	const FglTFRuntimeJsonTables& GetJsonTables() const { return JsonTables; }
+	const FglTFRuntimeAccessorDescriptor* GetAccessorDescriptor(const int32 AccessorIndex) const;
+	const FglTFRuntimeBufferViewDescriptor* GetBufferViewDescriptor(const int32 BufferViewIndex) const;
+	// evicts the least recently used binary cache entries until the budget is honored, LODs only when requested (their users keep their own references)
+	void TrimCache(const bool bIncludeLODs);
+
+	// fills the buffers and images caches with the archive entries they reference, decompressing them in parallel
+	void PrefetchArchiveEntries();
+
 	void MergePrimitivesByMaterial(TArray<FglTFRuntimePrimitive>& Primitives);
 
 	bool MeshHasMorphTargets(const int32 MeshIndex) const;
@@ -2770,10 +3893,136 @@ protected:
 	TMap<int32, UTexture2D*> TexturesCache;
 #endif
 
-	TMap<int32, TArray64<uint8>> BuffersCache;
-	TMap<int32, TArray64<uint8>> CompressedBufferViewsCache;
+	TMap<int32, FglTFRuntimeBytesStorageRef> BuffersCache;
+	// prefetched image bytes, each entry is released once consumed
+	TMap<int32, FglTFRuntimeBytesStorageRef> ImagesCache;
+	TMap<int32, FglTFRuntimeBytesStorageRef> CompressedBufferViewsCache;
 	TMap<int32, int64> CompressedBufferViewsStridesCache;
 
+	FglTFRuntimeLoaderStats LoaderStats;
+	FglTFRuntimeMeshOptimizationStats MeshOptimizationStats;
+	FglTFRuntimeJsonTables JsonTables;
+	mutable FCriticalSection DeferredJsonLock;
+	mutable std::atomic<bool> bJsonSectionsMaterialized{ false };
+	TSharedPtr<FJsonValue> GetDeferredJsonValue(const FglTFRuntimeJsonDeferredSection& DeferredSection, const int32 Index) const;
+	// replaces the placeholder of a deferred section in the root json object with the array of its items
+	void MaterializeJsonSection(const FString& FieldName) const;
+	void MaterializeJsonSections() const;
+	TArray<FglTFRuntimeAccessorDescriptor> AccessorDescriptors;
+	TArray<FglTFRuntimeBufferViewDescriptor> BufferViewDescriptors;
+
+	void ResolveDescriptors();
+
+	int64 CacheBytesBudget;
+	uint64 CacheUseCounter;
+	TMap<int32, TUniquePtr<FglTFRuntimeCacheEntry>> BuffersCacheEntries;
+	TMap<int32, TUniquePtr<FglTFRuntimeCacheEntry>> ImagesCacheEntries;
+	TMap<int32, TUniquePtr<FglTFRuntimeCacheEntry>> CompressedBufferViewsCacheEntries;
+	TMap<int32, TUniquePtr<FglTFRuntimeCacheEntry>> SparseAccessorsCacheEntries;
+	TMap<TSharedRef<FJsonObject>, TUniquePtr<FglTFRuntimeCacheEntry>> LODsCacheEntries;
+	// LODs have their own list as they are evicted only on request
+	FglTFRuntimeCacheList BinaryCacheList;
+	FglTFRuntimeCacheList LODsCacheList;
+	int64 CachedBytes[static_cast<int32>(EglTFRuntimeCacheKind::Num)];
+	// pinned bytes are part of CachedBytes, they count against the budget but cannot be evicted
+	int64 PinnedCacheBytes;
+	// avoids logging the same budget overflow on every insertion
+	bool bCacheOverBudgetLogged;
+
+	// protects the binary and LODs caches (and their last use counters)
+	mutable FCriticalSection CachesLock;
+	// protects AllNodesCache
+	FCriticalSection NodesLock;
+	// protects the UObjects caches
+	mutable FCriticalSection ObjectsCacheLock;
+	FCriticalSection ErrorsLock;
+	mutable FCriticalSection MeshOptimizationStatsLock;
+
+	template<typename KeyType>
+	void TouchCacheEntry(TMap<KeyType, TUniquePtr<FglTFRuntimeCacheEntry>>& CacheEntries, const KeyType& Key)
+	{
+		FScopeLock Lock(&CachesLock);
+		if (TUniquePtr<FglTFRuntimeCacheEntry>* Entry = CacheEntries.Find(Key))
+		{
+			FglTFRuntimeCacheList& CacheList = (*Entry)->Kind == EglTFRuntimeCacheKind::LODs ? LODsCacheList : BinaryCacheList;
+			// the first use releases the pin
+			if ((*Entry)->bPinned)
+			{
+				(*Entry)->bPinned = false;
+				PinnedCacheBytes -= (*Entry)->Bytes;
+			}
+			else
+			{
+				CacheList.Unlink(Entry->Get());
+			}
+			CacheList.Append(Entry->Get());
+			(*Entry)->LastUse = ++CacheUseCounter;
+		}
+	}
+
+	static void SetCacheEntryKey(FglTFRuntimeCacheEntry& Entry, const int32 Key) { Entry.Index = Key; }
+	static void SetCacheEntryKey(FglTFRuntimeCacheEntry& Entry, const TSharedRef<FJsonObject>& Key) { Entry.JsonMeshObject = Key; }
+
+	template<typename KeyType>
+	FglTFRuntimeCacheEntry* AddCacheEntry(TMap<KeyType, TUniquePtr<FglTFRuntimeCacheEntry>>& CacheEntries, const KeyType& Key, const EglTFRuntimeCacheKind Kind, const int64 Bytes, const bool bPinned = false)
+	{
+		FScopeLock Lock(&CachesLock);
+		TUniquePtr<FglTFRuntimeCacheEntry> NewEntry = MakeUnique<FglTFRuntimeCacheEntry>();
+		NewEntry->Kind = Kind;
+		NewEntry->Bytes = Bytes;
+		NewEntry->LastUse = ++CacheUseCounter;
+		NewEntry->bPinned = bPinned;
+		SetCacheEntryKey(*NewEntry, Key);
+		FglTFRuntimeCacheEntry* Entry = NewEntry.Get();
+		if (bPinned)
+		{
+			PinnedCacheBytes += Bytes;
+		}
+		else
+		{
+			(Kind == EglTFRuntimeCacheKind::LODs ? LODsCacheList : BinaryCacheList).Append(Entry);
+		}
+		CachedBytes[static_cast<int32>(Kind)] += Bytes;
+		CacheEntries.Add(Key, MoveTemp(NewEntry));
+		return Entry;
+	}
+
+	// removes the entry (and its cached value) from the cache it belongs to
+	void RemoveFromCache(FglTFRuntimeCacheEntry* Entry);
+	void TrimCache(const bool bIncludeLODs, const FglTFRuntimeCacheEntry* ExemptEntry);
+
+	template<typename ObjectType, typename CacheType, typename KeyType>
+	ObjectType* FindInObjectsCache(const CacheType& Cache, const KeyType& Key) const
+	{
+		FScopeLock Lock(&ObjectsCacheLock);
+		if (const auto* Value = Cache.Find(Key))
+		{
+			return *Value;
+		}
+		return nullptr;
+	}
+
+	template<typename CacheType, typename KeyType, typename ObjectType>
+	void AddToObjectsCache(CacheType& Cache, const KeyType& Key, const ObjectType& Object)
+	{
+		FScopeLock Lock(&ObjectsCacheLock);
+		Cache.Add(Key, Object);
+	}
+
+	// if another thread already cached the same key, its storage is returned (the new entry is never evicted by its own insertion)
+	FglTFRuntimeBytesStorageRef AddToCache(TMap<int32, FglTFRuntimeBytesStorageRef>& Cache, TMap<int32, TUniquePtr<FglTFRuntimeCacheEntry>>& CacheEntries, const EglTFRuntimeCacheKind Kind, const int32 Key, FglTFRuntimeBytesStorageRef Storage, const bool bPinned = false)
+	{
+		FScopeLock Lock(&CachesLock);
+		if (FglTFRuntimeBytesStorageRef* CachedStorage = Cache.Find(Key))
+		{
+			TouchCacheEntry(CacheEntries, Key);
+			return *CachedStorage;
+		}
+		Cache.Add(Key, Storage);
+		TrimCache(false, AddCacheEntry(CacheEntries, Key, Kind, Storage->Num(), bPinned));
+		return Storage;
+	}
+
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4
 	TMap<TObjectPtr<UMaterialInterface>, FString> MaterialsNameCache;
 #else
@@ -2783,11 +4032,25 @@ protected:
 	TArray<FglTFRuntimeNode> AllNodesCache;
 	bool bAllNodesCached;
 
-	TMap<TSharedRef<FJsonObject>, FglTFRuntimeMeshLOD> LODsCache;
+	// LODs are allocated separately, so pointers to them stay valid while other threads add entries
+	TMap<TSharedRef<FJsonObject>, TSharedRef<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe>> LODsCache;
 
-	TArray64<uint8> BinaryBuffer;
+	FglTFRuntimeBytesStoragePtr BinaryBuffer;
 
-	bool LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObject, FglTFRuntimeMeshLOD*& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
+	bool bMemoryMapFiles;
+
+	FString DerivedDataCacheDirectory;
+	FString DerivedDataContentHash;
+	FCriticalSection DerivedDataContentHashLock;
+	std::atomic<int32> DerivedDataHits{ 0 };
+	std::atomic<int32> DerivedDataMisses{ 0 };
+
+	static bool GetBinaryChunks(const uint8* DataPtr, const int64 DataNum, FString& JsonData, int64& BinaryOffset, int64& BinarySize);
+	static bool GetBinaryChunks(const uint8* DataPtr, const int64 DataNum, int64& JsonOffset, int64& JsonSize, int64& BinaryOffset, int64& BinarySize);
+
+	// the returned LOD can be evicted from the cache at any time, keep the reference as long as it is used
+	// LoadHandle (optional) is checked for cancellation and gets the progress of the primitives
+	bool LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObject, TSharedPtr<FglTFRuntimeMeshLOD, ESPMode::ThreadSafe>& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig, FglTFRuntimeLoadHandlePtr LoadHandle = nullptr);
 
 	UStaticMesh* LoadStaticMesh_Internal(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext);
 	UMaterialInterface* LoadMaterial_Internal(const int32 Index, const FString& MaterialName, TSharedRef<FJsonObject> JsonMaterialObject, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bUseVertexColors, UMaterialInterface* ForceBaseMaterial);
@@ -2822,9 +4085,9 @@ public:
 	UMaterialInterface* BuildVertexColorOnlyMaterial(const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bUnlit);
 
 	bool CheckJsonIndex(TSharedRef<FJsonObject> JsonObject, const FString& FieldName, const int32 Index, TArray<TSharedRef<FJsonValue>>& JsonItems) const;
-	bool CheckJsonRootIndex(const FString FieldName, const int32 Index, TArray<TSharedRef<FJsonValue>>& JsonItems) const { return CheckJsonIndex(Root, FieldName, Index, JsonItems); }
+	bool CheckJsonRootIndex(const FString FieldName, const int32 Index, TArray<TSharedRef<FJsonValue>>& JsonItems) const { MaterializeJsonSection(FieldName); return CheckJsonIndex(Root, FieldName, Index, JsonItems); }
 	TSharedPtr<FJsonObject> GetJsonObjectFromIndex(TSharedRef<FJsonObject> JsonObject, const FString& FieldName, const int32 Index) const;
-	TSharedPtr<FJsonObject> GetJsonObjectFromRootIndex(const FString& FieldName, const int32 Index) const { return GetJsonObjectFromIndex(Root, FieldName, Index); }
+	TSharedPtr<FJsonObject> GetJsonObjectFromRootIndex(const FString& FieldName, const int32 Index) const;
 	TSharedPtr<FJsonObject> GetJsonObjectFromExtensionIndex(TSharedRef<FJsonObject> JsonObject, const FString& ExtensionName, const FString& FieldName, const int32 Index);
 	TSharedPtr<FJsonObject> GetJsonObjectFromRootExtensionIndex(const FString& ExtensionName, const FString& FieldName, const int32 Index) { return GetJsonObjectFromExtensionIndex(Root, ExtensionName, FieldName, Index); }
 	TArray<TSharedRef<FJsonObject>> GetJsonObjectArrayFromExtension(TSharedRef<FJsonObject> JsonObject, const FString& ExtensionName, const FString& FieldName);
@@ -2896,11 +4159,16 @@ protected:
 
 	FString BaseDirectory;
 	FString BaseFilename;
+	// full path of the file the asset has been loaded from (empty for memory loads)
+	FString SourceFilename;
 
 	TArray64<uint8> AsBlob;
 
 	FglTFRuntimeUriRewriterHook UriRewriterHook;
 
+	void RewriteUri(FString& Uri);
+	bool GetArchiveUri(const FString& Uri, FString& ArchiveUri);
+
 public:
 
 	FVector TransformVector(const FVector Vector) const;
@@ -2918,8 +4186,8 @@ public:
 		return FTransform(SceneBasis.Inverse() * M * SceneBasis);
 	}
 
-	template<typename T, typename Callback>
-	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, Callback Filter, const int64 AdditionalBufferView, const bool bDefaultNormalized, int64* ComponentTypePtr)
+	template<typename T, typename Callback, typename AllocatorType>
+	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T, AllocatorType>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, Callback Filter, const int64 AdditionalBufferView, const bool bDefaultNormalized, int64* ComponentTypePtr)
 	{
 		int64 AccessorIndex;
 		if (!JsonObject->TryGetNumberField(Name, AccessorIndex))
@@ -2951,89 +4219,24 @@ public:
 			*ComponentTypePtr = ComponentType;
 		}
 
-		auto ComponentFloat = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				float* Ptr = (float*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = Ptr[i];
-				}
-			};
-
-		auto ComponentByte = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				int8* Ptr = (int8*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? FMath::Max(((float)Ptr[i]) / 127.f, -1.f) : Ptr[i];
-				}
-			};
-
-		auto ComponentUnsignedByte = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				uint8* Ptr = (uint8*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? ((float)Ptr[i]) / 255.f : Ptr[i];
-				}
-			};
-
-		auto ComponentShort = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				int16* Ptr = (int16*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? FMath::Max(((float)Ptr[i]) / 32767.f, -1.f) : Ptr[i];
-				}
-			};
-
-		auto ComponentUnsignedShort = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				uint16* Ptr = (uint16*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? ((float)Ptr[i]) / 65535.f : Ptr[i];
-				}
-			};
-
-		TFunction<void(const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)> ComponentFunction = nullptr;
-
-		switch (ComponentType)
+		// the array size type (int32 for TArray) must hold the new elements
+		if (Count < 0 || Count > static_cast<int64>(TNumericLimits<typename TArray<T, AllocatorType>::SizeType>::Max()) - Data.Num())
 		{
-		case(5126):// FLOAT
-			ComponentFunction = ComponentFloat;
-			break;
-		case(5120):// BYTE
-			ComponentFunction = ComponentByte;
-			break;
-		case(5121):// UNSIGNED_BYTE
-			ComponentFunction = ComponentUnsignedByte;
-			break;
-		case(5122):// SHORT
-			ComponentFunction = ComponentShort;
-			break;
-		case(5123):// UNSIGNED_SHORT
-			ComponentFunction = ComponentUnsignedShort;
-			break;
-		default:
-			UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
 			return false;
 		}
 
-		Data.AddUninitialized(Count);
-		ParallelFor(Count, [&](const int64 ElementIndex)
-			{
-				int64 Index = ElementIndex * Stride;
-				T Value;
-				ComponentFunction(Elements, Index, Blob, Value, bNormalized);
-				Data[ElementIndex] = Filter(Value);
-			});
+		const int64 FirstIndex = Data.AddUninitialized(Count);
+		if (!glTFRuntime::DecodeAccessorComponents<T, false>(ComponentType, bNormalized, Blob.Data, Stride, Count, Elements, Data.GetData() + FirstIndex, Filter))
+		{
+			Data.SetNum(FirstIndex);
+			return false;
+		}
 
 		return true;
 	}
 
-	template<typename T, typename Callback>
-	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedTypes, Callback Filter, const int64 AdditionalBufferView, const bool bDefaultNormalized, int64* ComponentTypePtr)
+	template<typename T, typename Callback, typename AllocatorType>
+	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T, AllocatorType>& Data, const TArray<int64>& SupportedTypes, Callback Filter, const int64 AdditionalBufferView, const bool bDefaultNormalized, int64* ComponentTypePtr)
 	{
 		int64 AccessorIndex;
 		if (!JsonObject->TryGetNumberField(Name, AccessorIndex))
@@ -3065,82 +4268,104 @@ public:
 			*ComponentTypePtr = ComponentType;
 		}
 
-		auto ComponentFloat = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				float* Ptr = (float*)&(Blob.Data[Index]);
-				Value = *Ptr;
-			};
+		// the array size type (int32 for TArray) must hold the new elements
+		if (Count < 0 || Count > static_cast<int64>(TNumericLimits<typename TArray<T, AllocatorType>::SizeType>::Max()) - Data.Num())
+		{
+			return false;
+		}
 
-		auto ComponentByte = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				int8* Ptr = (int8*)&(Blob.Data[Index]);
-				Value = bNormalized ? FMath::Max(((float)(*Ptr)) / 127.f, -1.f) : *Ptr;
-			};
+		const int64 FirstIndex = Data.AddUninitialized(Count);
+		if (!glTFRuntime::DecodeAccessorComponents<T, true>(ComponentType, bNormalized, Blob.Data, Stride, Count, Elements, Data.GetData() + FirstIndex, Filter))
+		{
+			Data.SetNum(FirstIndex);
+			return false;
+		}
 
-		auto ComponentUnsignedByte = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				uint8* Ptr = (uint8*)&(Blob.Data[Index]);
-				Value = bNormalized ? ((float)(*Ptr)) / 255.f : *Ptr;
-			};
+		return true;
+	}
 
-		auto ComponentShort = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				int16* Ptr = (int16*)&(Blob.Data[Index]);
-				Value = bNormalized ? FMath::Max(((float)(*Ptr)) / 32767.f, -1.f) : *Ptr;
-			};
+	template<typename T>
+	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, const int64 AdditionalBufferView, const bool bDefaultNormalized, int64* ComponentTypePtr)
+	{
+		return BuildFromAccessorField(JsonObject, Name, Data, SupportedElements, SupportedTypes, [&](T InValue) -> T {return InValue; }, AdditionalBufferView, bDefaultNormalized, ComponentTypePtr);
+	}
 
-		auto ComponentUnsignedShort = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				uint16* Ptr = (uint16*)&(Blob.Data[Index]);
-				Value = bNormalized ? ((float)(*Ptr)) / 65535.f : *Ptr;
-			};
+	template<typename T>
+	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedTypes, const int64 AdditionalBufferView, const bool bDefaultNormalized, int64* ComponentTypePtr)
+	{
+		return BuildFromAccessorField(JsonObject, Name, Data, SupportedTypes, [&](T InValue) -> T {return InValue; }, AdditionalBufferView, bDefaultNormalized, ComponentTypePtr);
+	}
 
-		TFunction<void(const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)> ComponentFunction = nullptr;
+	// like BuildFromAccessorField but Data is only sized here, it will be filled by glTFRuntime::DecodeAccessorStreams
+	template<typename T, typename Callback, typename AllocatorType>
+	bool AddAccessorFieldStream(TArray<glTFRuntime::FAccessorStream>& Streams, TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T, AllocatorType>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, Callback Filter, const int64 AdditionalBufferView, const bool bDefaultNormalized, int64* ComponentTypePtr)
+	{
+		int64 AccessorIndex;
+		if (!JsonObject->TryGetNumberField(Name, AccessorIndex))
+		{
+			return false;
+		}
 
-		switch (ComponentType)
+		FglTFRuntimeBlob Blob;
+		int64 ComponentType = 0, Stride = 0, Elements = 0, ElementSize = 0, Count = 0;
+		bool bNormalized = bDefaultNormalized;
+
+		if (!GetAccessor(AccessorIndex, ComponentType, Stride, Elements, ElementSize, Count, bNormalized, Blob, GetAdditionalBufferView(AdditionalBufferView, Name)))
 		{
-		case(5126):// FLOAT
-			ComponentFunction = ComponentFloat;
-			break;
-		case(5120):// BYTE
-			ComponentFunction = ComponentByte;
-			break;
-		case(5121):// UNSIGNED_BYTE
-			ComponentFunction = ComponentUnsignedByte;
-			break;
-		case(5122):// SHORT
-			ComponentFunction = ComponentShort;
-			break;
-		case(5123):// UNSIGNED_SHORT
-			ComponentFunction = ComponentUnsignedShort;
-			break;
-		default:
-			UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
 			return false;
 		}
 
-		Data.AddUninitialized(Count);
-		ParallelFor(Count, [&](const int64 ElementIndex)
-			{
-				int64 Index = ElementIndex * Stride;
-				T Value;
-				ComponentFunction(Index, Blob, Value, bNormalized);
-				Data[ElementIndex] = Filter(Value);
-			});
+		if (!SupportedElements.Contains(Elements))
+		{
+			return false;
+		}
+
+		if (!SupportedTypes.Contains(ComponentType))
+		{
+			return false;
+		}
 
+		if (ComponentTypePtr)
+		{
+			*ComponentTypePtr = ComponentType;
+		}
+
+		glTFRuntime::FAccessorStream Stream;
+		Stream.Count = Count;
+		Stream.Storage = Blob.Storage;
+
+		// the array size type (int32 for TArray) must hold the new elements
+		if (Count < 0 || Count > static_cast<int64>(TNumericLimits<typename TArray<T, AllocatorType>::SizeType>::Max()) - Data.Num())
+		{
+			return false;
+		}
+
+		const int64 FirstIndex = Data.AddUninitialized(Count);
+		if (!glTFRuntime::DispatchAccessorDecoder<T, false>(ComponentType, bNormalized, Blob.Data, Stride, Elements, Data.GetData() + FirstIndex, Filter, Stream))
+		{
+			Data.SetNum(FirstIndex);
+			return false;
+		}
+
+		Streams.Add(MoveTemp(Stream));
 		return true;
 	}
 
 	template<typename T>
-	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, const int64 AdditionalBufferView, const bool bDefaultNormalized, int64* ComponentTypePtr)
+	bool AddAccessorFieldStream(TArray<glTFRuntime::FAccessorStream>& Streams, TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, const int64 AdditionalBufferView, const bool bDefaultNormalized, int64* ComponentTypePtr)
 	{
-		return BuildFromAccessorField(JsonObject, Name, Data, SupportedElements, SupportedTypes, [&](T InValue) -> T {return InValue; }, AdditionalBufferView, bDefaultNormalized, ComponentTypePtr);
+		return AddAccessorFieldStream(Streams, JsonObject, Name, Data, SupportedElements, SupportedTypes, [](T InValue) -> T {return InValue; }, AdditionalBufferView, bDefaultNormalized, ComponentTypePtr);
 	}
 
-	template<typename T>
-	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedTypes, const int64 AdditionalBufferView, const bool bDefaultNormalized, int64* ComponentTypePtr)
+	// decodes into CompactData (Filter still runs at full precision) when the primitive uses compact vertex data
+	template<typename T, typename CompactT, typename Callback>
+	bool AddVertexAttributeStream(TArray<glTFRuntime::FAccessorStream>& Streams, const bool bCompact, TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, TArray<CompactT>& CompactData, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, Callback Filter, const int64 AdditionalBufferView, const bool bDefaultNormalized, int64* ComponentTypePtr)
 	{
-		return BuildFromAccessorField(JsonObject, Name, Data, SupportedTypes, [&](T InValue) -> T {return InValue; }, AdditionalBufferView, bDefaultNormalized, ComponentTypePtr);
+		if (bCompact)
+		{
+			return AddAccessorFieldStream(Streams, JsonObject, Name, CompactData, SupportedElements, SupportedTypes, [Filter](CompactT Value) -> CompactT { return CompactT(Filter(T(Value))); }, AdditionalBufferView, bDefaultNormalized, ComponentTypePtr);
+		}
+		return AddAccessorFieldStream(Streams, JsonObject, Name, Data, SupportedElements, SupportedTypes, Filter, AdditionalBufferView, bDefaultNormalized, ComponentTypePtr);
 	}
 
 	template<int32 Num, typename T>
@@ -3179,8 +4404,9 @@ protected:
 		return Values[Index];
 	}
 
-	TArray64<uint8> ZeroBuffer;
-	TMap<int32, TArray64<uint8>> SparseAccessorsCache;
+	// replaced (never resized) when a bigger one is needed, so blobs pointing to it stay valid
+	FglTFRuntimeBytesStoragePtr ZeroBuffer;
+	TMap<int32, FglTFRuntimeBytesStorageRef> SparseAccessorsCache;
 	TMap<int32, int64> SparseAccessorsStridesCache;
 
 	TMap<int64, TMap<FString, FglTFRuntimeBlob>> AdditionalBufferViewsCache;
@@ -3195,21 +4421,28 @@ public:
 	TArray<FString> GetArchiveItems() const;
 	bool GetBlobByName(const FString& Name, TArray64<uint8>& Blob) const;
 
+	// Function(LOD, LoadHandle) runs in a worker thread and is skipped when the load is cancelled before starting
 	template<typename FUNCTION>
-	void LoadAsRuntimeLODAsync(FUNCTION Function, const FglTFRuntimeMeshLODAsync& AsyncCallback)
+	FglTFRuntimeLoadHandleRef LoadAsRuntimeLODAsync(FUNCTION Function, const FglTFRuntimeMeshLODAsync& AsyncCallback)
 	{
-		Async(EAsyncExecution::Thread, [Function, AsyncCallback]()
+		FglTFRuntimeLoadHandleRef LoadHandle = MakeShared<FglTFRuntimeLoadHandle, ESPMode::ThreadSafe>();
+
+		Async(EAsyncExecution::Thread, [Function, AsyncCallback, LoadHandle]()
 			{
 				FglTFRuntimeMeshLOD LOD;
-				bool bSuccess = Function(LOD);
-				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([bSuccess, &LOD, AsyncCallback]()
+				bool bSuccess = !LoadHandle->IsCancelled() && Function(LOD, LoadHandle);
+				FGraphEventRef Task = FglTFRuntimeGameThreadQueue::Get().Enqueue([bSuccess, &LOD, AsyncCallback, LoadHandle]()
 					{
-						AsyncCallback.ExecuteIfBound(bSuccess, bSuccess ? LOD : FglTFRuntimeMeshLOD());
-					}, TStatId(), nullptr, ENamedThreads::GameThread);
+						LoadHandle->Complete();
+						const bool bLoaded = bSuccess && !LoadHandle->IsCancelled();
+						AsyncCallback.ExecuteIfBound(bLoaded, bLoaded ? LOD : FglTFRuntimeMeshLOD());
+					}, LoadHandle);
 				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 			}
 
 		);
+
+		return LoadHandle;
 	}
 
 	TMap<FString, TSharedPtr<FglTFRuntimePluginCacheData>> PluginsCacheData;
@@ -3225,6 +4458,16 @@ public:
 	bool LoadBlobToMips(const int32 TextureIndex, TSharedRef<FJsonObject> JsonTextureObject, TSharedRef<FJsonObject> JsonImageObject, const TArray64<uint8>& Blob, TArray<FglTFRuntimeMipMap>& Mips, const bool sRGB, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
 	bool LoadBlobToMips(const TArray64<uint8>& Blob, TArray<FglTFRuntimeMipMap>& Mips, const bool sRGB, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
 
+	const FString& GetDerivedDataContentHash();
+	FString GetPrimitiveDerivedDataKey(TSharedRef<FJsonObject> JsonPrimitiveObject, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
+	bool LoadPrimitiveFromDerivedDataCache(const FString& DerivedDataKey, FglTFRuntimePrimitive& Primitive);
+	void StorePrimitiveToDerivedDataCache(const FString& DerivedDataKey, FglTFRuntimePrimitive& Primitive);
+	FString GetMipsDerivedDataKey(TSharedRef<FJsonObject> JsonImageObject, const TArray64<uint8>& Blob, const bool sRGB, const FglTFRuntimeMaterialsConfig& MaterialsConfig) const;
+	bool LoadMipsFromDerivedDataCache(const FString& DerivedDataKey, const int32 TextureIndex, TArray<FglTFRuntimeMipMap>& Mips);
+	void StoreMipsToDerivedDataCache(const FString& DerivedDataKey, TArray<FglTFRuntimeMipMap>& Mips);
+
+	static void SerializePrimitiveGeometry(FArchive& Ar, FglTFRuntimePrimitive& Primitive);
+
 	void SetDownloadTime(const float Value);
 	float GetDownloadTime() const;
 
@@ -4,6 +4,7 @@
 #include "glTFRuntimeEditor.h"
 #include "glTFRuntimeFunctionLibrary.h"
 #include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Archive_Tar_Dummy, "glTFRuntime.UnitTests.Archive.Tar.Dummy", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
 
@@ -68,6 +69,78 @@ bool FglTFRuntimeTests_Archive_Tar_DummyUriRewrite::RunTest(const FString& Param
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Archive_Tar_DummyInflateToDisk, "glTFRuntime.UnitTests.Archive.Tar.DummyInflateToDisk", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Archive_Tar_DummyInflateToDisk::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Dummy.tar.gz");
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.bAsBlob = true;
+	LoaderConfig.bInflateArchivesToDisk = true;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+
+	TestTrue("Asset->IsArchive()", Asset->IsArchive());
+
+	TArray<FString> Items = Asset->GetArchiveItems();
+	Items.Sort();
+
+	TestEqual("", Items, { "zip000/", "zip000/000", "zip000/zip001/", "zip000/zip001/001", "zip000/zip001/zip002/", "zip000/zip001/zip002/002" });
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Archive_Tar_DummyZeroPaddedInflateToDisk, "glTFRuntime.UnitTests.Archive.Tar.DummyZeroPaddedInflateToDisk", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Archive_Tar_DummyZeroPaddedInflateToDisk::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Dummy.tar.gz");
+
+	// tape and tar tools can pad the gzip file with zeros up to the block size
+	TArray<uint8> Data;
+	FFileHelper::LoadFileToArray(Data, *Fixture.Path);
+	Data.AddZeroed(10240 - (Data.Num() % 10240));
+	const FString PaddedFilename = FPaths::CreateTempFilename(*FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("glTFRuntime")), TEXT("Padded"), TEXT(".tar.gz"));
+	FFileHelper::SaveArrayToFile(Data, *PaddedFilename);
+
+	const FString TempFilename = FPaths::CreateTempFilename(*FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("glTFRuntime")), TEXT("Archive"), TEXT(".tar"));
+	{
+		FglTFRuntimeArchiveTar TarFile;
+		TestTrue("TarFile.FromGzipFile(PaddedFilename, TempFilename)", TarFile.FromGzipFile(PaddedFilename, TempFilename));
+
+		TArray<FString> Items;
+		TarFile.GetItems(Items);
+		Items.Sort();
+
+		TestEqual("", Items, { "zip000/", "zip000/000", "zip000/zip001/", "zip000/zip001/001", "zip000/zip001/zip002/", "zip000/zip001/zip002/002" });
+	}
+
+	IFileManager::Get().Delete(*PaddedFilename);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Archive_Tar_GzipNotTarInflateToDisk, "glTFRuntime.UnitTests.Archive.Tar.GzipNotTarInflateToDisk", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Archive_Tar_GzipNotTarInflateToDisk::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Triangle.gltf.bgzf.gz");
+
+	// a gzip compressed gltf is rejected after its first 512 bytes, without creating the temp file
+	const FString TempFilename = FPaths::CreateTempFilename(*FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("glTFRuntime")), TEXT("Archive"), TEXT(".tar"));
+	FglTFRuntimeArchiveTar TarFile;
+	TestFalse("TarFile.FromGzipFile(Fixture.Path, TempFilename)", TarFile.FromGzipFile(Fixture.Path, TempFilename));
+	TestFalse("FPaths::FileExists(TempFilename)", FPaths::FileExists(TempFilename));
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.bInflateArchivesToDisk = true;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+	TestTrue("Asset != nullptr", Asset != nullptr);
+	TestFalse("Asset->IsArchive()", Asset->IsArchive());
+
+	return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Archive_Zip_Dummy, "glTFRuntime.UnitTests.Archive.Zip.Dummy", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
 
 bool FglTFRuntimeTests_Archive_Zip_Dummy::RunTest(const FString& Parameters)
@@ -88,4 +161,211 @@ bool FglTFRuntimeTests_Archive_Zip_Dummy::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Archive_Zip_DummyMapped, "glTFRuntime.UnitTests.Archive.Zip.DummyMapped", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Archive_Zip_DummyMapped::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Dummy.zip");
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.bAsBlob = true;
+	UglTFRuntimeAsset* StreamedAsset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+
+	LoaderConfig.bMemoryMapFiles = true;
+	UglTFRuntimeAsset* MappedAsset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+
+	TestTrue("StreamedAsset->IsArchive()", StreamedAsset->IsArchive());
+	TestTrue("MappedAsset->IsArchive()", MappedAsset->IsArchive());
+
+	TArray<FString> StreamedItems = StreamedAsset->GetArchiveItems();
+	StreamedItems.Sort();
+	TArray<FString> MappedItems = MappedAsset->GetArchiveItems();
+	MappedItems.Sort();
+
+	TestEqual("StreamedItems == MappedItems", StreamedItems, MappedItems);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Archive_Zip_BlenderPlanePrefetch, "glTFRuntime.UnitTests.Archive.Zip.BlenderPlanePrefetch", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Archive_Zip_BlenderPlanePrefetch::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Blender/BlenderPlane.zip");
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.bPrefetchArchiveEntries = true;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+
+	TestTrue("Asset->IsArchive()", Asset->IsArchive());
+
+	FglTFRuntimeCacheStats Stats = Asset->GetCacheStats();
+	TestEqual("Stats.BuffersBytes == 60", Stats.BuffersBytes, (int64)60);
+
+	FglTFRuntimeMeshLOD LOD;
+	Asset->LoadMeshAsRuntimeLOD(0, LOD, FglTFRuntimeMaterialsConfig());
+	TestEqual("LOD.Primitives[0].Indices = { 0, 1, 3, 0, 3, 2 }", LOD.Primitives[0].Indices, { 0, 1, 3, 0, 3, 2 });
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Archive_Zip_BlenderPlaneZip64, "glTFRuntime.UnitTests.Archive.Zip.BlenderPlaneZip64", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Archive_Zip_BlenderPlaneZip64::RunTest(const FString& Parameters)
+{
+	// ZIP64 trailer and locator, saturated sizes and offsets in both the local and the central directory headers
+	glTFRuntime::Tests::FFixturePath Fixture("Blender/BlenderPlane64.zip");
+
+	for (const bool bMemoryMapFiles : { false, true })
+	{
+		FglTFRuntimeConfig LoaderConfig;
+		LoaderConfig.bMemoryMapFiles = bMemoryMapFiles;
+		UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+		TestTrue("Asset != nullptr", Asset != nullptr);
+		if (!Asset)
+		{
+			continue;
+		}
+
+		TestTrue("Asset->IsArchive()", Asset->IsArchive());
+
+		TArray<FString> Items = Asset->GetArchiveItems();
+		Items.Sort();
+		TestEqual("Items == { \"BlenderPlane.bin\", \"BlenderPlane.gltf\" }", Items, { "BlenderPlane.bin", "BlenderPlane.gltf" });
+
+		FglTFRuntimeMeshLOD LOD;
+		Asset->LoadMeshAsRuntimeLOD(0, LOD, FglTFRuntimeMaterialsConfig());
+		TestEqual("LOD.Primitives[0].Indices = { 0, 1, 3, 0, 3, 2 }", LOD.Primitives[0].Indices, { 0, 1, 3, 0, 3, 2 });
+		TestEqual("Asset->GetCacheStats().BuffersBytes == 60", Asset->GetCacheStats().BuffersBytes, (int64)60);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Archive_Zip_TwoBuffersPrefetchPinned, "glTFRuntime.UnitTests.Archive.Zip.TwoBuffersPrefetchPinned", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Archive_Zip_TwoBuffersPrefetchPinned::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("TwoBuffers.zip");
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.bPrefetchArchiveEntries = true;
+	// room for only one of the two 4 bytes buffers
+	LoaderConfig.CacheBytesBudget = 4;
+	AddExpectedError(TEXT("not prefetched"), EAutomationExpectedErrorFlags::Contains, 1);
+	// the pinned buffer cannot be evicted to honor the budget when the other one is loaded
+	AddExpectedError(TEXT("over its budget"), EAutomationExpectedErrorFlags::Contains, 0);
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+
+	TestTrue("Asset->IsArchive()", Asset->IsArchive());
+
+	// prefetched entries survive the budget until their first use
+	TestEqual("Asset->GetCacheStats().BuffersBytes == 4", Asset->GetCacheStats().BuffersBytes, (int64)4);
+	TestEqual("Asset->GetCacheStats().PinnedBytes == 4", Asset->GetCacheStats().PinnedBytes, (int64)4);
+
+	FglTFRuntimeBlob Blob;
+	TestTrue("Asset->GetParser()->GetBuffer(1, Blob)", Asset->GetParser()->GetBuffer(1, Blob));
+	TestEqual("Blob.Data[0] == 4", Blob.Data[0], (uint8)4);
+
+	// buffer 1 has been loaded on demand and it is not pinned, buffer 0 is still pinned
+	Asset->TrimCache();
+	TestEqual("Asset->GetCacheStats().BuffersBytes == 4", Asset->GetCacheStats().BuffersBytes, (int64)4);
+	TestEqual("Asset->GetCacheStats().PinnedBytes == 4", Asset->GetCacheStats().PinnedBytes, (int64)4);
+
+	TestTrue("Asset->GetParser()->GetBuffer(0, Blob)", Asset->GetParser()->GetBuffer(0, Blob));
+	TestEqual("Blob.Data[0] == 0", Blob.Data[0], (uint8)0);
+	TestEqual("Asset->GetCacheStats().PinnedBytes == 0", Asset->GetCacheStats().PinnedBytes, (int64)0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Archive_Zip_Zip64Overflow, "glTFRuntime.UnitTests.Archive.Zip.Zip64Overflow", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Archive_Zip_Zip64Overflow::RunTest(const FString& Parameters)
+{
+	TArray<uint8> Data;
+	auto Write16 = [&Data](const uint16 Value) { Data.Append(reinterpret_cast<const uint8*>(&Value), sizeof(uint16)); };
+	auto Write32 = [&Data](const uint32 Value) { Data.Append(reinterpret_cast<const uint8*>(&Value), sizeof(uint32)); };
+	auto Write64 = [&Data](const uint64 Value) { Data.Append(reinterpret_cast<const uint8*>(&Value), sizeof(uint64)); };
+	auto WriteName = [&Data](const char* Name) { Data.Append(reinterpret_cast<const uint8*>(Name), 5); };
+
+	// "a.bin" local header, its ZIP64 sizes make data offset + size overflow int64
+	Write32(0x04034b50);
+	Write16(45);
+	Write16(0);
+	Write16(0);
+	Write32(0);
+	Write32(0);
+	Write32(MAX_uint32);
+	Write32(MAX_uint32);
+	Write16(5);
+	Write16(20);
+	WriteName("a.bin");
+	Write16(0x0001);
+	Write16(16);
+	Write64(MAX_int64);
+	Write64(MAX_int64 - 7);
+	Data.Append({ 'A', 'B', 'C', 'D' });
+
+	const uint32 CentralDirectoryOffset = Data.Num();
+
+	auto WriteCentralEntry = [&](const char* Name, const uint32 Size, const uint32 LocalHeaderOffset, const uint16 ExtraFieldLen)
+		{
+			Write32(0x02014b50);
+			Write16(45);
+			Write16(45);
+			Write16(0);
+			Write16(0);
+			Write32(0);
+			Write32(0);
+			Write32(Size);
+			Write32(Size);
+			Write16(5);
+			Write16(ExtraFieldLen);
+			Write16(0);
+			Write16(0);
+			Write16(0);
+			Write32(0);
+			Write32(LocalHeaderOffset);
+			WriteName(Name);
+		};
+
+	WriteCentralEntry("a.bin", MAX_uint32, 0, 20);
+	Write16(0x0001);
+	Write16(16);
+	Write64(MAX_int64);
+	Write64(MAX_int64 - 7);
+
+	// "b.bin" local header offset is close to the int64 limit
+	WriteCentralEntry("b.bin", 4, MAX_uint32, 12);
+	Write16(0x0001);
+	Write16(8);
+	Write64(MAX_int64 - 15);
+
+	const uint32 CentralDirectorySize = Data.Num() - CentralDirectoryOffset;
+
+	Write32(0x06054b50);
+	Write16(0);
+	Write16(0);
+	Write16(2);
+	Write16(2);
+	Write32(CentralDirectorySize);
+	Write32(CentralDirectoryOffset);
+	Write16(0);
+
+	FglTFRuntimeArchiveZip Archive;
+	TestTrue("Archive.FromData(Data.GetData(), Data.Num())", Archive.FromData(Data.GetData(), Data.Num()));
+	TestTrue("Archive.FileExists(\"a.bin\")", Archive.FileExists("a.bin"));
+	TestTrue("Archive.FileExists(\"b.bin\")", Archive.FileExists("b.bin"));
+
+	TArray64<uint8> Content;
+	FglTFRuntimeBytesStoragePtr Storage;
+	TestFalse("Archive.GetFileContent(\"a.bin\", Content)", Archive.GetFileContent("a.bin", Content));
+	TestFalse("Archive.GetFileStorage(\"a.bin\", Storage)", Archive.GetFileStorage("a.bin", Storage));
+	TestFalse("Archive.GetFileContent(\"b.bin\", Content)", Archive.GetFileContent("b.bin", Content));
+	TestFalse("Archive.GetFileStorage(\"b.bin\", Storage)", Archive.GetFileStorage("b.bin", Storage));
+
+	return true;
+}
+
 #endif
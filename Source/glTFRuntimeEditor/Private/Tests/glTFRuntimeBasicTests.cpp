@@ -2,7 +2,12 @@
 
 #if WITH_DEV_AUTOMATION_TESTS
 #include "glTFRuntimeEditor.h"
+#include "glTFRuntimeAssetActorAsync.h"
 #include "glTFRuntimeFunctionLibrary.h"
+#include "glTFRuntimeGameThreadQueue.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
 #include "Misc/AutomationTest.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_BlenderEmpty_Copyright, "glTFRuntime.UnitTests.Basic.BlenderEmpty.Copyright", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
@@ -128,4 +133,353 @@ bool FglTFRuntimeTests_Basic_EmptyScene::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_SharedAsset, "glTFRuntime.UnitTests.Basic.SharedAsset", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_SharedAsset::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("EmptyScene.gltf");
+
+	FglTFRuntimeConfig LoaderConfig;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+	UglTFRuntimeAsset* Asset2 = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+	TestTrue("Asset != Asset2", Asset != Asset2);
+
+	LoaderConfig.bShareAsset = true;
+	UglTFRuntimeAsset* SharedAsset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+	UglTFRuntimeAsset* SharedAsset2 = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+	TestTrue("SharedAsset != nullptr", SharedAsset != nullptr);
+	TestTrue("SharedAsset == SharedAsset2", SharedAsset == SharedAsset2);
+
+	LoaderConfig.SceneScale = 1;
+	UglTFRuntimeAsset* SharedAsset3 = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+	TestTrue("SharedAsset != SharedAsset3", SharedAsset != SharedAsset3);
+
+	UglTFRuntimeFunctionLibrary::glTFReleaseSharedAssets();
+	TestEqual("glTFGetSharedAssetsNum() == 0", UglTFRuntimeFunctionLibrary::glTFGetSharedAssetsNum(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_SharedAssetConcurrentLoads, "glTFRuntime.UnitTests.Basic.SharedAssetConcurrentLoads", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_SharedAssetConcurrentLoads::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("EmptyScene.gltf");
+
+	UglTFRuntimeFunctionLibrary::glTFReleaseSharedAssets();
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.bShareAsset = true;
+
+	constexpr int32 NumLoads = 4;
+	TArray<UglTFRuntimeAsset*> Assets;
+	TArray<UglTFRuntimeLoadHandle*> LoadHandles;
+	for (int32 LoadIndex = 0; LoadIndex < NumLoads; LoadIndex++)
+	{
+		LoadHandles.Add(UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilenameAsyncWithCallback(Fixture.Path, false, LoaderConfig, [&Assets](UglTFRuntimeAsset* Asset)
+			{
+				Assets.Add(Asset);
+			}));
+	}
+
+	// the loads complete on the game thread
+	const double StartTime = FPlatformTime::Seconds();
+	while (Assets.Num() < NumLoads && FPlatformTime::Seconds() - StartTime < 10)
+	{
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+	}
+
+	TestEqual("Assets.Num() == NumLoads", Assets.Num(), NumLoads);
+	for (int32 LoadIndex = 0; LoadIndex < Assets.Num(); LoadIndex++)
+	{
+		TestTrue("Assets[LoadIndex] != nullptr", Assets[LoadIndex] != nullptr);
+		TestTrue("Assets[LoadIndex] == Assets[0]", Assets[LoadIndex] == Assets[0]);
+		TestTrue("LoadHandles[LoadIndex]->IsCompleted()", LoadHandles[LoadIndex]->IsCompleted());
+	}
+	TestEqual("glTFGetSharedAssetsNum() == 1", UglTFRuntimeFunctionLibrary::glTFGetSharedAssetsNum(), 1);
+
+	UglTFRuntimeFunctionLibrary::glTFReleaseSharedAssets();
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_SharedAssetSyncDuringAsync, "glTFRuntime.UnitTests.Basic.SharedAssetSyncDuringAsync", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_SharedAssetSyncDuringAsync::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("EmptyScene.gltf");
+
+	UglTFRuntimeFunctionLibrary::glTFReleaseSharedAssets();
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.bShareAsset = true;
+
+	UglTFRuntimeAsset* AsyncAsset = nullptr;
+	bool bAsyncCompleted = false;
+	UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilenameAsyncWithCallback(Fixture.Path, false, LoaderConfig, [&AsyncAsset, &bAsyncCompleted](UglTFRuntimeAsset* Asset)
+		{
+			AsyncAsset = Asset;
+			bAsyncCompleted = true;
+		});
+
+	// the async load is still in flight (it completes on the game thread), the sync load must reuse its parser
+	UglTFRuntimeAsset* SyncAsset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+	TestTrue("SyncAsset != nullptr", SyncAsset != nullptr);
+
+	const double StartTime = FPlatformTime::Seconds();
+	while (!bAsyncCompleted && FPlatformTime::Seconds() - StartTime < 10)
+	{
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+	}
+
+	TestTrue("bAsyncCompleted", bAsyncCompleted);
+	TestTrue("AsyncAsset == SyncAsset", AsyncAsset == SyncAsset);
+	TestEqual("glTFGetSharedAssetsNum() == 1", UglTFRuntimeFunctionLibrary::glTFGetSharedAssetsNum(), 1);
+
+	UglTFRuntimeFunctionLibrary::glTFReleaseSharedAssets();
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_SharedAssetLimit, "glTFRuntime.UnitTests.Basic.SharedAssetLimit", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_SharedAssetLimit::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("EmptyScene.gltf");
+	glTFRuntime::Tests::FFixturePath Fixture2("Blender/BlenderPlane.gltf");
+
+	UglTFRuntimeFunctionLibrary::glTFReleaseSharedAssets();
+	UglTFRuntimeFunctionLibrary::glTFSetSharedAssetsLimit(1);
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.bShareAsset = true;
+
+	// both assets are still referenced, the limit applies to live entries too
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+	UglTFRuntimeAsset* Asset2 = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture2.Path, false, LoaderConfig);
+	TestTrue("Asset != nullptr", Asset != nullptr);
+	TestTrue("Asset2 != nullptr", Asset2 != nullptr);
+	TestEqual("glTFGetSharedAssetsNum() == 1", UglTFRuntimeFunctionLibrary::glTFGetSharedAssetsNum(), 1);
+
+	// the most recently used entry survives
+	TestTrue("glTFLoadAssetFromFilename(Fixture2) == Asset2", UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture2.Path, false, LoaderConfig) == Asset2);
+	TestTrue("glTFLoadAssetFromFilename(Fixture) != Asset", UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig) != Asset);
+
+	UglTFRuntimeFunctionLibrary::glTFSetSharedAssetsLimit(0);
+	UglTFRuntimeFunctionLibrary::glTFReleaseSharedAssets();
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_AssetActorAsyncShareMeshesDefault, "glTFRuntime.UnitTests.Basic.AssetActorAsyncShareMeshesDefault", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_AssetActorAsyncShareMeshesDefault::RunTest(const FString& Parameters)
+{
+	// only nodes getting the same OverrideStaticMeshConfig share a static mesh, so it is safe by default
+	const AglTFRuntimeAssetActorAsync* AssetActor = GetDefault<AglTFRuntimeAssetActorAsync>();
+	TestTrue("AssetActor->bShareMeshes", AssetActor->bShareMeshes);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_AssetActorAsyncSharedMeshes, "glTFRuntime.UnitTests.Basic.AssetActorAsyncSharedMeshes", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_AssetActorAsyncSharedMeshes::RunTest(const FString& Parameters)
+{
+	// three meshes (the same triangle) used by five nodes
+	const FString JsonData = TEXT(R"({
+		"asset": { "version": "2.0" },
+		"buffers": [ { "byteLength": 44, "uri": "data:application/octet-stream;base64,AAAAAAAAAAAAAAAAAACAPwAAAAAAAAAAAAAAAAAAgD8AAAAAAAABAAIAAAA=" } ],
+		"bufferViews": [ { "buffer": 0, "byteLength": 36 }, { "buffer": 0, "byteOffset": 36, "byteLength": 6 } ],
+		"accessors": [
+			{ "bufferView": 0, "componentType": 5126, "count": 3, "type": "VEC3" },
+			{ "bufferView": 1, "componentType": 5123, "count": 3, "type": "SCALAR" }
+		],
+		"meshes": [
+			{ "primitives": [ { "attributes": { "POSITION": 0 }, "indices": 1 } ] },
+			{ "primitives": [ { "attributes": { "POSITION": 0 }, "indices": 1 } ] },
+			{ "primitives": [ { "attributes": { "POSITION": 0 }, "indices": 1 } ] }
+		],
+		"nodes": [ { "mesh": 0 }, { "mesh": 1 }, { "mesh": 0 }, { "mesh": 2 }, { "mesh": 1 } ],
+		"scenes": [ { "nodes": [ 0, 1, 2, 3, 4 ] } ],
+		"scene": 0
+	})");
+
+	FglTFRuntimeConfig LoaderConfig;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromString(JsonData, LoaderConfig);
+	TestTrue("Asset != nullptr", Asset != nullptr);
+	if (!Asset)
+	{
+		return false;
+	}
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	AglTFRuntimeAssetActorAsync* AssetActor = World->SpawnActorDeferred<AglTFRuntimeAssetActorAsync>(AglTFRuntimeAssetActorAsync::StaticClass(), FTransform::Identity);
+	AssetActor->Asset = Asset;
+	AssetActor->MaxConcurrentMeshes = 1;
+
+	TArray<int32> AssignedNodes;
+	TMap<int32, UObject*> AssignedMeshes;
+	AssetActor->OnMeshAssigned.AddLambda([&AssignedNodes, &AssignedMeshes](UPrimitiveComponent* PrimitiveComponent, UObject* Mesh)
+		{
+			int32 NodeIndex = INDEX_NONE;
+			for (const FName& Tag : PrimitiveComponent->ComponentTags)
+			{
+				FString NodeIndexString;
+				if (Tag.ToString().Split(TEXT("glTFRuntime:NodeIndex:"), nullptr, &NodeIndexString))
+				{
+					NodeIndex = FCString::Atoi(*NodeIndexString);
+				}
+			}
+			AssignedNodes.Add(NodeIndex);
+			AssignedMeshes.Add(NodeIndex, Mesh);
+		});
+
+	int32 ScenesLoadedCount = 0;
+	AssetActor->OnScenesLoaded.AddLambda([&ScenesLoadedCount]()
+		{
+			ScenesLoadedCount++;
+		});
+
+	AssetActor->FinishSpawning(FTransform::Identity);
+
+	// repeated (mesh, skin) pairs are built once
+	TestEqual("AssetActor->GetMeshLoadsNum() == 3", AssetActor->GetMeshLoadsNum(), 3);
+
+	int32 MaxMeshLoadsInFlight = AssetActor->GetMeshLoadsInFlight();
+	const double StartTime = FPlatformTime::Seconds();
+	while (ScenesLoadedCount == 0 && FPlatformTime::Seconds() - StartTime < 10)
+	{
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		MaxMeshLoadsInFlight = FMath::Max(MaxMeshLoadsInFlight, AssetActor->GetMeshLoadsInFlight());
+	}
+
+	// a few more rounds, nothing else must be broadcasted
+	for (int32 Round = 0; Round < 3; Round++)
+	{
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+	}
+
+	TestEqual("MaxMeshLoadsInFlight == 1", MaxMeshLoadsInFlight, 1);
+	TestEqual("ScenesLoadedCount == 1", ScenesLoadedCount, 1);
+	TestEqual("AssignedNodes == { 0, 1, 2, 3, 4 }", AssignedNodes, TArray<int32>({ 0, 1, 2, 3, 4 }));
+	TestTrue("AssignedMeshes[0] != nullptr", AssignedMeshes.FindRef(0) != nullptr);
+	TestTrue("AssignedMeshes[0] == AssignedMeshes[2]", AssignedMeshes.FindRef(0) == AssignedMeshes.FindRef(2));
+	TestTrue("AssignedMeshes[1] == AssignedMeshes[4]", AssignedMeshes.FindRef(1) == AssignedMeshes.FindRef(4));
+	TestTrue("AssignedMeshes[0] != AssignedMeshes[1]", AssignedMeshes.FindRef(0) != AssignedMeshes.FindRef(1));
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_GameThreadQueueBudgetAndPriority, "glTFRuntime.UnitTests.Basic.GameThreadQueueBudgetAndPriority", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_GameThreadQueueBudgetAndPriority::RunTest(const FString& Parameters)
+{
+	FglTFRuntimeGameThreadQueue Queue;
+	Queue.Startup();
+	Queue.SetBudget(1000);
+
+	TArray<int32> Order;
+	Queue.Enqueue([&Order]() { Order.Add(0); }, 0);
+	Queue.Enqueue([&Order]() { Order.Add(1); }, 5);
+	FglTFRuntimeLoadHandleRef LoadHandle = MakeShared<FglTFRuntimeLoadHandle, ESPMode::ThreadSafe>();
+	FGraphEventRef Event = Queue.Enqueue([&Order]() { Order.Add(2); }, LoadHandle);
+	Queue.Enqueue([&Order]() { Order.Add(3); }, 5);
+	TestEqual("Queue.Num() == 4", Queue.Num(), 4);
+
+	// promoted while waiting
+	LoadHandle->SetPriority(10);
+
+	Queue.Tick(0);
+	TestEqual("Queue.Num() == 0", Queue.Num(), 0);
+	TestTrue("Order == { 2, 1, 3, 0 }", Order == TArray<int32>({ 2, 1, 3, 0 }));
+	TestTrue("Event->IsComplete()", Event->IsComplete());
+
+	// every item takes longer than the budget, so each tick runs exactly one of them
+	Order.Empty();
+	Queue.SetBudget(0.001f);
+	for (int32 Index = 0; Index < 3; Index++)
+	{
+		Queue.Enqueue([&Order, Index]()
+			{
+				FPlatformProcess::Sleep(0.002f);
+				Order.Add(Index);
+			});
+	}
+
+	Queue.Tick(0);
+	TestEqual("Queue.Num() == 2", Queue.Num(), 2);
+	Queue.Tick(0);
+	TestEqual("Queue.Num() == 1", Queue.Num(), 1);
+
+	// pending items are flushed on shutdown
+	Queue.Shutdown();
+	TestEqual("Queue.Num() == 0", Queue.Num(), 0);
+	TestTrue("Order == { 0, 1, 2 }", Order == TArray<int32>({ 0, 1, 2 }));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Basic_GameThreadQueueHeapOrder, "glTFRuntime.UnitTests.Basic.GameThreadQueueHeapOrder", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Basic_GameThreadQueueHeapOrder::RunTest(const FString& Parameters)
+{
+	FglTFRuntimeGameThreadQueue Queue;
+	Queue.Startup();
+	Queue.SetBudget(1000);
+
+	constexpr int32 NumItems = 1000;
+	FRandomStream RandomStream(17);
+	TArray<TPair<int32, int32>> Order;
+	TArray<FglTFRuntimeLoadHandleRef> LoadHandles;
+	for (int32 Index = 0; Index < NumItems; Index++)
+	{
+		const int32 Priority = RandomStream.RandRange(-5, 5);
+		if (Index % 2)
+		{
+			Queue.Enqueue([&Order, Index, Priority]() { Order.Add(TPair<int32, int32>(Priority, Index)); }, Priority);
+		}
+		else
+		{
+			FglTFRuntimeLoadHandleRef LoadHandle = MakeShared<FglTFRuntimeLoadHandle, ESPMode::ThreadSafe>(Priority);
+			Queue.Enqueue([&Order, Index, LoadHandle]() { Order.Add(TPair<int32, int32>(LoadHandle->GetPriority(), Index)); }, LoadHandle);
+			LoadHandles.Add(LoadHandle);
+		}
+	}
+
+	// demote the first half of the handles and promote the last one while they wait
+	for (int32 Index = 0; Index < LoadHandles.Num() / 2; Index++)
+	{
+		LoadHandles[Index]->SetPriority(-10);
+	}
+	LoadHandles.Last()->SetPriority(10);
+
+	Queue.Tick(0);
+	TestEqual("Order.Num() == NumItems", Order.Num(), NumItems);
+	TestEqual("Order[0].Value == LastLoadHandleIndex", Order[0].Value, NumItems - 2);
+
+	bool bSorted = true;
+	for (int32 Index = 1; Index < Order.Num(); Index++)
+	{
+		// higher priorities first, then FIFO
+		if (Order[Index].Key > Order[Index - 1].Key || (Order[Index].Key == Order[Index - 1].Key && Order[Index].Value < Order[Index - 1].Value))
+		{
+			bSorted = false;
+		}
+	}
+	TestTrue("bSorted", bSorted);
+
+	Queue.Shutdown();
+
+	return true;
+}
+
 #endif
@@ -3,7 +3,11 @@
 #if WITH_DEV_AUTOMATION_TESTS
 #include "glTFRuntimeEditor.h"
 #include "glTFRuntimeFunctionLibrary.h"
+#include "Async/ParallelFor.h"
 #include "Misc/AutomationTest.h"
+#include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "Rendering/SkeletalMeshRenderData.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_Blender_Plane, "glTFRuntime.UnitTests.Mesh.Blender.Plane", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
 
@@ -30,6 +34,294 @@ bool FglTFRuntimeTests_Mesh_Blender_Plane::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_Blender_PlaneMemoryMapped, "glTFRuntime.UnitTests.Mesh.Blender.PlaneMemoryMapped", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_Blender_PlaneMemoryMapped::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Blender/BlenderPlane.gltf");
+	glTFRuntime::Tests::FFixturePath BufferFixture("Blender/BlenderPlane.bin");
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.bAllowExternalFiles = true;
+	LoaderConfig.bMemoryMapFiles = true;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+
+	// only the json is mapped before the first buffer access
+	const int64 JsonSize = IFileManager::Get().FileSize(*Fixture.Path);
+	TestEqual("Asset->GetLoaderStats().MemoryMappedBytes == JsonSize", Asset->GetLoaderStats().MemoryMappedBytes, JsonSize);
+
+	FglTFRuntimeMaterialsConfig MaterialsConfig;
+	FglTFRuntimeMeshLOD LOD;
+	Asset->LoadMeshAsRuntimeLOD(0, LOD, MaterialsConfig);
+
+	TestEqual("Asset->GetLoaderStats().MemoryMappedBytes == JsonSize + BufferSize", Asset->GetLoaderStats().MemoryMappedBytes, JsonSize + IFileManager::Get().FileSize(*BufferFixture.Path));
+	TestEqual("LOD.Primitives[0].Indices = { 0, 1, 3, 0, 3, 2 }", LOD.Primitives[0].Indices, { 0, 1, 3, 0, 3, 2 });
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_TriangleGlbMemoryMapped, "glTFRuntime.UnitTests.Mesh.TriangleGlbMemoryMapped", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_TriangleGlbMemoryMapped::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Triangle.glb");
+
+	// json chunk header + json, BIN chunk header
+	constexpr int64 BinaryChunkOffset = 356;
+	constexpr int64 BinaryChunkSize = 36;
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.bMemoryMapFiles = true;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+
+	TestEqual("Asset->GetLoaderStats().MemoryMappedBytes == FileSize", Asset->GetLoaderStats().MemoryMappedBytes, IFileManager::Get().FileSize(*Fixture.Path));
+
+	// the BIN chunk must be referenced in place, not copied out of the mapping
+	TSharedPtr<FglTFRuntimeMappedFile, ESPMode::ThreadSafe> MappedFile = FglTFRuntimeMappedFile::Open(Fixture.Path);
+	TestTrue("MappedFile.IsValid()", MappedFile.IsValid());
+
+	UglTFRuntimeAsset* MappedAsset = NewObject<UglTFRuntimeAsset>();
+	TestTrue("MappedAsset->LoadFromStorage(MappedFile, LoaderConfig)", MappedAsset->LoadFromStorage(MappedFile.ToSharedRef(), LoaderConfig));
+
+	FglTFRuntimeBlob Blob;
+	TestTrue("MappedAsset->GetParser()->GetBuffer(0, Blob)", MappedAsset->GetParser()->GetBuffer(0, Blob));
+	TestEqual("Blob.Num == BinaryChunkSize", Blob.Num, BinaryChunkSize);
+	TestTrue("Blob.Data == MappedFile->GetData() + BinaryChunkOffset", Blob.Data == MappedFile->GetData() + BinaryChunkOffset);
+
+	FglTFRuntimeMaterialsConfig MaterialsConfig;
+	FglTFRuntimeMeshLOD LOD;
+	MappedAsset->LoadMeshAsRuntimeLOD(0, LOD, MaterialsConfig);
+	TestEqual("LOD.Primitives[0].Positions = { { -10000, 0, 0 }, { 0, -10000, 0 }, { 0, 10000, 0 } }", LOD.Primitives[0].Positions, { { -10000, 0, 0 }, { 0, -10000, 0 }, { 0, 10000, 0 } });
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_TriangleGlbSharedStorage, "glTFRuntime.UnitTests.Mesh.TriangleGlbSharedStorage", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_TriangleGlbSharedStorage::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Triangle.glb");
+
+	constexpr int64 BinaryChunkOffset = 356;
+
+	TArray64<uint8> Data;
+	TestTrue("FFileHelper::LoadFileToArray(Data, *Fixture.Path)", FFileHelper::LoadFileToArray(Data, *Fixture.Path));
+
+	FglTFRuntimeConfig LoaderConfig;
+
+	// raw data is copied, the BIN chunk cannot reference it
+	UglTFRuntimeAsset* CopiedAsset = NewObject<UglTFRuntimeAsset>();
+	TestTrue("CopiedAsset->LoadFromData(Data, LoaderConfig)", CopiedAsset->LoadFromData(Data, LoaderConfig));
+	FglTFRuntimeBlob CopiedBlob;
+	TestTrue("CopiedAsset->GetParser()->GetBuffer(0, CopiedBlob)", CopiedAsset->GetParser()->GetBuffer(0, CopiedBlob));
+	TestTrue("CopiedBlob.Data != Data.GetData() + BinaryChunkOffset", CopiedBlob.Data != Data.GetData() + BinaryChunkOffset);
+
+	const uint8* DataPtr = Data.GetData();
+	FglTFRuntimeBytesStoragePtr Storage = FglTFRuntimeBytesStorage::FromArray(MoveTemp(Data));
+	TestTrue("Storage->GetData() == DataPtr", Storage->GetData() == DataPtr);
+
+	UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
+	TestTrue("Asset->LoadFromStorage(Storage, LoaderConfig)", Asset->LoadFromStorage(Storage.ToSharedRef(), LoaderConfig));
+
+	FglTFRuntimeBlob Blob;
+	TestTrue("Asset->GetParser()->GetBuffer(0, Blob)", Asset->GetParser()->GetBuffer(0, Blob));
+	TestTrue("Blob.Data == DataPtr + BinaryChunkOffset", Blob.Data == DataPtr + BinaryChunkOffset);
+	TestTrue("Blob.Storage.IsValid()", Blob.Storage.IsValid());
+
+	// the parser keeps the storage alive
+	Storage.Reset();
+	Blob = FglTFRuntimeBlob();
+
+	FglTFRuntimeMaterialsConfig MaterialsConfig;
+	FglTFRuntimeMeshLOD LOD;
+	Asset->LoadMeshAsRuntimeLOD(0, LOD, MaterialsConfig);
+	TestEqual("LOD.Primitives[0].Positions = { { -10000, 0, 0 }, { 0, -10000, 0 }, { 0, 10000, 0 } }", LOD.Primitives[0].Positions, { { -10000, 0, 0 }, { 0, -10000, 0 }, { 0, 10000, 0 } });
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_Blender_PlaneCompact, "glTFRuntime.UnitTests.Mesh.Blender.PlaneCompact", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_Blender_PlaneCompact::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Blender/BlenderPlane.gltf");
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.bAllowExternalFiles = true;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+
+	FglTFRuntimeMaterialsConfig MaterialsConfig;
+	MaterialsConfig.bCompactVertexData = true;
+	FglTFRuntimeMeshLOD LOD;
+	Asset->LoadMeshAsRuntimeLOD(0, LOD, MaterialsConfig);
+
+	TestEqual("LOD.Primitives.Num() == 1", LOD.Primitives.Num(), 1);
+	TestTrue("LOD.Primitives[0].bCompactVertexData", LOD.Primitives[0].bCompactVertexData);
+	TestEqual("LOD.Primitives[0].Positions.Num() == 0", LOD.Primitives[0].Positions.Num(), 0);
+	TestEqual("LOD.Primitives[0].NumVertices() == 4", LOD.Primitives[0].NumVertices(), 4);
+	TestEqual("LOD.Primitives[0].Indices = { 0, 1, 3, 0, 3, 2 }", LOD.Primitives[0].Indices, { 0, 1, 3, 0, 3, 2 });
+
+	LOD.Primitives[0].ExpandCompactVertexData();
+	TestEqual("LOD.Primitives[0].Positions = { { -100, -100, 0 }, { -100, 100, 0 }, { 100, -100, 0 }, { 100, 100, 0 } }", LOD.Primitives[0].Positions, { { -100, -100, 0 }, { -100, 100, 0 }, { 100, -100, 0 }, { 100, 100, 0 } });
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_Blender_PlaneDerivedDataCache, "glTFRuntime.UnitTests.Mesh.Blender.PlaneDerivedDataCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_Blender_PlaneDerivedDataCache::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Blender/BlenderPlane.gltf");
+
+	// work on a copy of the asset, so its buffer can be changed
+	const FString TempDirectory = FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("glTFRuntimeTests"), FGuid::NewGuid().ToString());
+	const FString AssetPath = FPaths::Combine(TempDirectory, TEXT("BlenderPlane.gltf"));
+	const FString BufferPath = FPaths::Combine(TempDirectory, TEXT("BlenderPlane.bin"));
+	IFileManager::Get().Copy(*AssetPath, *Fixture.Path);
+	IFileManager::Get().Copy(*BufferPath, *FPaths::Combine(FPaths::GetPath(Fixture.Path), TEXT("BlenderPlane.bin")));
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.bAllowExternalFiles = true;
+	LoaderConfig.DerivedDataCacheDirectory = FPaths::Combine(TempDirectory, TEXT("DerivedData"));
+
+	FglTFRuntimeMaterialsConfig MaterialsConfig;
+
+	for (int32 Pass = 0; Pass < 2; Pass++)
+	{
+		UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(AssetPath, false, LoaderConfig);
+
+		FglTFRuntimeMeshLOD LOD;
+		Asset->LoadMeshAsRuntimeLOD(0, LOD, MaterialsConfig);
+
+		const FglTFRuntimeCacheStats Stats = Asset->GetParser()->GetCacheStats();
+		// the first load builds the primitive, the second one is served from the cache
+		TestEqual("Stats.DerivedDataHits == Pass", Stats.DerivedDataHits, Pass);
+		TestEqual("Stats.DerivedDataMisses == 1 - Pass", Stats.DerivedDataMisses, 1 - Pass);
+		if (Pass == 1)
+		{
+			// a cache hit never loads the buffers
+			TestEqual("Stats.BuffersBytes == 0", Stats.BuffersBytes, static_cast<int64>(0));
+		}
+
+		TestEqual("LOD.Primitives.Num() == 1", LOD.Primitives.Num(), 1);
+		TestEqual("LOD.Primitives[0].Indices = { 0, 1, 3, 0, 3, 2 }", LOD.Primitives[0].Indices, { 0, 1, 3, 0, 3, 2 });
+		TestEqual("LOD.Primitives[0].Positions = { { -100, -100, 0 }, { -100, 100, 0 }, { 100, -100, 0 }, { 100, 100, 0 } }", LOD.Primitives[0].Positions, { { -100, -100, 0 }, { -100, 100, 0 }, { 100, -100, 0 }, { 100, 100, 0 } });
+	}
+
+	// same size and modification time, different content (first position component from -1 to -0.5)
+	TArray<uint8> Buffer;
+	FFileHelper::LoadFileToArray(Buffer, *BufferPath);
+	const FDateTime TimeStamp = IFileManager::Get().GetTimeStamp(*BufferPath);
+	Buffer[2] = 0x00;
+	FFileHelper::SaveArrayToFile(Buffer, *BufferPath);
+	IFileManager::Get().SetTimeStamp(*BufferPath, TimeStamp);
+
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(AssetPath, false, LoaderConfig);
+
+	FglTFRuntimeMeshLOD LOD;
+	Asset->LoadMeshAsRuntimeLOD(0, LOD, MaterialsConfig);
+
+	const FglTFRuntimeCacheStats Stats = Asset->GetParser()->GetCacheStats();
+	TestEqual("Stats.DerivedDataHits == 0", Stats.DerivedDataHits, 0);
+	TestEqual("Stats.DerivedDataMisses == 1", Stats.DerivedDataMisses, 1);
+	TestEqual("LOD.Primitives.Num() == 1", LOD.Primitives.Num(), 1);
+	TestNotEqual("LOD.Primitives[0].Positions[0] != { -100, -100, 0 }", LOD.Primitives[0].Positions[0], FVector(-100, -100, 0));
+
+	TArray<FString> CachedFiles;
+	IFileManager::Get().FindFiles(CachedFiles, *LoaderConfig.DerivedDataCacheDirectory, TEXT("bin"));
+	TestEqual("CachedFiles.Num() == 2", CachedFiles.Num(), 2);
+
+	IFileManager::Get().DeleteDirectory(*TempDirectory, false, true);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_Blender_PlaneCacheBudget, "glTFRuntime.UnitTests.Mesh.Blender.PlaneCacheBudget", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_Blender_PlaneCacheBudget::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Blender/BlenderPlane.gltf");
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.bAllowExternalFiles = true;
+	LoaderConfig.CacheBytesBudget = 1;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+
+	FglTFRuntimeMaterialsConfig MaterialsConfig;
+	UStaticMesh* StaticMesh = Asset->LoadStaticMesh(0, FglTFRuntimeStaticMeshConfig());
+	TestTrue("StaticMesh != nullptr", StaticMesh != nullptr);
+
+	// the most recently added buffer is never evicted by its own insertion
+	FglTFRuntimeCacheStats Stats = Asset->GetCacheStats();
+	TestEqual("Stats.BuffersBytes == IFileManager::Get().FileSize(BlenderPlane.bin)", Stats.BuffersBytes, IFileManager::Get().FileSize(*FPaths::Combine(FPaths::GetPath(Fixture.Path), TEXT("BlenderPlane.bin"))));
+	TestTrue("Stats.LODsBytes > 0", Stats.LODsBytes > 0);
+	TestEqual("Stats.StaticMeshes == 1", Stats.StaticMeshes, 1);
+
+	Asset->TrimCache();
+	Stats = Asset->GetCacheStats();
+	TestEqual("Stats.GetTotalBytes() == 0", Stats.GetTotalBytes(), (int64)0);
+
+	FglTFRuntimeMeshLOD LOD;
+	Asset->LoadMeshAsRuntimeLOD(0, LOD, MaterialsConfig);
+	TestEqual("LOD.Primitives[0].Indices = { 0, 1, 3, 0, 3, 2 }", LOD.Primitives[0].Indices, { 0, 1, 3, 0, 3, 2 });
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_CacheLeastRecentlyUsed, "glTFRuntime.UnitTests.Mesh.CacheLeastRecentlyUsed", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_CacheLeastRecentlyUsed::RunTest(const FString& Parameters)
+{
+	const FString JsonData = TEXT("{\"asset\": {\"version\": \"2.0\"}, \"buffers\": ["
+		"{\"byteLength\": 4, \"uri\": \"data:application/octet-stream;base64,AAECAw==\"},"
+		"{\"byteLength\": 4, \"uri\": \"data:application/octet-stream;base64,BAUGBw==\"},"
+		"{\"byteLength\": 4, \"uri\": \"data:application/octet-stream;base64,CAkKCw==\"}]}");
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.CacheBytesBudget = 8;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromString(JsonData, LoaderConfig);
+	TestTrue("Asset != nullptr", Asset != nullptr);
+
+	TSharedPtr<FglTFRuntimeParser> Parser = Asset->GetParser();
+
+	// the blobs keep their storage alive, a reloaded buffer always gets a new address
+	FglTFRuntimeBlob Blob0;
+	FglTFRuntimeBlob Blob1;
+	FglTFRuntimeBlob Blob2;
+	TestTrue("Parser->GetBuffer(0, Blob0)", Parser->GetBuffer(0, Blob0));
+	TestTrue("Parser->GetBuffer(1, Blob1)", Parser->GetBuffer(1, Blob1));
+	TestEqual("Parser->GetCacheStats().BuffersBytes == 8", Parser->GetCacheStats().BuffersBytes, (int64)8);
+
+	// touch buffer 0, buffer 1 becomes the least recently used one
+	FglTFRuntimeBlob Blob;
+	TestTrue("Parser->GetBuffer(0, Blob)", Parser->GetBuffer(0, Blob));
+	TestTrue("Blob.Data == Blob0.Data", Blob.Data == Blob0.Data);
+
+	TestTrue("Parser->GetBuffer(2, Blob2)", Parser->GetBuffer(2, Blob2));
+	TestEqual("Parser->GetCacheStats().BuffersBytes == 8", Parser->GetCacheStats().BuffersBytes, (int64)8);
+
+	TestTrue("Parser->GetBuffer(2, Blob)", Parser->GetBuffer(2, Blob));
+	TestTrue("Blob.Data == Blob2.Data", Blob.Data == Blob2.Data);
+	TestTrue("Parser->GetBuffer(0, Blob)", Parser->GetBuffer(0, Blob));
+	TestTrue("Blob.Data == Blob0.Data", Blob.Data == Blob0.Data);
+
+	// evicted, decoded again (evicting buffer 2)
+	TestTrue("Parser->GetBuffer(1, Blob)", Parser->GetBuffer(1, Blob));
+	TestTrue("Blob.Data != Blob1.Data", Blob.Data != Blob1.Data);
+	TestEqual("Blob.Data[0] == 4", Blob.Data[0], (uint8)4);
+	TestEqual("Parser->GetCacheStats().BuffersBytes == 8", Parser->GetCacheStats().BuffersBytes, (int64)8);
+
+	// an entry larger than the budget survives its own insertion
+	LoaderConfig.CacheBytesBudget = 1;
+	UglTFRuntimeAsset* SmallBudgetAsset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromString(JsonData, LoaderConfig);
+	TestTrue("SmallBudgetAsset->GetParser()->GetBuffer(0, Blob)", SmallBudgetAsset->GetParser()->GetBuffer(0, Blob));
+	TestEqual("SmallBudgetAsset->GetCacheStats().BuffersBytes == 4", SmallBudgetAsset->GetCacheStats().BuffersBytes, (int64)4);
+	SmallBudgetAsset->TrimCache();
+	TestEqual("SmallBudgetAsset->GetCacheStats().BuffersBytes == 0", SmallBudgetAsset->GetCacheStats().BuffersBytes, (int64)0);
+
+	return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_Blender_PlaneWeightMaps, "glTFRuntime.UnitTests.Mesh.Blender.PlaneWeightMaps", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
 
 bool FglTFRuntimeTests_Mesh_Blender_PlaneWeightMaps::RunTest(const FString& Parameters)
@@ -86,6 +378,809 @@ bool FglTFRuntimeTests_Mesh_Triangle::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_TriangleBgzf, "glTFRuntime.UnitTests.Mesh.TriangleBgzf", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_TriangleBgzf::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Triangle.gltf.bgzf.gz");
+
+	FglTFRuntimeConfig LoaderConfig;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+
+	FglTFRuntimeMaterialsConfig MaterialsConfig;
+	FglTFRuntimeMeshLOD LOD;
+	Asset->LoadMeshAsRuntimeLOD(0, LOD, MaterialsConfig);
+
+	TestEqual("LOD.Primitives.Num() == 1", LOD.Primitives.Num(), 1);
+	TestEqual("LOD.Primitives[0].Positions = { { -10000, 0, 0 }, { 0, -10000, 0 }, { 0, 10000, 0 } }", LOD.Primitives[0].Positions, { { -10000, 0, 0 }, { 0, -10000, 0 }, { 0, 10000, 0 } });
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_TriangleBgzfCorrupted, "glTFRuntime.UnitTests.Mesh.TriangleBgzfCorrupted", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_TriangleBgzfCorrupted::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Triangle.gltf.bgzf.gz");
+
+	AddExpectedError(TEXT("Gzip"), EAutomationExpectedErrorFlags::Contains, 0);
+
+	TArray<uint8> Data;
+	TestTrue("FFileHelper::LoadFileToArray(Data, *Fixture.Path)", FFileHelper::LoadFileToArray(Data, *Fixture.Path));
+
+	FglTFRuntimeConfig LoaderConfig;
+
+	// trailing garbage is ignored
+	TArray<uint8> TrailingGarbage = Data;
+	TrailingGarbage.Append({ 'g', 'a', 'r', 'b', 'a', 'g', 'e' });
+	TestTrue("glTFLoadAssetFromData(TrailingGarbage) != nullptr", UglTFRuntimeFunctionLibrary::glTFLoadAssetFromData(TrailingGarbage, LoaderConfig) != nullptr);
+
+	// an incomplete member is not garbage
+	TArray<uint8> TruncatedMember = Data;
+	TruncatedMember.Append({ 0x1F, 0x8B, 0x08, 0x00 });
+	TestTrue("glTFLoadAssetFromData(TruncatedMember) == nullptr", UglTFRuntimeFunctionLibrary::glTFLoadAssetFromData(TruncatedMember, LoaderConfig) == nullptr);
+
+	// CRC32 of the first BGZF block (its size is stored in the BC subfield)
+	const int32 FirstBlockSize = (Data[16] | (Data[17] << 8)) + 1;
+	TArray<uint8> BadCrc = Data;
+	BadCrc[FirstBlockSize - 8] ^= 0xFF;
+	TestTrue("glTFLoadAssetFromData(BadCrc) == nullptr", UglTFRuntimeFunctionLibrary::glTFLoadAssetFromData(BadCrc, LoaderConfig) == nullptr);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_TriangleZstd, "glTFRuntime.UnitTests.Mesh.TriangleZstd", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_TriangleZstd::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Triangle.gltf.zst");
+
+	FglTFRuntimeConfig LoaderConfig;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+
+	const FglTFRuntimeLoaderStats LoaderStats = Asset->GetLoaderStats();
+	TestEqual("LoaderStats.Compression == Zstd", LoaderStats.Compression, FString("Zstd"));
+	TestEqual("LoaderStats.Chunks == 3", LoaderStats.Chunks, 3);
+	TestTrue("LoaderStats.bParallel", LoaderStats.bParallel);
+
+	FglTFRuntimeMaterialsConfig MaterialsConfig;
+	FglTFRuntimeMeshLOD LOD;
+	Asset->LoadMeshAsRuntimeLOD(0, LOD, MaterialsConfig);
+
+	TestEqual("LOD.Primitives.Num() == 1", LOD.Primitives.Num(), 1);
+	TestEqual("LOD.Primitives[0].Positions = { { -10000, 0, 0 }, { 0, -10000, 0 }, { 0, 10000, 0 } }", LOD.Primitives[0].Positions, { { -10000, 0, 0 }, { 0, -10000, 0 }, { 0, 10000, 0 } });
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_TriangleBase64Blocks, "glTFRuntime.UnitTests.Mesh.TriangleBase64Blocks", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_TriangleBase64Blocks::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Triangle.gltf");
+
+	FString JsonData;
+	FFileHelper::LoadFileToString(JsonData, *Fixture.Path);
+
+	// trailing bytes make the data uri span multiple decoding blocks, padding is stripped
+	const FString TriangleBase64 = TEXT("AAAAAAAAAAAAAMhCAADIwgAAAAAAAAAAAADIQgAAAAAAAAAA");
+	TArray<uint8> BufferData;
+	FBase64::Decode(TriangleBase64, BufferData);
+	BufferData.AddZeroed(100000);
+	FString Base64 = FBase64::Encode(BufferData);
+	Base64.RemoveFromEnd(TEXT("=="));
+	JsonData.ReplaceInline(*TriangleBase64, *Base64);
+
+	FglTFRuntimeConfig LoaderConfig;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromString(JsonData, LoaderConfig);
+
+	FglTFRuntimeMaterialsConfig MaterialsConfig;
+	FglTFRuntimeMeshLOD LOD;
+	Asset->LoadMeshAsRuntimeLOD(0, LOD, MaterialsConfig);
+
+	TestEqual("LOD.Primitives.Num() == 1", LOD.Primitives.Num(), 1);
+	TestEqual("LOD.Primitives[0].Positions = { { -10000, 0, 0 }, { 0, -10000, 0 }, { 0, 10000, 0 } }", LOD.Primitives[0].Positions, { { -10000, 0, 0 }, { 0, -10000, 0 }, { 0, 10000, 0 } });
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_BlenderPlaneFastJson, "glTFRuntime.UnitTests.Mesh.Blender.PlaneFastJson", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_BlenderPlaneFastJson::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Blender/BlenderPlane.gltf");
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.bAllowExternalFiles = true;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+
+	LoaderConfig.bUseFastJsonParser = true;
+	UglTFRuntimeAsset* FastAsset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+
+	const FglTFRuntimeJsonTables& JsonTables = Asset->GetParser()->GetJsonTables();
+	const FglTFRuntimeJsonTables& FastJsonTables = FastAsset->GetParser()->GetJsonTables();
+
+	TestEqual("JsonTables.Accessors.Num() == 2", JsonTables.Accessors.Num(), 2);
+	TestEqual("FastJsonTables.Accessors.Num() == JsonTables.Accessors.Num()", FastJsonTables.Accessors.Num(), JsonTables.Accessors.Num());
+	for (int32 AccessorIndex = 0; AccessorIndex < FMath::Min(JsonTables.Accessors.Num(), FastJsonTables.Accessors.Num()); AccessorIndex++)
+	{
+		const FglTFRuntimeJsonAccessor& Accessor = JsonTables.Accessors[AccessorIndex];
+		const FglTFRuntimeJsonAccessor& FastAccessor = FastJsonTables.Accessors[AccessorIndex];
+		TestEqual("FastAccessor.BufferView == Accessor.BufferView", FastAccessor.BufferView, Accessor.BufferView);
+		TestEqual("FastAccessor.ByteOffset == Accessor.ByteOffset", FastAccessor.ByteOffset, Accessor.ByteOffset);
+		TestEqual("FastAccessor.ComponentType == Accessor.ComponentType", FastAccessor.ComponentType, Accessor.ComponentType);
+		TestEqual("FastAccessor.Count == Accessor.Count", FastAccessor.Count, Accessor.Count);
+		TestEqual("FastAccessor.Elements == Accessor.Elements", FastAccessor.Elements, Accessor.Elements);
+		TestEqual("FastAccessor.bNormalized == Accessor.bNormalized", FastAccessor.bNormalized, Accessor.bNormalized);
+		TestEqual("FastAccessor.bSparse == Accessor.bSparse", FastAccessor.bSparse, Accessor.bSparse);
+		TestTrue("Asset->GetParser()->GetAccessorDescriptor(AccessorIndex)->bInBounds", Asset->GetParser()->GetAccessorDescriptor(AccessorIndex) && Asset->GetParser()->GetAccessorDescriptor(AccessorIndex)->bInBounds);
+		TestTrue("FastAsset->GetParser()->GetAccessorDescriptor(AccessorIndex)->bInBounds", FastAsset->GetParser()->GetAccessorDescriptor(AccessorIndex) && FastAsset->GetParser()->GetAccessorDescriptor(AccessorIndex)->bInBounds);
+	}
+
+	TestEqual("FastJsonTables.BufferViews.Num() == JsonTables.BufferViews.Num()", FastJsonTables.BufferViews.Num(), JsonTables.BufferViews.Num());
+	for (int32 BufferViewIndex = 0; BufferViewIndex < FMath::Min(JsonTables.BufferViews.Num(), FastJsonTables.BufferViews.Num()); BufferViewIndex++)
+	{
+		const FglTFRuntimeJsonBufferView& BufferView = JsonTables.BufferViews[BufferViewIndex];
+		const FglTFRuntimeJsonBufferView& FastBufferView = FastJsonTables.BufferViews[BufferViewIndex];
+		TestEqual("FastBufferView.Buffer == BufferView.Buffer", FastBufferView.Buffer, BufferView.Buffer);
+		TestEqual("FastBufferView.ByteOffset == BufferView.ByteOffset", FastBufferView.ByteOffset, BufferView.ByteOffset);
+		TestEqual("FastBufferView.ByteLength == BufferView.ByteLength", FastBufferView.ByteLength, BufferView.ByteLength);
+		TestEqual("FastBufferView.ByteStride == BufferView.ByteStride", FastBufferView.ByteStride, BufferView.ByteStride);
+		TestEqual("FastBufferView.Target == BufferView.Target", FastBufferView.Target, BufferView.Target);
+	}
+
+	// nodes are only tabled by the fast parser, the default path reads them from the json object
+	TestEqual("JsonTables.Nodes.Num() == 0", JsonTables.Nodes.Num(), 0);
+	TestEqual("FastJsonTables.Nodes.Num() == 1", FastJsonTables.Nodes.Num(), 1);
+	TestEqual("FastAsset->GetNodes().Num() == Asset->GetNodes().Num()", FastAsset->GetNodes().Num(), Asset->GetNodes().Num());
+	for (int32 NodeIndex = 0; NodeIndex < FMath::Min(Asset->GetNodes().Num(), FastAsset->GetNodes().Num()); NodeIndex++)
+	{
+		TestEqual("FastAsset->GetNodes()[NodeIndex].MeshIndex == Asset->GetNodes()[NodeIndex].MeshIndex", FastAsset->GetNodes()[NodeIndex].MeshIndex, Asset->GetNodes()[NodeIndex].MeshIndex);
+		TestEqual("FastAsset->GetNodes()[NodeIndex].SkinIndex == Asset->GetNodes()[NodeIndex].SkinIndex", FastAsset->GetNodes()[NodeIndex].SkinIndex, Asset->GetNodes()[NodeIndex].SkinIndex);
+		TestEqual("FastAsset->GetNodes()[NodeIndex].CameraIndex == Asset->GetNodes()[NodeIndex].CameraIndex", FastAsset->GetNodes()[NodeIndex].CameraIndex, Asset->GetNodes()[NodeIndex].CameraIndex);
+	}
+
+	// the json values of the tabled items are built on demand
+	TestEqual("FastJsonTables.DeferredSections.Num() == 3", FastJsonTables.DeferredSections.Num(), 3);
+	TestEqual("JsonTables.DeferredSections.Num() == 0", JsonTables.DeferredSections.Num(), 0);
+	TSharedPtr<FJsonObject> FastJsonAccessor = FastAsset->GetParser()->GetJsonObjectFromRootIndex(TEXT("accessors"), 0);
+	TestTrue("FastJsonAccessor.IsValid()", FastJsonAccessor.IsValid());
+	TestEqual("FastJsonAccessor->GetIntegerField(\"count\") == JsonTables.Accessors[0].Count", FastJsonAccessor ? FastJsonAccessor->GetIntegerField(TEXT("count")) : 0, JsonTables.Accessors.Num() > 0 ? static_cast<int32>(JsonTables.Accessors[0].Count) : -1);
+	const TArray<TSharedPtr<FJsonValue>>* FastJsonAccessors = nullptr;
+	TestTrue("FastAsset->GetParser()->GetJsonRoot()->TryGetArrayField(\"accessors\", FastJsonAccessors)", FastAsset->GetParser()->GetJsonRoot()->TryGetArrayField(TEXT("accessors"), FastJsonAccessors));
+	TestEqual("FastJsonAccessors->Num() == JsonTables.Accessors.Num()", FastJsonAccessors ? FastJsonAccessors->Num() : 0, JsonTables.Accessors.Num());
+	TestTrue("(*FastJsonAccessors)[0]->AsObject() == FastJsonAccessor", FastJsonAccessors && FastJsonAccessors->Num() > 0 && (*FastJsonAccessors)[0]->AsObject() == FastJsonAccessor);
+
+	FglTFRuntimeMaterialsConfig MaterialsConfig;
+	FglTFRuntimeMeshLOD LOD;
+	FglTFRuntimeMeshLOD FastLOD;
+	TestTrue("Asset->LoadMeshAsRuntimeLOD(0, LOD, MaterialsConfig)", Asset->LoadMeshAsRuntimeLOD(0, LOD, MaterialsConfig));
+	TestTrue("FastAsset->LoadMeshAsRuntimeLOD(0, FastLOD, MaterialsConfig)", FastAsset->LoadMeshAsRuntimeLOD(0, FastLOD, MaterialsConfig));
+	TestEqual("FastLOD.Primitives.Num() == 1", FastLOD.Primitives.Num(), 1);
+	TestEqual("LOD.Primitives.Num() == 1", LOD.Primitives.Num(), 1);
+	if (LOD.Primitives.Num() == 1 && FastLOD.Primitives.Num() == 1)
+	{
+		TestEqual("FastLOD.Primitives[0].Indices == LOD.Primitives[0].Indices", FastLOD.Primitives[0].Indices, LOD.Primitives[0].Indices);
+		TestEqual("FastLOD.Primitives[0].Positions == LOD.Primitives[0].Positions", FastLOD.Primitives[0].Positions, LOD.Primitives[0].Positions);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_BadAccessor, "glTFRuntime.UnitTests.Mesh.BadAccessor", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_BadAccessor::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("BadAccessor.gltf");
+
+	FglTFRuntimeConfig LoaderConfig;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+
+	// the byteOffset pushes the last element out of the bufferView
+	const FglTFRuntimeAccessorDescriptor* Accessor = Asset->GetParser()->GetAccessorDescriptor(0);
+	TestTrue("Accessor != nullptr", Accessor != nullptr);
+	if (Accessor)
+	{
+		TestEqual("Accessor->ElementSize == 4", Accessor->ElementSize, (int64)4);
+		TestEqual("Accessor->Elements == 3", Accessor->Elements, (int64)3);
+		TestFalse("Accessor->bInBounds", Accessor->bInBounds);
+	}
+
+	const FglTFRuntimeBufferViewDescriptor* BufferView = Asset->GetParser()->GetBufferViewDescriptor(0);
+	TestTrue("BufferView != nullptr", BufferView != nullptr);
+	if (BufferView)
+	{
+		TestEqual("BufferView->ByteLength == 36", BufferView->ByteLength, (int64)36);
+	}
+
+	FglTFRuntimeMaterialsConfig MaterialsConfig;
+	FglTFRuntimeMeshLOD LOD;
+	TestFalse("Asset->LoadMeshAsRuntimeLOD(0, LOD, MaterialsConfig)", Asset->LoadMeshAsRuntimeLOD(0, LOD, MaterialsConfig));
+
+	TestTrue("Asset->GetErrors().Contains(\"LoadPrimitive(): Unable to load POSITION attribute\")", Asset->GetErrors().Contains("LoadPrimitive(): Unable to load POSITION attribute"));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_AccessorDescriptors, "glTFRuntime.UnitTests.Mesh.AccessorDescriptors", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_AccessorDescriptors::RunTest(const FString& Parameters)
+{
+	const FString JsonData = TEXT(R"({
+		"asset": { "version": "2.0" },
+		"buffers": [ { "byteLength": 36 } ],
+		"bufferViews": [
+			{ "buffer": 0, "byteLength": 36, "byteStride": 24 },
+			{ "buffer": 0, "byteOffset": -4, "byteLength": 36 }
+		],
+		"accessors": [
+			{ "bufferView": 0, "componentType": 5126, "count": 2, "type": "VEC3" },
+			{ "bufferView": 0, "byteOffset": 4, "componentType": 5126, "count": 2, "type": "VEC3" },
+			{ "bufferView": 0, "componentType": 5126, "count": 2, "type": "VEC5" },
+			{ "bufferView": 0, "componentType": 5126, "count": -1, "type": "SCALAR" },
+			{ "bufferView": 1, "componentType": 5126, "count": 1, "type": "SCALAR" },
+			{ "bufferView": 7, "componentType": 5121, "count": 1, "type": "VEC4", "normalized": true },
+			{ "bufferView": 0, "byteOffset": 36, "componentType": 5126, "count": 0, "type": "SCALAR" }
+		]
+	})");
+
+	FglTFRuntimeConfig LoaderConfig;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromString(JsonData, LoaderConfig);
+	TSharedPtr<FglTFRuntimeParser> Parser = Asset->GetParser();
+
+	TestTrue("Parser->GetBufferViewDescriptor(0) != nullptr", Parser->GetBufferViewDescriptor(0) != nullptr);
+	TestTrue("Parser->GetBufferViewDescriptor(1) == nullptr", Parser->GetBufferViewDescriptor(1) == nullptr);
+	TestTrue("Parser->GetBufferViewDescriptor(2) == nullptr", Parser->GetBufferViewDescriptor(2) == nullptr);
+
+	// the last element does not need the whole stride
+	const FglTFRuntimeAccessorDescriptor* Accessor = Parser->GetAccessorDescriptor(0);
+	TestTrue("Parser->GetAccessorDescriptor(0)->bInBounds", Accessor && Accessor->bInBounds);
+
+	Accessor = Parser->GetAccessorDescriptor(1);
+	TestTrue("!Parser->GetAccessorDescriptor(1)->bInBounds", Accessor && !Accessor->bInBounds);
+
+	TestTrue("Parser->GetAccessorDescriptor(2) == nullptr", Parser->GetAccessorDescriptor(2) == nullptr);
+	TestTrue("Parser->GetAccessorDescriptor(3) == nullptr", Parser->GetAccessorDescriptor(3) == nullptr);
+
+	Accessor = Parser->GetAccessorDescriptor(4);
+	TestTrue("!Parser->GetAccessorDescriptor(4)->bInBounds", Accessor && !Accessor->bInBounds);
+
+	Accessor = Parser->GetAccessorDescriptor(5);
+	TestTrue("!Parser->GetAccessorDescriptor(5)->bInBounds", Accessor && !Accessor->bInBounds);
+	TestTrue("Parser->GetAccessorDescriptor(5)->bNormalized", Accessor && Accessor->bNormalized && Accessor->ElementSize == 1 && Accessor->Elements == 4);
+
+	Accessor = Parser->GetAccessorDescriptor(6);
+	TestTrue("Parser->GetAccessorDescriptor(6)->bInBounds", Accessor && Accessor->bInBounds);
+
+	TestTrue("Parser->GetAccessorDescriptor(7) == nullptr", Parser->GetAccessorDescriptor(7) == nullptr);
+
+	// parsers built straight from a json object resolve the descriptors too
+	TSharedRef<FglTFRuntimeParser> JsonObjectParser = MakeShared<FglTFRuntimeParser>(Parser->GetJsonRoot().ToSharedRef(), FMatrix::Identity, 1);
+	TestTrue("JsonObjectParser->GetBufferViewDescriptor(0) != nullptr", JsonObjectParser->GetBufferViewDescriptor(0) != nullptr);
+	Accessor = JsonObjectParser->GetAccessorDescriptor(0);
+	TestTrue("JsonObjectParser->GetAccessorDescriptor(0)->bInBounds", Accessor && Accessor->bInBounds);
+	TestTrue("JsonObjectParser->GetAccessorDescriptor(2) == nullptr", JsonObjectParser->GetAccessorDescriptor(2) == nullptr);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_TriangleConcurrentTrimLODs, "glTFRuntime.UnitTests.Mesh.TriangleConcurrentTrimLODs", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_TriangleConcurrentTrimLODs::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Triangle.gltf");
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.CacheBytesBudget = 1;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+	TSharedPtr<FglTFRuntimeParser> Parser = Asset->GetParser();
+
+	// cached LODs are evicted while other threads are still reading them
+	FglTFRuntimeMaterialsConfig MaterialsConfig;
+	TArray<FglTFRuntimeMeshLOD> LODs;
+	LODs.AddDefaulted(32);
+	TArray<bool> Results;
+	Results.AddZeroed(32);
+
+	ParallelFor(LODs.Num(), [&](const int32 Index)
+		{
+			if (Index % 2)
+			{
+				Parser->TrimCache(true);
+				Results[Index] = true;
+				return;
+			}
+			Results[Index] = Asset->LoadMeshAsRuntimeLOD(0, LODs[Index], MaterialsConfig);
+		});
+
+	for (int32 Index = 0; Index < LODs.Num(); Index += 2)
+	{
+		TestTrue("Results[Index]", Results[Index]);
+		TestEqual("LODs[Index].Primitives.Num() == 1", LODs[Index].Primitives.Num(), 1);
+		if (LODs[Index].Primitives.Num() == 1)
+		{
+			TestEqual("LODs[Index].Primitives[0].Positions = { { -10000, 0, 0 }, { 0, -10000, 0 }, { 0, 10000, 0 } }", LODs[Index].Primitives[0].Positions, { { -10000, 0, 0 }, { 0, -10000, 0 }, { 0, 10000, 0 } });
+		}
+	}
+
+	Parser->TrimCache(true);
+	TestEqual("Parser->GetCacheStats().LODsBytes == 0", Parser->GetCacheStats().LODsBytes, (int64)0);
+
+	// a runtime LOD is a copy, the cached one is not emptied by the first user
+	FglTFRuntimeMeshLOD FirstLOD;
+	FglTFRuntimeMeshLOD SecondLOD;
+	TestTrue("Asset->LoadMeshAsRuntimeLOD(0, FirstLOD, MaterialsConfig)", Asset->LoadMeshAsRuntimeLOD(0, FirstLOD, MaterialsConfig));
+	TestTrue("Asset->LoadMeshAsRuntimeLOD(0, SecondLOD, MaterialsConfig)", Asset->LoadMeshAsRuntimeLOD(0, SecondLOD, MaterialsConfig));
+	TestEqual("SecondLOD.Primitives.Num() == 1", SecondLOD.Primitives.Num(), 1);
+	if (FirstLOD.Primitives.Num() == 1 && SecondLOD.Primitives.Num() == 1)
+	{
+		TestTrue("SecondLOD.Primitives[0].Positions == FirstLOD.Primitives[0].Positions", SecondLOD.Primitives[0].Positions == FirstLOD.Primitives[0].Positions);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_SmoothNormals, "glTFRuntime.UnitTests.Mesh.SmoothNormals", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_SmoothNormals::RunTest(const FString& Parameters)
+{
+	// two triangles sharing the 0-1 edge
+	const TArray<FVector> Positions = { FVector(0, 0, 0), FVector(1, 0, 0), FVector(0.5, 1, 1), FVector(0.5, -1, 1) };
+	const TArray<uint32> Indices = { 0, 1, 2, 0, 3, 1 };
+
+	TArray<FVector> Normals;
+	glTFRuntime::ComputeSmoothNormals(Positions, Indices, Normals);
+
+	TestEqual("Normals.Num() == 4", Normals.Num(), 4);
+	TestTrue("Normals[0] == (0, 0, -1)", Normals[0].Equals(FVector(0, 0, -1), KINDA_SMALL_NUMBER));
+	TestTrue("Normals[1] == (0, 0, -1)", Normals[1].Equals(FVector(0, 0, -1), KINDA_SMALL_NUMBER));
+	TestTrue("Normals[2] == (0, 1, -1)", Normals[2].Equals(FVector(0, 1, -1).GetSafeNormal(), KINDA_SMALL_NUMBER));
+	TestTrue("Normals[3] == (0, -1, -1)", Normals[3].Equals(FVector(0, -1, -1).GetSafeNormal(), KINDA_SMALL_NUMBER));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_SkeletalRenderDataSharedLOD, "glTFRuntime.UnitTests.Mesh.SkeletalRenderDataSharedLOD", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_SkeletalRenderDataSharedLOD::RunTest(const FString& Parameters)
+{
+	// a cached LOD without normals and tangents, its flags are left to the other builds
+	FglTFRuntimeMeshLOD LOD;
+	LOD.bHasNormals = true;
+	LOD.bHasTangents = true;
+	FglTFRuntimePrimitive& Primitive = LOD.Primitives.AddDefaulted_GetRef();
+	Primitive.Positions = { FVector(0, 0, 0), FVector(1, 0, 0), FVector(0, 1, 0) };
+	Primitive.Indices = { 0, 1, 2 };
+
+	const TArray<FglTFRuntimeMeshLOD*> LODs = { &LOD };
+	FReferenceSkeleton RefSkeleton;
+	FBox BoundingBox(ForceInit);
+	FglTFRuntimeSkeletalMeshConfig SkeletalMeshConfig;
+	TArray<FglTFRuntimeMeshLODFlags> LODsFlags;
+
+	FSkeletalMeshRenderData RenderData;
+	TestTrue("glTFRuntime::FillSkeletalMeshRenderData(...)", glTFRuntime::FillSkeletalMeshRenderData(&RenderData, LODs, RefSkeleton, INDEX_NONE, {}, BoundingBox, SkeletalMeshConfig, [](const FString& ErrorContext, const FString& ErrorMessage) {}, nullptr, &LODsFlags));
+
+	TestEqual("LODsFlags.Num() == 1", LODsFlags.Num(), 1);
+	TestTrue("!LODsFlags[0].bHasNormals", LODsFlags.Num() == 1 && !LODsFlags[0].bHasNormals);
+	TestTrue("!LODsFlags[0].bHasTangents", LODsFlags.Num() == 1 && !LODsFlags[0].bHasTangents);
+	TestTrue("LOD.bHasNormals", LOD.bHasNormals);
+	TestTrue("LOD.bHasTangents", LOD.bHasTangents);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_MikkTSpaceTangents, "glTFRuntime.UnitTests.Mesh.MikkTSpaceTangents", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_MikkTSpaceTangents::RunTest(const FString& Parameters)
+{
+	const TArray<FVector> Positions = { FVector(0, 0, 0), FVector(1, 0, 0), FVector(1, 1, 0), FVector(0, 1, 0) };
+	const TArray<FVector> Normals = { FVector(0, 0, 1), FVector(0, 0, 1), FVector(0, 0, 1), FVector(0, 0, 1) };
+	const TArray<uint32> Indices = { 0, 1, 2, 0, 2, 3 };
+
+	const TArray<FVector2D> UVs = { FVector2D(0, 0), FVector2D(1, 0), FVector2D(1, 1), FVector2D(0, 1) };
+	TArray<FVector4> Tangents;
+	glTFRuntime::ComputeMikkTSpaceTangents(Positions, Normals, UVs, Indices, Tangents);
+
+	TestEqual("Tangents.Num() == 4", Tangents.Num(), 4);
+	for (const FVector4& Tangent : Tangents)
+	{
+		TestTrue("Tangent == (1, 0, 0, 1)", Tangent.Equals(FVector4(1, 0, 0, 1), KINDA_SMALL_NUMBER));
+	}
+
+	// mirrored U
+	const TArray<FVector2D> MirroredUVs = { FVector2D(1, 0), FVector2D(0, 0), FVector2D(0, 1), FVector2D(1, 1) };
+	TArray<FVector4> MirroredTangents;
+	glTFRuntime::ComputeMikkTSpaceTangents(Positions, Normals, MirroredUVs, Indices, MirroredTangents);
+
+	TestEqual("MirroredTangents.Num() == 4", MirroredTangents.Num(), 4);
+	for (const FVector4& Tangent : MirroredTangents)
+	{
+		TestTrue("Tangent == (-1, 0, 0, -1)", Tangent.Equals(FVector4(-1, 0, 0, -1), KINDA_SMALL_NUMBER));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_OptimizeVertexCache, "glTFRuntime.UnitTests.Mesh.OptimizeVertexCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_OptimizeVertexCache::RunTest(const FString& Parameters)
+{
+	// 32x32 quads grid with the triangles in a scrambled order
+	constexpr int32 GridSize = 33;
+	TArray<uint32> Indices;
+	for (int32 Y = 0; Y < GridSize - 1; Y++)
+	{
+		for (int32 X = 0; X < GridSize - 1; X++)
+		{
+			const uint32 Vertex = Y * GridSize + X;
+			Indices.Append({ Vertex, Vertex + 1, Vertex + GridSize, Vertex + 1, Vertex + GridSize + 1, Vertex + GridSize });
+		}
+	}
+
+	const int32 NumTriangles = Indices.Num() / 3;
+	for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+	{
+		const int32 OtherTriangleIndex = (TriangleIndex * 7919) % NumTriangles;
+		for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+		{
+			Swap(Indices[TriangleIndex * 3 + CornerIndex], Indices[OtherTriangleIndex * 3 + CornerIndex]);
+		}
+	}
+
+	auto GetTriangles = [](const TArray<uint32>& InIndices, const TArray<int32>& NewToOld)
+		{
+			TArray<FIntVector> Triangles;
+			for (int32 Index = 0; Index < InIndices.Num(); Index += 3)
+			{
+				int32 Corners[3] = { NewToOld[InIndices[Index]], NewToOld[InIndices[Index + 1]], NewToOld[InIndices[Index + 2]] };
+				// rotate the smallest vertex first, winding is preserved
+				while (Corners[0] > Corners[1] || Corners[0] > Corners[2])
+				{
+					const int32 First = Corners[0];
+					Corners[0] = Corners[1];
+					Corners[1] = Corners[2];
+					Corners[2] = First;
+				}
+				Triangles.Add(FIntVector(Corners[0], Corners[1], Corners[2]));
+			}
+			Triangles.Sort([](const FIntVector& A, const FIntVector& B) { return A.X != B.X ? A.X < B.X : (A.Y != B.Y ? A.Y < B.Y : A.Z < B.Z); });
+			return Triangles;
+		};
+
+	TArray<int32> Identity;
+	for (int32 VertexIndex = 0; VertexIndex < GridSize * GridSize; VertexIndex++)
+	{
+		Identity.Add(VertexIndex);
+	}
+
+	const TArray<FIntVector> OriginalTriangles = GetTriangles(Indices, Identity);
+
+	TArray<uint32> OptimizedIndices = Indices;
+	TArray<int32> NewToOld;
+	FglTFRuntimeMeshOptimizationStats Stats;
+	TestTrue("glTFRuntime::OptimizeSection(...)", glTFRuntime::OptimizeSection(OptimizedIndices, GridSize * GridSize, 16, NewToOld, Stats));
+
+	TestEqual("NewToOld.Num() == GridSize * GridSize", NewToOld.Num(), GridSize * GridSize);
+	TestTrue("GetTriangles(OptimizedIndices, NewToOld) == OriginalTriangles", GetTriangles(OptimizedIndices, NewToOld) == OriginalTriangles);
+	TestEqual("OptimizedIndices[0] == 0", OptimizedIndices[0], 0u);
+	TestEqual("Stats.Triangles == NumTriangles", Stats.Triangles, static_cast<int64>(NumTriangles));
+	TestTrue("Stats.ACMRAfter < Stats.ACMRBefore", Stats.ACMRAfter < Stats.ACMRBefore);
+	TestTrue("Stats.ACMRAfter < 1", Stats.ACMRAfter < 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_OptimizeOverdraw, "glTFRuntime.UnitTests.Mesh.OptimizeOverdraw", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_OptimizeOverdraw::RunTest(const FString& Parameters)
+{
+	// two stacked quads facing +Z, the upper one is seen first and must be drawn first
+	const TArray<FVector> Positions = {
+		FVector(0, 0, -1), FVector(1, 0, -1), FVector(0, 1, -1), FVector(1, 1, -1),
+		FVector(0, 0, 1), FVector(1, 0, 1), FVector(0, 1, 1), FVector(1, 1, 1) };
+	TArray<uint32> Indices = { 0, 2, 1, 1, 2, 3, 4, 6, 5, 5, 6, 7 };
+
+	TestTrue("glTFRuntime::OptimizeOverdraw(...)", glTFRuntime::OptimizeOverdraw(Indices, Positions, 16, 1.05f));
+	TestTrue("Indices == { 4, 6, 5, 5, 6, 7, 0, 2, 1, 1, 2, 3 }", Indices == TArray<uint32>({ 4, 6, 5, 5, 6, 7, 0, 2, 1, 1, 2, 3 }));
+
+	TArray<uint32> BadIndices = { 0, 1, 8, 1, 3, 2 };
+	TestFalse("glTFRuntime::OptimizeOverdraw(BadIndices, ...)", glTFRuntime::OptimizeOverdraw(BadIndices, Positions, 16, 1.05f));
+	TestTrue("BadIndices == { 0, 1, 8, 1, 3, 2 }", BadIndices == TArray<uint32>({ 0, 1, 8, 1, 3, 2 }));
+
+	// the cache miss ratio of a regular grid stays close to the vertex cache pass one
+	constexpr int32 GridSize = 33;
+	TArray<FVector> GridPositions;
+	TArray<uint32> GridIndices;
+	for (int32 Y = 0; Y < GridSize; Y++)
+	{
+		for (int32 X = 0; X < GridSize; X++)
+		{
+			GridPositions.Add(FVector(X, Y, FMath::Sin(X * 0.3) * FMath::Cos(Y * 0.3)));
+			if (X < GridSize - 1 && Y < GridSize - 1)
+			{
+				const uint32 Vertex = Y * GridSize + X;
+				GridIndices.Append({ Vertex, Vertex + 1, Vertex + GridSize, Vertex + 1, Vertex + GridSize + 1, Vertex + GridSize });
+			}
+		}
+	}
+
+	TArray<uint32> CacheOnlyIndices = GridIndices;
+	TArray<int32> NewToOld;
+	FglTFRuntimeMeshOptimizationStats CacheOnlyStats;
+	TestTrue("glTFRuntime::OptimizeSection(CacheOnlyIndices, ...)", glTFRuntime::OptimizeSection(CacheOnlyIndices, GridPositions.Num(), 16, NewToOld, CacheOnlyStats));
+
+	FglTFRuntimeMeshOptimizationStats Stats;
+	TestTrue("glTFRuntime::OptimizeSection(GridIndices, ...)", glTFRuntime::OptimizeSection(GridIndices, GridPositions.Num(), 16, NewToOld, Stats, GridPositions, 1.05f));
+	TestEqual("Stats.Triangles == CacheOnlyStats.Triangles", Stats.Triangles, CacheOnlyStats.Triangles);
+	TestTrue("Stats.ACMRAfter < 1", Stats.ACMRAfter < 1);
+	TestTrue("Stats.ACMRAfter <= CacheOnlyStats.ACMRAfter * 1.2", Stats.ACMRAfter <= CacheOnlyStats.ACMRAfter * 1.2f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_SimplifyMesh, "glTFRuntime.UnitTests.Mesh.SimplifyMesh", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_SimplifyMesh::RunTest(const FString& Parameters)
+{
+	// flat 16x16 quads grid with a locked border
+	constexpr int32 GridSize = 17;
+	TArray<FVector> Positions;
+	TArray<bool> LockedVertices;
+	for (int32 Y = 0; Y < GridSize; Y++)
+	{
+		for (int32 X = 0; X < GridSize; X++)
+		{
+			Positions.Add(FVector(X, Y, 0));
+			LockedVertices.Add(X == 0 || Y == 0 || X == GridSize - 1 || Y == GridSize - 1);
+		}
+	}
+
+	TArray<uint32> Indices;
+	for (int32 Y = 0; Y < GridSize - 1; Y++)
+	{
+		for (int32 X = 0; X < GridSize - 1; X++)
+		{
+			const uint32 Vertex = Y * GridSize + X;
+			Indices.Append({ Vertex, Vertex + 1, Vertex + GridSize, Vertex + 1, Vertex + GridSize + 1, Vertex + GridSize });
+		}
+	}
+
+	const int32 NumTriangles = Indices.Num() / 3;
+	const int32 TargetNumTriangles = NumTriangles / 2;
+
+	TArray<uint32> SimplifiedIndices;
+	const int32 SimplifiedNumTriangles = glTFRuntime::SimplifyMesh(Positions, Indices, LockedVertices, TargetNumTriangles, SimplifiedIndices);
+
+	TestTrue("SimplifiedNumTriangles < NumTriangles", SimplifiedNumTriangles < NumTriangles);
+	TestTrue("SimplifiedNumTriangles >= TargetNumTriangles", SimplifiedNumTriangles >= TargetNumTriangles);
+	TestEqual("SimplifiedIndices.Num() == SimplifiedNumTriangles * 3", SimplifiedIndices.Num(), SimplifiedNumTriangles * 3);
+
+	bool bValidTriangles = true;
+	TSet<uint32> UsedVertices;
+	for (int32 Index = 0; Index < SimplifiedIndices.Num(); Index += 3)
+	{
+		const uint32 A = SimplifiedIndices[Index];
+		const uint32 B = SimplifiedIndices[Index + 1];
+		const uint32 C = SimplifiedIndices[Index + 2];
+		if (A >= static_cast<uint32>(Positions.Num()) || B >= static_cast<uint32>(Positions.Num()) || C >= static_cast<uint32>(Positions.Num()) || A == B || B == C || A == C)
+		{
+			bValidTriangles = false;
+			break;
+		}
+		// no flipped triangles on a flat grid
+		if (FVector::CrossProduct(Positions[B] - Positions[A], Positions[C] - Positions[A]).Z <= 0)
+		{
+			bValidTriangles = false;
+		}
+		UsedVertices.Append({ A, B, C });
+	}
+	TestTrue("bValidTriangles", bValidTriangles);
+
+	bool bBorderPreserved = true;
+	for (int32 VertexIndex = 0; VertexIndex < Positions.Num(); VertexIndex++)
+	{
+		if (LockedVertices[VertexIndex] && !UsedVertices.Contains(VertexIndex))
+		{
+			bBorderPreserved = false;
+		}
+	}
+	TestTrue("bBorderPreserved", bBorderPreserved);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_SimplifySkinnedPrimitive, "glTFRuntime.UnitTests.Mesh.SimplifySkinnedPrimitive", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_SimplifySkinnedPrimitive::RunTest(const FString& Parameters)
+{
+	// flat 16x16 quads grid, split in two halves (one per joint) by an uv seam on the middle column
+	constexpr int32 GridSize = 17;
+	constexpr int32 SeamX = 8;
+	constexpr int32 HalfSize = SeamX + 1;
+
+	FglTFRuntimePrimitive Primitive;
+	Primitive.UVs.AddDefaulted();
+	Primitive.Joints.AddDefaulted();
+	Primitive.Weights.AddDefaulted();
+	for (int32 Side = 0; Side < 2; Side++)
+	{
+		for (int32 Y = 0; Y < GridSize; Y++)
+		{
+			for (int32 X = Side * SeamX; X < Side * SeamX + HalfSize; X++)
+			{
+				Primitive.Positions.Add(FVector(X, Y, 0));
+				Primitive.Normals.Add(FVector(0, 0, 1));
+				Primitive.UVs[0].Add(FVector2D(X / 16.0 + Side, Y / 16.0));
+				FglTFRuntimeUInt16Vector4 Joints;
+				Joints.X = Side;
+				Primitive.Joints[0].Add(Joints);
+				Primitive.Weights[0].Add(FVector4(1, 0, 0, 0));
+			}
+		}
+	}
+
+	for (int32 Y = 0; Y < GridSize - 1; Y++)
+	{
+		for (int32 X = 0; X < GridSize - 1; X++)
+		{
+			const int32 Side = X < SeamX ? 0 : 1;
+			const uint32 Vertex = Side * HalfSize * GridSize + Y * HalfSize + (X - Side * SeamX);
+			Primitive.Indices.Append({ Vertex, Vertex + 1, Vertex + HalfSize, Vertex + 1, Vertex + HalfSize + 1, Vertex + HalfSize });
+		}
+	}
+	Primitive.bHasIndices = true;
+
+	const int32 NumTriangles = Primitive.Indices.Num() / 3;
+
+	FglTFRuntimeMeshLOD LOD;
+	LOD.Primitives.Add(Primitive);
+	TArray<FglTFRuntimeMeshLOD> AutoLODs;
+	glTFRuntime::GenerateSimplifiedLODs(LOD, { 0.5f, 0.25f }, AutoLODs);
+	TestEqual("AutoLODs.Num() == 2", AutoLODs.Num(), 2);
+
+	const FglTFRuntimePrimitive& SimplifiedPrimitive = AutoLODs[0].Primitives[0];
+	const int32 NumSimplifiedTriangles = SimplifiedPrimitive.Indices.Num() / 3;
+	TestTrue("NumSimplifiedTriangles is about NumTriangles / 2", FMath::Abs(NumSimplifiedTriangles - NumTriangles / 2) <= NumTriangles / 10);
+	TestTrue("AutoLODs[1] triangles < AutoLODs[0] triangles", AutoLODs[1].Primitives[0].Indices.Num() < SimplifiedPrimitive.Indices.Num());
+
+	const int32 NumVertices = SimplifiedPrimitive.NumVertices();
+	TestEqual("SimplifiedPrimitive.Joints.Num() == 1", SimplifiedPrimitive.Joints.Num(), 1);
+	TestEqual("SimplifiedPrimitive.Weights.Num() == 1", SimplifiedPrimitive.Weights.Num(), 1);
+	TestEqual("SimplifiedPrimitive.Joints[0].Num() == NumVertices", SimplifiedPrimitive.Joints[0].Num(), NumVertices);
+	TestEqual("SimplifiedPrimitive.Weights[0].Num() == NumVertices", SimplifiedPrimitive.Weights[0].Num(), NumVertices);
+	TestEqual("SimplifiedPrimitive.UVs[0].Num() == NumVertices", SimplifiedPrimitive.UVs[0].Num(), NumVertices);
+
+	// every vertex keeps the attributes of its side, both copies of the seam vertices are kept
+	bool bAttributesKept = true;
+	int32 NumSeamVertices = 0;
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		const FVector& Position = SimplifiedPrimitive.Positions[VertexIndex];
+		const int32 Side = SimplifiedPrimitive.Joints[0][VertexIndex].X;
+		if (!SimplifiedPrimitive.UVs[0][VertexIndex].Equals(FVector2D(Position.X / 16.0 + Side, Position.Y / 16.0)) || !SimplifiedPrimitive.Weights[0][VertexIndex].Equals(FVector4(1, 0, 0, 0)))
+		{
+			bAttributesKept = false;
+		}
+		if (Position.X == SeamX)
+		{
+			NumSeamVertices++;
+		}
+	}
+	TestTrue("bAttributesKept", bAttributesKept);
+	TestEqual("NumSeamVertices == GridSize * 2", NumSeamVertices, GridSize * 2);
+
+	// no triangle crosses the seam
+	bool bSidesKept = true;
+	for (int32 Index = 0; Index < SimplifiedPrimitive.Indices.Num(); Index += 3)
+	{
+		const uint16 Side = SimplifiedPrimitive.Joints[0][SimplifiedPrimitive.Indices[Index]].X;
+		if (SimplifiedPrimitive.Joints[0][SimplifiedPrimitive.Indices[Index + 1]].X != Side || SimplifiedPrimitive.Joints[0][SimplifiedPrimitive.Indices[Index + 2]].X != Side)
+		{
+			bSidesKept = false;
+		}
+	}
+	TestTrue("bSidesKept", bSidesKept);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_WeldPrimitiveVertices, "glTFRuntime.UnitTests.Mesh.WeldPrimitiveVertices", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_WeldPrimitiveVertices::RunTest(const FString& Parameters)
+{
+	// non indexed quad, the last vertex is slightly moved and has a different uv (seam)
+	FglTFRuntimePrimitive Primitive;
+	Primitive.Positions = { FVector(0, 0, 0), FVector(1, 0, 0), FVector(0, 1, 0), FVector(1, 0, 0), FVector(1, 1, 0), FVector(0, 1.0001, 0) };
+	Primitive.Normals = { FVector(0, 0, 1), FVector(0, 0, 1), FVector(0, 0, 1), FVector(0, 0, 1), FVector(0, 0, 1), FVector(0, 0, 1) };
+	Primitive.UVs.AddDefaulted();
+	Primitive.UVs[0] = { FVector2D(0, 0), FVector2D(1, 0), FVector2D(0, 1), FVector2D(1, 0), FVector2D(1, 1), FVector2D(0, 0.5) };
+	Primitive.Indices = { 0, 1, 2, 3, 4, 5 };
+
+	FglTFRuntimePrimitive ExactPrimitive = Primitive;
+	TestEqual("glTFRuntime::WeldPrimitiveVertices(ExactPrimitive, 0, 0)", glTFRuntime::WeldPrimitiveVertices(ExactPrimitive, 0, 0), 1);
+	TestEqual("ExactPrimitive.Positions.Num() == 5", ExactPrimitive.Positions.Num(), 5);
+	TestEqual("ExactPrimitive.Normals.Num() == 5", ExactPrimitive.Normals.Num(), 5);
+	TestEqual("ExactPrimitive.UVs[0].Num() == 5", ExactPrimitive.UVs[0].Num(), 5);
+	TestTrue("ExactPrimitive.Indices == { 0, 1, 2, 1, 3, 4 }", ExactPrimitive.Indices == TArray<uint32>({ 0, 1, 2, 1, 3, 4 }));
+	TestTrue("ExactPrimitive.bHasIndices", ExactPrimitive.bHasIndices);
+
+	// the moved vertex is in the same cell, but the uv does not match
+	FglTFRuntimePrimitive SeamPrimitive = Primitive;
+	TestEqual("glTFRuntime::WeldPrimitiveVertices(SeamPrimitive, 0.01, 0.01)", glTFRuntime::WeldPrimitiveVertices(SeamPrimitive, 0.01, 0.01), 1);
+	TestEqual("SeamPrimitive.Positions.Num() == 5", SeamPrimitive.Positions.Num(), 5);
+
+	FglTFRuntimePrimitive TolerancePrimitive = Primitive;
+	TolerancePrimitive.UVs[0][5] = FVector2D(0.001, 1);
+	TestEqual("glTFRuntime::WeldPrimitiveVertices(TolerancePrimitive, 0.01, 0.01)", glTFRuntime::WeldPrimitiveVertices(TolerancePrimitive, 0.01, 0.01), 2);
+	TestEqual("TolerancePrimitive.Positions.Num() == 4", TolerancePrimitive.Positions.Num(), 4);
+	TestEqual("TolerancePrimitive.UVs[0].Num() == 4", TolerancePrimitive.UVs[0].Num(), 4);
+	TestTrue("TolerancePrimitive.Indices == { 0, 1, 2, 1, 3, 2 }", TolerancePrimitive.Indices == TArray<uint32>({ 0, 1, 2, 1, 3, 2 }));
+
+	// the moved vertex is in the next cell, but still within the tolerance
+	FglTFRuntimePrimitive BoundaryPrimitive = TolerancePrimitive;
+	BoundaryPrimitive.Positions[2] = FVector(0, 0.9999, 0);
+	BoundaryPrimitive.Positions.Add(FVector(0, 1.0049, 0));
+	BoundaryPrimitive.Normals.Add(FVector(0, 0, 1));
+	BoundaryPrimitive.UVs[0].Add(FVector2D(0, 1));
+	BoundaryPrimitive.Indices.Append({ 1, 3, 4 });
+	TestEqual("glTFRuntime::WeldPrimitiveVertices(BoundaryPrimitive, 0.01, 0.01)", glTFRuntime::WeldPrimitiveVertices(BoundaryPrimitive, 0.01, 0.01), 1);
+	TestEqual("BoundaryPrimitive.Positions.Num() == 4", BoundaryPrimitive.Positions.Num(), 4);
+	TestTrue("BoundaryPrimitive.Indices == { 0, 1, 2, 1, 3, 2, 1, 3, 2 }", BoundaryPrimitive.Indices == TArray<uint32>({ 0, 1, 2, 1, 3, 2, 1, 3, 2 }));
+
+	// without normals the shared vertices would be smoothed later
+	FglTFRuntimePrimitive NoNormalsPrimitive = Primitive;
+	NoNormalsPrimitive.Normals.Empty();
+	TestEqual("glTFRuntime::WeldPrimitiveVertices(NoNormalsPrimitive, 0, 0)", glTFRuntime::WeldPrimitiveVertices(NoNormalsPrimitive, 0, 0), 0);
+	TestEqual("NoNormalsPrimitive.Positions.Num() == 6", NoNormalsPrimitive.Positions.Num(), 6);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_WeldVerticesTinyTolerance, "glTFRuntime.UnitTests.Mesh.WeldVerticesTinyTolerance", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_WeldVerticesTinyTolerance::RunTest(const FString& Parameters)
+{
+	// cells way out of the int32 range
+	const TArray<FVector> Positions = { FVector(100000, 0, 0), FVector(100000, 0, 0), FVector(-100000, 0, 0), FVector(100000, 1e30, 0) };
+
+	TArray<int32> Offsets;
+	TArray<int32> Vertices;
+	TArray<int32> VertexGroups;
+	glTFRuntime::WeldVertices(Positions, 1e-6f, Offsets, Vertices, VertexGroups);
+	TestEqual("Offsets.Num() == 4", Offsets.Num(), 4);
+	TestEqual("VertexGroups[0] == VertexGroups[1]", VertexGroups[0], VertexGroups[1]);
+	TestNotEqual("VertexGroups[0] != VertexGroups[2]", VertexGroups[0], VertexGroups[2]);
+	TestNotEqual("VertexGroups[0] != VertexGroups[3]", VertexGroups[0], VertexGroups[3]);
+
+	FglTFRuntimePrimitive Primitive;
+	Primitive.Positions = Positions;
+	Primitive.Normals = { FVector(0, 0, 1), FVector(0, 0, 1), FVector(0, 0, 1), FVector(0, 0, 1) };
+	Primitive.Indices = { 0, 1, 2, 3, 2, 1 };
+	TestEqual("glTFRuntime::WeldPrimitiveVertices(Primitive, 1e-6, 0)", glTFRuntime::WeldPrimitiveVertices(Primitive, 1e-6f, 0), 1);
+	TestEqual("Primitive.Positions.Num() == 3", Primitive.Positions.Num(), 3);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_WeldVerticesCellBoundary, "glTFRuntime.UnitTests.Mesh.WeldVerticesCellBoundary", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_WeldVerticesCellBoundary::RunTest(const FString& Parameters)
+{
+	// the first two are in different cells, but closer than the tolerance
+	const TArray<FVector> Positions = { FVector(0.999, 0, 0), FVector(1.001, 0, 0), FVector(5, 0, 0) };
+
+	TArray<int32> Offsets;
+	TArray<int32> Vertices;
+	TArray<int32> VertexGroups;
+	glTFRuntime::WeldVertices(Positions, 1, Offsets, Vertices, VertexGroups);
+	TestEqual("Offsets.Num() == 3", Offsets.Num(), 3);
+	TestEqual("VertexGroups[0] == VertexGroups[1]", VertexGroups[0], VertexGroups[1]);
+	TestNotEqual("VertexGroups[0] != VertexGroups[2]", VertexGroups[0], VertexGroups[2]);
+
+	return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_TriangleSceneScaled, "glTFRuntime.UnitTests.Mesh.TriangleSceneScaled", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
 
 bool FglTFRuntimeTests_Mesh_TriangleSceneScaled::RunTest(const FString& Parameters)
@@ -159,4 +1254,104 @@ bool FglTFRuntimeTests_Mesh_BadMesh::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_Blender_PlaneAsyncCancel, "glTFRuntime.UnitTests.Mesh.Blender.PlaneAsyncCancel", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_Blender_PlaneAsyncCancel::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Blender/BlenderPlane.gltf");
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.bAllowExternalFiles = true;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+
+	FglTFRuntimeStaticMeshConfig StaticMeshConfig;
+	StaticMeshConfig.CacheMode = EglTFRuntimeCacheMode::None;
+
+	bool bLoaded = false;
+	UStaticMesh* LoadedStaticMesh = nullptr;
+	FglTFRuntimeLoadHandleRef LoadHandle = Asset->GetParser()->LoadStaticMeshAsync(0, FglTFRuntimeNativeStaticMeshAsync::CreateLambda([&bLoaded, &LoadedStaticMesh](UStaticMesh* StaticMesh)
+		{
+			bLoaded = true;
+			LoadedStaticMesh = StaticMesh;
+		}), StaticMeshConfig);
+
+	double StartTime = FPlatformTime::Seconds();
+	while (!bLoaded && FPlatformTime::Seconds() - StartTime < 10)
+	{
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+	}
+
+	TestTrue("LoadedStaticMesh != nullptr", LoadedStaticMesh != nullptr);
+	TestTrue("LoadHandle->IsCompleted()", LoadHandle->IsCompleted());
+	TestEqual("LoadHandle->GetProgress() == 1", LoadHandle->GetProgress(), 1.0f);
+
+	// wherever the worker is, a cancelled load completes with a null mesh and no errors
+	bLoaded = false;
+	LoadedStaticMesh = nullptr;
+	LoadHandle = Asset->GetParser()->LoadStaticMeshAsync(0, FglTFRuntimeNativeStaticMeshAsync::CreateLambda([&bLoaded, &LoadedStaticMesh](UStaticMesh* StaticMesh)
+		{
+			bLoaded = true;
+			LoadedStaticMesh = StaticMesh;
+		}), StaticMeshConfig);
+	LoadHandle->Cancel();
+
+	StartTime = FPlatformTime::Seconds();
+	while (!bLoaded && FPlatformTime::Seconds() - StartTime < 10)
+	{
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+	}
+
+	TestTrue("bLoaded", bLoaded);
+	TestTrue("LoadedStaticMesh == nullptr", LoadedStaticMesh == nullptr);
+	TestTrue("LoadHandle->IsCompleted()", LoadHandle->IsCompleted());
+	TestFalse("Asset->GetParser()->HasErrors()", Asset->GetParser()->HasErrors());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTests_Mesh_Blender_PlaneAsyncHandles, "glTFRuntime.UnitTests.Mesh.Blender.PlaneAsyncHandles", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTests_Mesh_Blender_PlaneAsyncHandles::RunTest(const FString& Parameters)
+{
+	glTFRuntime::Tests::FFixturePath Fixture("Blender/BlenderPlane.gltf");
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.bAllowExternalFiles = true;
+	UglTFRuntimeAsset* Asset = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilename(Fixture.Path, false, LoaderConfig);
+
+	auto WaitForLoadHandle = [](FglTFRuntimeLoadHandleRef LoadHandle)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			while (!LoadHandle->IsCompleted() && FPlatformTime::Seconds() - StartTime < 10)
+			{
+				FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+			}
+		};
+
+	FglTFRuntimeLoadHandleRef LoadHandle = Asset->GetParser()->LoadMeshAsRuntimeLODAsync(0, FglTFRuntimeMeshLODAsync(), FglTFRuntimeMaterialsConfig());
+	WaitForLoadHandle(LoadHandle);
+	TestTrue("LoadMeshAsRuntimeLODAsync LoadHandle->IsCompleted()", LoadHandle->IsCompleted());
+	TestEqual("LoadMeshAsRuntimeLODAsync LoadHandle->GetProgress() == 1", LoadHandle->GetProgress(), 1.0f);
+
+	FglTFRuntimeStaticMeshConfig StaticMeshConfig;
+	LoadHandle = Asset->GetParser()->LoadStaticMeshRecursiveAsync("", {}, FglTFRuntimeStaticMeshAsync(), StaticMeshConfig);
+	WaitForLoadHandle(LoadHandle);
+	TestTrue("LoadStaticMeshRecursiveAsync LoadHandle->IsCompleted()", LoadHandle->IsCompleted());
+
+	// cancelled loads still complete (with a null result)
+	LoadHandle = Asset->GetParser()->LoadStaticMeshRecursiveAsync("", {}, FglTFRuntimeStaticMeshAsync(), StaticMeshConfig);
+	LoadHandle->Cancel();
+	WaitForLoadHandle(LoadHandle);
+	TestTrue("LoadStaticMeshRecursiveAsync (cancelled) LoadHandle->IsCompleted()", LoadHandle->IsCompleted());
+
+	UglTFRuntimeLoadHandle* BlueprintLoadHandle = UglTFRuntimeFunctionLibrary::glTFLoadAssetFromStringAsync(TEXT("{\"asset\": {\"version\": \"2.0\"}}"), LoaderConfig, FglTFRuntimeHttpResponse());
+	BlueprintLoadHandle->Cancel();
+	WaitForLoadHandle(BlueprintLoadHandle->LoadHandle.ToSharedRef());
+	TestTrue("glTFLoadAssetFromStringAsync BlueprintLoadHandle->IsCompleted()", BlueprintLoadHandle->IsCompleted());
+
+	TestFalse("Asset->GetParser()->HasErrors()", Asset->GetParser()->HasErrors());
+
+	return true;
+}
+
 #endif